@@ -0,0 +1,25 @@
+// Replaces the global operator new so every heap allocation is reported to the profiler,
+// which charges it to the zone open at the time. Only built into the game, and only with
+// ALLOCATION_TRACKING; the headless ScenarioRunner has its own operator new for its totals.
+//
+// The array and nothrow forms aren't replaced, the default ones forward to these.
+#include "Profiler.h"
+
+#if ALLOCATION_TRACKING
+#include <cstdlib>
+#include <new>
+
+void* operator new(std::size_t size) {
+    Profiler::CountAllocation(size);
+    if (void* block = std::malloc(size ? size : 1)) return block;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept {
+    std::free(block);
+}
+
+void operator delete(void* block, std::size_t) noexcept {
+    std::free(block);
+}
+#endif
@@ -0,0 +1,131 @@
+#include "CollisionStage.h"
+#include <algorithm>
+#include <cmath>
+
+CollisionStage::CollisionStage(float cellSize)
+    : cellSize(cellSize),
+      invCellSize(1.0f / cellSize) {
+}
+
+void CollisionStage::Clear() {
+    targets.clear();
+    cells.clear();
+}
+
+void CollisionStage::AddTarget(int id, const sf::Vector2f& center, float radius, uint8_t owner) {
+    CollisionTarget target;
+    target.id = id;
+    target.center = center;
+    target.radius = radius;
+    target.owner = owner;
+    targets.push_back(target);
+}
+
+int64_t CollisionStage::CellKey(int cellX, int cellY) const {
+    return (static_cast<int64_t>(cellX) << 32) ^ static_cast<int64_t>(static_cast<uint32_t>(cellY));
+}
+
+int CollisionStage::CellCoord(float value) const {
+    return static_cast<int>(std::floor(value * invCellSize));
+}
+
+void CollisionStage::Build() {
+    cells.clear();
+    
+    // Insert each target into every cell its bounding box overlaps
+    for (size_t i = 0; i < targets.size(); i++) {
+        const CollisionTarget& target = targets[i];
+        int minX = CellCoord(target.center.x - target.radius);
+        int maxX = CellCoord(target.center.x + target.radius);
+        int minY = CellCoord(target.center.y - target.radius);
+        int maxY = CellCoord(target.center.y + target.radius);
+        
+        for (int cy = minY; cy <= maxY; cy++) {
+            for (int cx = minX; cx <= maxX; cx++) {
+                cells.push_back({ CellKey(cx, cy), static_cast<int>(i) });
+            }
+        }
+    }
+    
+    std::sort(cells.begin(), cells.end());
+}
+
+bool CollisionStage::SweepCircle(const sf::Vector2f& start, const sf::Vector2f& end,
+                                 const sf::Vector2f& center, float radius, float& outTime) {
+    sf::Vector2f d = end - start;
+    sf::Vector2f f = start - center;
+    
+    float c = f.x * f.x + f.y * f.y - radius * radius;
+    if (c <= 0.0f) {
+        // Already overlapping at the start of the tick
+        outTime = 0.0f;
+        return true;
+    }
+    
+    float a = d.x * d.x + d.y * d.y;
+    if (a <= 0.0f) return false;
+    
+    float b = 2.0f * (f.x * d.x + f.y * d.y);
+    float discriminant = b * b - 4.0f * a * c;
+    if (discriminant < 0.0f) return false;
+    
+    float t = (-b - std::sqrt(discriminant)) / (2.0f * a);
+    if (t < 0.0f || t > 1.0f) return false;
+    
+    outTime = t;
+    return true;
+}
+
+void CollisionStage::SweepBullets(const BulletPool& bullets, float bulletRadius, std::vector<BulletHit>& outHits) const {
+    if (cells.empty()) return;
+    
+    for (size_t i = 0; i < bullets.Size(); i++) {
+        SweepBullet(bullets, i, bulletRadius, outHits);
+    }
+}
+
+void CollisionStage::SweepBullets(const BulletPool& bullets, float bulletRadius, std::vector<BulletHit>& outHits, uint8_t rewind) const {
+    if (cells.empty()) return;
+    
+    for (size_t i = 0; i < bullets.Size(); i++) {
+        if (bullets.GetRewind(i) != rewind) continue;
+        SweepBullet(bullets, i, bulletRadius, outHits);
+    }
+}
+
+void CollisionStage::SweepBullet(const BulletPool& bullets, size_t i, float bulletRadius, std::vector<BulletHit>& outHits) const {
+    sf::Vector2f start = bullets.GetPreviousPosition(i);
+    sf::Vector2f end = bullets.GetPosition(i);
+    uint8_t shooter = bullets.GetShooter(i);
+    
+    // Cells covered by the swept segment's bounding box
+    int minX = CellCoord(std::min(start.x, end.x) - bulletRadius);
+    int maxX = CellCoord(std::max(start.x, end.x) + bulletRadius);
+    int minY = CellCoord(std::min(start.y, end.y) - bulletRadius);
+    int maxY = CellCoord(std::max(start.y, end.y) + bulletRadius);
+    
+    float bestTime = 2.0f;
+    int bestTarget = -1;
+    
+    for (int cy = minY; cy <= maxY; cy++) {
+        for (int cx = minX; cx <= maxX; cx++) {
+            CellEntry probe = { CellKey(cx, cy), 0 };
+            auto it = std::lower_bound(cells.begin(), cells.end(), probe);
+            
+            for (; it != cells.end() && it->key == probe.key; ++it) {
+                const CollisionTarget& target = targets[it->target];
+                if (target.owner != BULLET_INVALID_SHOOTER && target.owner == shooter) continue;
+                
+                float time;
+                if (SweepCircle(start, end, target.center, target.radius + bulletRadius, time) && time < bestTime) {
+                    bestTime = time;
+                    bestTarget = it->target;
+                }
+            }
+        }
+    }
+    
+    if (bestTarget >= 0) {
+        outHits.push_back({ i, targets[bestTarget].id, bestTime });
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef COLLISION_STAGE_H
+#define COLLISION_STAGE_H
+
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <vector>
+#include "../entities/player/BulletPool.h"
+#include "../utils/config/BulletConfig.h"
+
+// Something bullets can hit, approximated by a circle
+struct CollisionTarget {
+    int id;                                      // Caller-defined (enemy ID, player slot...)
+    sf::Vector2f center;
+    float radius;
+    uint8_t owner = BULLET_INVALID_SHOOTER;      // Bullets from this shooter pass through
+};
+
+// Earliest hit found for one bullet during a sweep
+struct BulletHit {
+    size_t bulletIndex;
+    int targetId;
+    float time;                                  // 0..1 along the bullet's path this tick
+};
+
+// Swept bullet collision against a uniform grid of targets.
+//
+// Each tick the owner rebuilds the target list, then sweeps every bullet's
+// segment (previous -> current position) through the grid cells it covers and
+// keeps the earliest intersection, so fast bullets can't tunnel through small
+// enemies. Hits come back as one batch, ordered by bullet index, so callers can
+// apply damage and remove bullets in a single pass. Storage is reused between
+// ticks.
+class CollisionStage {
+public:
+    explicit CollisionStage(float cellSize = COLLISION_CELL_SIZE);
+    
+    // Target setup - call Clear, AddTarget for each target, then Build
+    void Clear();
+    void AddTarget(int id, const sf::Vector2f& center, float radius, uint8_t owner = BULLET_INVALID_SHOOTER);
+    void Build();
+    
+    // Appends the earliest hit of every bullet that touches a target
+    void SweepBullets(const BulletPool& bullets, float bulletRadius, std::vector<BulletHit>& outHits) const;
+    // Same, restricted to bullets tagged with the given lag compensation rewind
+    void SweepBullets(const BulletPool& bullets, float bulletRadius, std::vector<BulletHit>& outHits, uint8_t rewind) const;
+    
+    size_t GetTargetCount() const { return targets.size(); }
+    
+private:
+    struct CellEntry {
+        int64_t key;
+        int target;
+        bool operator<(const CellEntry& other) const { return key < other.key; }
+    };
+    
+    int64_t CellKey(int cellX, int cellY) const;
+    int CellCoord(float value) const;
+    void SweepBullet(const BulletPool& bullets, size_t index, float bulletRadius, std::vector<BulletHit>& outHits) const;
+    static bool SweepCircle(const sf::Vector2f& start, const sf::Vector2f& end,
+                            const sf::Vector2f& center, float radius, float& outTime);
+    
+    float cellSize;
+    float invCellSize;
+    std::vector<CollisionTarget> targets;
+    std::vector<CellEntry> cells;                // Sorted by key after Build
+};
+
+#endif // COLLISION_STAGE_H
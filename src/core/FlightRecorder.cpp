@@ -0,0 +1,215 @@
+#include "FlightRecorder.h"
+#include "../utils/TimestampedPath.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace {
+    int64_t ToNanoseconds(std::chrono::steady_clock::time_point time) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    }
+}
+
+FlightRecorder& FlightRecorder::Get() {
+    static FlightRecorder instance;
+    return instance;
+}
+
+FlightRecorder::FlightRecorder()
+    : ring(FLIGHT_RECORDER_FRAMES),
+      lastFrame(Clock::now())
+{
+    dumpFrames.reserve(FLIGHT_RECORDER_FRAMES);
+}
+
+FlightRecorder::~FlightRecorder() {
+    Stop();
+}
+
+void FlightRecorder::Start() {
+    if (watchdog.joinable()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(ringMutex);
+        lastFrame = Clock::now();
+    }
+    stopping = false;
+    watchdog = std::thread(&FlightRecorder::WatchdogLoop, this);
+}
+
+void FlightRecorder::Stop() {
+    if (!watchdog.joinable()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(watchdogMutex);
+        stopping = true;
+    }
+    watchdogWake.notify_one();
+    watchdog.join();
+}
+
+void FlightRecorder::RecordFrame(int simulationTicks, size_t enemies, size_t players) {
+    Clock::time_point now = Clock::now();
+    uint64_t frame;
+    float frameMs;
+    {
+        std::lock_guard<std::mutex> lock(ringMutex);
+        FrameRecord& record = ring[ringHead];
+        frame = ++frameCount;
+        frameMs = std::chrono::duration<float, std::milli>(now - lastFrame).count();
+
+        record.frame = frame;
+        record.end = now;
+        record.frameMs = frameMs;
+        record.ticks = simulationTicks;
+        record.enemies = static_cast<uint32_t>(enemies);
+        record.players = static_cast<uint32_t>(players);
+        record.messagesIn = messagesIn.exchange(0, std::memory_order_relaxed);
+        record.messagesOut = messagesOut.exchange(0, std::memory_order_relaxed);
+        record.bytesIn = bytesIn.exchange(0, std::memory_order_relaxed);
+        record.bytesOut = bytesOut.exchange(0, std::memory_order_relaxed);
+        record.roundTripMs = roundTripMs.load(std::memory_order_relaxed);
+        record.zoneCount = Profiler::Get().GetLastFrame(record.zones, FLIGHT_RECORDER_ZONES);
+
+        ringHead = (ringHead + 1) % ring.size();
+        ringCount = std::min(ringCount + 1, ring.size());
+        lastFrame = now;
+    }
+
+    // The first frame includes whatever ran before the loop started
+    if (frame > 1 && frameMs > FLIGHT_LONG_FRAME_MS) {
+        longFrame.store(frame, std::memory_order_relaxed);
+    }
+    lastFrameNs.store(ToNanoseconds(now), std::memory_order_relaxed);
+    heartbeat.store(frame, std::memory_order_release);
+}
+
+void FlightRecorder::CountMessage(bool outgoing, size_t bytes) {
+    if (outgoing) {
+        messagesOut.fetch_add(1, std::memory_order_relaxed);
+        bytesOut.fetch_add(static_cast<uint32_t>(bytes), std::memory_order_relaxed);
+    } else {
+        messagesIn.fetch_add(1, std::memory_order_relaxed);
+        bytesIn.fetch_add(static_cast<uint32_t>(bytes), std::memory_order_relaxed);
+    }
+}
+
+void FlightRecorder::WatchdogLoop() {
+    uint64_t stallReportedAt = 0;            // Heartbeat of the last stall dumped, so each stall is dumped once
+    bool dumpedLongFrame = false;
+    Clock::time_point lastLongFrameDump;
+
+    std::unique_lock<std::mutex> lock(watchdogMutex);
+    while (!stopping) {
+        watchdogWake.wait_for(lock, std::chrono::milliseconds(FLIGHT_WATCHDOG_POLL_MS),
+                              [this] { return stopping; });
+        if (stopping) break;
+        lock.unlock();
+
+        // Nothing to compare against until the main loop has finished a frame
+        uint64_t beat = heartbeat.load(std::memory_order_acquire);
+        if (beat > 0) {
+            Clock::time_point now = Clock::now();
+            int64_t silentMs = (ToNanoseconds(now) - lastFrameNs.load(std::memory_order_relaxed)) / 1000000;
+            if (silentMs >= FLIGHT_STALL_MS && stallReportedAt != beat) {
+                stallReportedAt = beat;
+                Dump("Stall: main thread has not finished a frame for " + std::to_string(silentMs) + " ms");
+            }
+
+            uint64_t slowFrame = longFrame.exchange(0, std::memory_order_relaxed);
+            bool cooledDown = !dumpedLongFrame ||
+                std::chrono::duration<float>(now - lastLongFrameDump).count() >= FLIGHT_DUMP_COOLDOWN;
+            if (slowFrame > 0 && cooledDown) {
+                dumpedLongFrame = true;
+                lastLongFrameDump = now;
+                Dump("Long frame #" + std::to_string(slowFrame));
+            }
+        }
+
+        lock.lock();
+    }
+}
+
+std::string FlightRecorder::Dump(const std::string& reason) {
+    std::lock_guard<std::mutex> dumpLock(dumpMutex);
+
+    // Copy out oldest first and let the main thread carry on while we format
+    {
+        std::lock_guard<std::mutex> lock(ringMutex);
+        dumpFrames.clear();
+        size_t first = (ringHead + ring.size() - ringCount) % ring.size();
+        for (size_t i = 0; i < ringCount; i++) {
+            dumpFrames.push_back(ring[(first + i) % ring.size()]);
+        }
+    }
+    const char* openZones[PROFILER_MAX_DEPTH];
+    int openCount = Profiler::Get().GetOpenZones(openZones, PROFILER_MAX_DEPTH);
+
+    // A stall and the long frame that ends it can land in the same second
+    std::string path = MakeTimestampedPath(FLIGHT_FILE_PREFIX, ".txt");
+    for (int suffix = 2; std::ifstream(path).good(); suffix++) {
+        path = MakeTimestampedPath(FLIGHT_FILE_PREFIX, "_" + std::to_string(suffix) + ".txt");
+    }
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "[FLIGHT] Could not write " << path << "\n";
+        return "";
+    }
+
+    file << "Flight recorder: " << reason << "\n";
+    file << dumpFrames.size() << " frames, oldest first, times relative to the newest\n";
+    if (!PROFILING_ENABLED) {
+        file << "Counters only: profiling is compiled out of this build, so there are no zone times\n";
+    }
+    file << "\n";
+
+    if (PROFILING_ENABLED) {
+        file << "Open zones on the main thread: ";
+        if (openCount == 0) file << "(none)";
+        for (int i = 0; i < openCount; i++) {
+            file << (i > 0 ? " > " : "") << openZones[i];
+        }
+        file << "\n";
+    }
+
+    if (!dumpFrames.empty()) {
+        const FrameRecord* worst = &dumpFrames.front();
+        double totalMs = 0.0;
+        for (const FrameRecord& record : dumpFrames) {
+            totalMs += record.frameMs;
+            if (record.frameMs > worst->frameMs) worst = &record;
+        }
+        char summary[128];
+        std::snprintf(summary, sizeof(summary), "Frame time: %.2f ms average, %.2f ms worst (#%llu)\n\n",
+                      totalMs / dumpFrames.size(), worst->frameMs, static_cast<unsigned long long>(worst->frame));
+        file << summary;
+    }
+
+    file << "frame        t (s)   frame ms ticks enemies players  msgs in/out   bytes in/out   rtt ms\n";
+    Clock::time_point newest = dumpFrames.empty() ? Clock::now() : dumpFrames.back().end;
+    char line[256];
+    for (const FrameRecord& record : dumpFrames) {
+        float seconds = std::chrono::duration<float>(record.end - newest).count();
+        std::snprintf(line, sizeof(line), "#%-10llu %8.3f %10.2f %5d %7u %7u %6u/%-6u %7u/%-7u %7.1f\n",
+                      static_cast<unsigned long long>(record.frame), seconds, record.frameMs, record.ticks,
+                      record.enemies, record.players, record.messagesIn, record.messagesOut,
+                      record.bytesIn, record.bytesOut, record.roundTripMs);
+        file << line;
+
+        // Nested zones are marked with one '>' per level below the top
+        if (record.zoneCount > 0) {
+            file << "    ";
+            for (int i = 0; i < record.zoneCount; i++) {
+                const Profiler::ZoneSample& zone = record.zones[i];
+                std::snprintf(line, sizeof(line), "%s%s%s %.2f", i > 0 ? ", " : "",
+                              std::string(std::max(zone.depth - 1, 0), '>').c_str(), zone.name, zone.ms);
+                file << line;
+            }
+            file << "\n";
+        }
+    }
+
+    std::cout << "[FLIGHT] " << reason << ", wrote " << path << "\n";
+    return path;
+}
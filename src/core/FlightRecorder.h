@@ -0,0 +1,99 @@
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Profiler.h"
+#include "../utils/config/Config.h"
+
+// Keeps the last FLIGHT_RECORDER_FRAMES frames in memory and writes them out when
+// something goes wrong, so a reported hitch comes with the frames leading up to it.
+//
+// Each frame records its time, simulation ticks, enemy and player counts, messages and
+// bytes in and out, the input round trip and the profiler's zone times. A watchdog
+// thread dumps the ring when a frame runs over FLIGHT_LONG_FRAME_MS, or when the main
+// thread hasn't finished a frame for FLIGHT_STALL_MS; a stall dump also lists the zones
+// the main thread is stuck in. Recording is a copy into a preallocated slot per frame.
+//
+// Without PROFILING_ENABLED (release builds) there are no zones: dumps carry the counters
+// and frame times only, and say so at the top.
+class FlightRecorder {
+public:
+    static FlightRecorder& Get();
+
+    // Starts the watchdog. Frames are recorded whether or not it runs.
+    void Start();
+    void Stop();
+
+    // Once per frame on the main thread, after PROFILE_FRAME_END; frame time is measured
+    // between calls
+    void RecordFrame(int simulationTicks, size_t enemies, size_t players);
+
+    // From any thread, counted into the current frame
+    void CountMessage(bool outgoing, size_t bytes);
+    void SetRoundTrip(float ms) { roundTripMs.store(ms, std::memory_order_relaxed); }
+
+    // Writes the recorded frames to a timestamped file and returns its path
+    std::string Dump(const std::string& reason);
+
+private:
+    FlightRecorder();
+    ~FlightRecorder();
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct FrameRecord {
+        uint64_t frame;
+        Clock::time_point end;
+        float frameMs;
+        int ticks;
+        uint32_t enemies;
+        uint32_t players;
+        uint32_t messagesIn;
+        uint32_t messagesOut;
+        uint32_t bytesIn;
+        uint32_t bytesOut;
+        float roundTripMs;        // -1 when there is nothing to measure it from (host, idle)
+        int zoneCount;
+        Profiler::ZoneSample zones[FLIGHT_RECORDER_ZONES];
+    };
+
+    void WatchdogLoop();
+
+    // Written by the main thread under ringMutex; the watchdog copies it out under the same lock
+    std::mutex ringMutex;
+    std::vector<FrameRecord> ring;
+    size_t ringHead = 0;
+    size_t ringCount = 0;
+    uint64_t frameCount = 0;
+    Clock::time_point lastFrame;
+
+    std::atomic<uint32_t> messagesIn{0};
+    std::atomic<uint32_t> messagesOut{0};
+    std::atomic<uint32_t> bytesIn{0};
+    std::atomic<uint32_t> bytesOut{0};
+    std::atomic<float> roundTripMs{-1.f};
+
+    // What the watchdog looks at
+    std::atomic<uint64_t> heartbeat{0};          // Frames finished
+    std::atomic<int64_t> lastFrameNs{0};         // When the last one finished, Clock epoch
+    std::atomic<uint64_t> longFrame{0};          // Frame number of an unreported long frame, 0 = none
+
+    std::thread watchdog;
+    std::mutex watchdogMutex;
+    std::condition_variable watchdogWake;
+    bool stopping = false;
+
+    std::mutex dumpMutex;
+    std::vector<FrameRecord> dumpFrames;         // Copy of the ring being written out
+};
+
+#endif // FLIGHT_RECORDER_H
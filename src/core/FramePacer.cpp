@@ -0,0 +1,104 @@
+#include "FramePacer.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+FramePacer::FramePacer()
+    : intervals(FRAME_PACER_SAMPLES, 0.0f)
+{
+    lastFrame = Clock::now();
+    deadline = lastFrame;
+    SetTargetRate(FRAME_RATE_TARGET);
+}
+
+void FramePacer::SetTargetRate(int framesPerSecond) {
+    targetRate = std::max(0, framesPerSecond);
+    period = targetRate > 0
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetRate))
+        : Clock::duration(0);
+
+    // Start the schedule over and drop samples measured against the old target
+    deadline = Clock::now();
+    nextSample = 0;
+    sampleCount = 0;
+
+    if (targetRate > 0) {
+        std::cout << "[PACER] Frame rate capped at " << targetRate << " Hz\n";
+    } else {
+        std::cout << "[PACER] Frame rate uncapped\n";
+    }
+}
+
+void FramePacer::Wait() {
+    Clock::time_point start = Clock::now();
+    if (period.count() > 0) {
+        deadline += period;
+        Clock::time_point now = Clock::now();
+        if (now < deadline) {
+            SleepUntil(deadline);
+        } else if (now - deadline > period) {
+            // More than a frame behind; start a fresh schedule instead of rushing to catch up
+            deadline = now;
+        }
+    }
+
+    Clock::time_point now = Clock::now();
+    lastWait = std::chrono::duration<float>(now - start).count();
+    RecordInterval(std::chrono::duration<float, std::milli>(now - lastFrame).count());
+    lastFrame = now;
+}
+
+void FramePacer::SleepUntil(Clock::time_point target) {
+    // Sleep while there's comfortably more time left than a sleep is likely to take
+    while (true) {
+        double remaining = std::chrono::duration<double>(target - Clock::now()).count();
+        if (remaining <= sleepEstimate) break;
+
+        Clock::time_point start = Clock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        double observed = std::chrono::duration<double>(Clock::now() - start).count();
+
+        double delta = observed - sleepMean;
+        sleepMean += FRAME_PACER_SLEEP_WEIGHT * delta;
+        sleepVariance = (1.0 - FRAME_PACER_SLEEP_WEIGHT) * (sleepVariance + FRAME_PACER_SLEEP_WEIGHT * delta * delta);
+        sleepEstimate = sleepMean + std::sqrt(sleepVariance);
+    }
+
+    // Spin out the rest
+    while (Clock::now() < target) {
+        std::this_thread::yield();
+    }
+}
+
+void FramePacer::RecordInterval(float intervalMs) {
+    intervals[nextSample] = intervalMs;
+    nextSample = (nextSample + 1) % intervals.size();
+    sampleCount = std::min(sampleCount + 1, intervals.size());
+}
+
+float FramePacer::GetAverageInterval() const {
+    if (sampleCount == 0) return 0.0f;
+    float total = 0.0f;
+    for (size_t i = 0; i < sampleCount; i++) {
+        total += intervals[i];
+    }
+    return total / sampleCount;
+}
+
+float FramePacer::GetJitterPercentile(float percentile) const {
+    if (sampleCount == 0) return 0.0f;
+
+    float expected = period.count() > 0
+        ? std::chrono::duration<float, std::milli>(period).count()
+        : GetAverageInterval();
+
+    scratch.resize(sampleCount);
+    for (size_t i = 0; i < sampleCount; i++) {
+        scratch[i] = std::abs(intervals[i] - expected);
+    }
+
+    size_t index = static_cast<size_t>(std::clamp(percentile, 0.0f, 1.0f) * (sampleCount - 1));
+    std::nth_element(scratch.begin(), scratch.begin() + index, scratch.end());
+    return scratch[index];
+}
@@ -0,0 +1,58 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+#include "../utils/config/Config.h"
+
+// Holds the main loop to an even frame rate.
+//
+// OS sleeps are only accurate to a millisecond or worse, so Wait() sleeps in short steps
+// while there is clearly more time left than a sleep tends to overshoot by, then spins
+// for the remainder. The overshoot estimate is learned from the sleeps themselves, which
+// copes with coarse timers without tuning. Deadlines advance by whole periods, so one
+// late frame doesn't shift every frame after it.
+class FramePacer {
+public:
+    FramePacer();
+
+    // Frames per second to hold, 0 = uncapped
+    void SetTargetRate(int framesPerSecond);
+    int GetTargetRate() const { return targetRate; }
+
+    // Blocks until the next frame is due and records the interval since the last one
+    void Wait();
+    float GetLastWait() const { return lastWait; }   // Seconds the last Wait() held the frame
+
+    // Deviation of frame intervals from the target in ms (from the mean interval when
+    // uncapped), at the given percentile of the recent window
+    float GetJitterPercentile(float percentile) const;
+    float GetAverageInterval() const;   // ms
+    size_t GetSampleCount() const { return sampleCount; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void SleepUntil(Clock::time_point deadline);
+    void RecordInterval(float intervalMs);
+
+    int targetRate = 0;
+    Clock::duration period{0};
+    Clock::time_point deadline;
+    Clock::time_point lastFrame;
+    float lastWait = 0.f;
+
+    // Exponentially weighted mean and variance of how long a 1 ms sleep really takes, so
+    // the estimate follows the timer if it changes and never drifts on a long session
+    double sleepEstimate = 0.005;
+    double sleepMean = 0.005;
+    double sleepVariance = 0.0;
+
+    std::vector<float> intervals;   // Ring buffer of frame intervals in ms
+    size_t nextSample = 0;
+    size_t sampleCount = 0;
+    mutable std::vector<float> scratch;
+};
+
+#endif // FRAME_PACER_H
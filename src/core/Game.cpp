@@ -5,14 +5,26 @@
 #include "../states/menu/SettingsState.h"
 #include "../states/PlayingState.h"
 #include "../states/menu/LobbyState.h"
+#include "QualityGovernor.h"
+#include "../network/SessionContext.h"
+#include "../entities/player/Player.h"
+#include "Profiler.h"
+#include "TraceRecorder.h"
+#include "FlightRecorder.h"
+#include "Logger.h"
 #include <steam/steam_api.h>
 #include <iostream>
+#include <algorithm>
+#include <cmath>
 
 
 
-Game::Game() : hud(font) {
+Game::Game() : hud(font), profilerOverlay(font) {
+    // Zones are recorded on the thread that runs the main loop
+    Profiler::Get().SetOwnerThread();
+    TraceRecorder::Get().SetThreadName("Main");
+
     window.create(sf::VideoMode(BASE_WIDTH, BASE_HEIGHT), "SteamGame");
-    window.setFramerateLimit(60);
 
     if (!font.loadFromFile("Roboto-Regular.ttf")) {
         if (!font.loadFromFile("../../Roboto-Regular.ttf")) {
@@ -24,6 +36,7 @@ Game::Game() : hud(font) {
     if (SteamAPI_Init()) {
         steamInitialized = true;
         localSteamID = SteamUser()->GetSteamID();
+        SessionContext::Get().SetLocalID(localSteamID);
     } else {
         std::cerr << "[ERROR] Steam API initialization failed!" << std::endl;
     }
@@ -33,6 +46,8 @@ Game::Game() : hud(font) {
 
     settingsManager = std::make_shared<SettingsManager>();
     inputHandler = std::make_shared<InputHandler>(settingsManager);
+    SetTickRate(settingsManager->GetSettings().tickRate);
+    ApplyDisplaySettings();
 
     // Initialize camera for game world
        
@@ -55,23 +70,58 @@ Game::~Game() {
 void Game::Run() {
     sf::Clock clock;
     window.setKeyRepeatEnabled(false);
+    renderThread.Start();
+    if (TRACE_AUTO_START) {
+        TraceRecorder::Get().Start();
+    }
+    FlightRecorder::Get().Start();
     while (window.isOpen()) {
         if (steamInitialized) {
+            PROFILE_SCOPE("Steam callbacks");
             SteamAPI_RunCallbacks();
         }
 
         networkManager->ReceiveMessages();
 
         deltaTime = clock.restart().asSeconds();
+
+        // Judge the work, not the frame cap: leave out the waits for the pacer and the render
+        // thread, but count the render thread's replay when it is the slower stage
+        float workTime = deltaTime - framePacer.GetLastWait() - renderThread.GetLastPickupWait();
+        QualityGovernor::Get().RecordFrame(deltaTime, std::max(workTime, renderThread.GetLastReplayTime()));
+        ReportPacing();
        
-        sf::Event event;
-        while (window.pollEvent(event)) {
-            inputHandler->ProcessEvent(event);
-            ProcessEvents(event);
-            if (state) state->ProcessEvent(event);
+        {
+            PROFILE_SCOPE("Events");
+            sf::Event event;
+            while (window.pollEvent(event)) {
+                inputHandler->ProcessEvent(event);
+                ProcessEvents(event);
+                if (state) state->ProcessEvent(event);
+            }
         }
 
-        if (state) state->Update(deltaTime);
+        // Run the simulation in fixed ticks so results don't depend on frame rate
+        accumulator += std::min(deltaTime, MAX_FRAME_TIME);
+        GameState tickState = currentState;
+        int steps = 0;
+        {
+            PROFILE_SCOPE("Simulation");
+            while (accumulator >= fixedTimestep && steps < MAX_SIMULATION_STEPS) {
+                if (state) state->Update(fixedTimestep);
+                accumulator -= fixedTimestep;
+                steps++;
+                
+                // Stop ticking a state that has asked to be replaced
+                if (currentState != tickState) break;
+            }
+        }
+        
+        // Drop whole ticks we couldn't catch up on instead of spiralling
+        if (accumulator >= fixedTimestep) {
+            accumulator = std::fmod(accumulator, fixedTimestep);
+        }
+        renderAlpha = accumulator / fixedTimestep;
 
         // Only create a new state if we don't have that state already
         bool stateChanged = false;
@@ -121,12 +171,113 @@ void Game::Run() {
             std::cout << "[INFO] Switched to state: " << static_cast<int>(currentState) << std::endl;
         }
 
-        // Let the state handle rendering
-        if (state) state->Render();
+        // Record this frame and hand it to the render thread, which draws it while
+        // the next frame is simulated
+        {
+            PROFILE_SCOPE("Record");
+            RenderSnapshot& frame = renderThread.BeginFrame();
+            if (state) state->Render(frame);
+            profilerOverlay.Update(deltaTime);
+            profilerOverlay.Render(frame, uiView);
+        }
+        
+        // Hold the frame until it is due so frames go out evenly spaced
+        {
+            PROFILE_SCOPE("Pace");
+            framePacer.Wait();
+        }
+        {
+            PROFILE_SCOPE("Present");
+            renderThread.Publish();
+            renderThread.WaitForPickup();
+        }
+        PROFILE_FRAME_END();
+        RecordFlightFrame(steps);
+        ReportAllocations();
     }
+    FlightRecorder::Get().Stop();
+    renderThread.Stop();
+    TraceRecorder::Get().Stop();
+}
+
+void Game::RecordFlightFrame(int simulationTicks) {
+    size_t enemies = 0;
+    if (auto playing = dynamic_cast<PlayingState*>(state.get())) {
+        if (playing->GetEnemyManager()) enemies = playing->GetEnemyManager()->GetEnemyCount();
+    }
+    FlightRecorder::Get().RecordFrame(simulationTicks, enemies, SessionContext::Get().GetPeers().size() + 1);
+}
+
+void Game::ReportPacing() {
+    pacingReportTimer += deltaTime;
+    if (FRAME_PACER_REPORT_INTERVAL <= 0.f || pacingReportTimer < FRAME_PACER_REPORT_INTERVAL) return;
+    pacingReportTimer = 0.f;
+    
+    std::cout << "[PACER] " << framePacer.GetAverageInterval() << " ms average frame, p"
+              << static_cast<int>(FRAME_PACER_PERCENTILE * 100) << " jitter "
+              << framePacer.GetJitterPercentile(FRAME_PACER_PERCENTILE) << " ms over "
+              << framePacer.GetSampleCount() << " frames\n";
+}
+
+void Game::ReportAllocations() {
+#if ALLOCATION_TRACKING
+    allocationReportTimer += deltaTime;
+    if (ALLOCATION_REPORT_INTERVAL <= 0.f || allocationReportTimer < ALLOCATION_REPORT_INTERVAL) return;
+    allocationReportTimer = 0.f;
+
+    Profiler& profiler = Profiler::Get();
+    profiler.GetZoneStats(allocationStats);
+    const Profiler::ZoneStats& frame = allocationStats.front();
+    LOG_INFO("ALLOC", "{} allocations ({} KB) per frame on the main thread, {} on other threads last frame",
+             frame.allocations, frame.allocatedKB, profiler.GetOtherThreadAllocations());
+
+    for (const Profiler::ZoneStats& zone : allocationStats) {
+        if (!zone.overBudget) continue;
+        if (zone.depth == 0) {
+            LOG_INFO("ALLOC", "Frame over budget: {} per frame, budget {}", zone.allocations, ALLOCATION_FRAME_BUDGET);
+        } else {
+            LOG_INFO("ALLOC", "{} over budget: {} of its own per frame ({} KB with children), budget {}",
+                     zone.name, zone.ownAllocations, zone.allocatedKB, ALLOCATION_ZONE_BUDGET);
+        }
+    }
+#endif
+}
+
+void Game::ApplyDisplaySettings() {
+    const GameSettings& settings = settingsManager->GetSettings();
+    int frameRate = std::min(std::max(settings.frameRateLimit, 0), FRAME_RATE_MAX);
+    if (frameRate != framePacer.GetTargetRate()) {
+        framePacer.SetTargetRate(frameRate);
+    }
+    QualityGovernor::Get().SetTargetFrameTime(frameRate > 0 ? 1.f / frameRate : QUALITY_TARGET_FRAME_TIME);
+    renderThread.SetVerticalSync(settings.vsync);
+}
+
+void Game::SetTickRate(int ticksPerSecond) {
+    // Only the rates the simulation has been tuned for
+    if (ticksPerSecond != 60 && ticksPerSecond != 120) {
+        std::cout << "[GAME] Unsupported tick rate " << ticksPerSecond << ", using " << SIMULATION_TICK_RATE << " Hz\n";
+        ticksPerSecond = SIMULATION_TICK_RATE;
+    }
+    tickRate = ticksPerSecond;
+    fixedTimestep = 1.f / ticksPerSecond;
+    accumulator = 0.f;
+    std::cout << "[GAME] Simulation running at " << ticksPerSecond << " Hz\n";
 }
 
 // In Game.cpp - modify the SetCurrentState method:
+uint8_t Game::SampleLocalMovement() {
+    return Player::SampleMovementInput(inputManager);
+}
+
+bool Game::SendMessage(CSteamID target, const std::string& msg) {
+    return networkManager->SendMessage(target, msg);
+}
+
+bool Game::BroadcastMessage(const std::string& msg) {
+    return networkManager->BroadcastMessage(msg);
+}
+
 void Game::SetCurrentState(GameState newState) {
     // Don't do anything if we're already in the requested state
     if (currentState == newState) {
@@ -180,6 +331,7 @@ void Game::SetCurrentState(GameState newState) {
 // In Game.cpp - modify the ProcessEvents method to handle mouse wheel events
 void Game::ProcessEvents(sf::Event& event) {
     if (event.type == sf::Event::Closed) {
+        renderThread.Stop();
         window.close();
     }
     if (event.type == sf::Event::Resized) {
@@ -191,14 +343,29 @@ void Game::ProcessEvents(sf::Event& event) {
             static bool isFullscreen = false;
             isFullscreen = !isFullscreen;
             
+            // The context is recreated with the window, so take it back from the render thread
+            renderThread.Stop();
             if (isFullscreen) {
                 window.create(sf::VideoMode::getDesktopMode(), "SteamGame", sf::Style::Fullscreen);
             } else {
                 window.create(sf::VideoMode(BASE_WIDTH, BASE_HEIGHT), "SteamGame");
             }
             
-            window.setFramerateLimit(60);
+            ApplyDisplaySettings();
             AdjustViewToWindow();
+            renderThread.Start();
+        }
+#if PROFILING_ENABLED
+        if (event.key.code == PROFILER_OVERLAY_KEY) {
+            profilerOverlay.Toggle();
+        }
+#endif
+        if (event.key.code == TRACE_TOGGLE_KEY) {
+            if (TraceRecorder::Get().IsRecording()) {
+                TraceRecorder::Get().Stop();
+            } else {
+                TraceRecorder::Get().Start();
+            }
         }
     }
     if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::R) {
@@ -3,26 +3,31 @@
 
 #include <SFML/Graphics.hpp>
 #include "../ui/hud/Hud.h"
+#include "../ui/ProfilerOverlay.h"
 #include "../network/NetworkManager.h"
 #include "../utils/config/SettingsManager.h"  
 #include "../utils/input/InputHandler.h" 
 #include "../utils/input/InputManager.h"  
 #include "../utils/config/Config.h"
 #include "GameState.h"
+#include "JobSystem.h"
+#include "SimulationContext.h"
+#include "FramePacer.h"
+#include "../render/RenderThread.h"
 #include <memory>
 #include <steam/steam_api.h>
 
 class State;
 class NetworkManager;
 
-class Game {
+class Game : public SimulationContext {
 public:
     Game();
     ~Game();
 
     void Run();
     void SetCurrentState(GameState state);
-    GameState GetCurrentState() const { return currentState; }
+    GameState GetCurrentState() const override { return currentState; }
     sf::RenderWindow& GetWindow() { return window; }
     HUD& GetHUD() { return hud; }
     NetworkManager& GetNetworkManager() { return *networkManager; }
@@ -35,15 +40,31 @@ public:
     void SetLocalSteamID(const CSteamID& id) { localSteamID = id; }
     CSteamID GetLocalSteamID() const { return localSteamID; }
     CSteamID GetLobbyID() const { return networkManager->GetCurrentLobbyID(); }
-    sf::Font& GetFont() { return font; }
+    sf::Font& GetFont() override { return font; }
     sf::View& GetCamera() { return camera; }  // Access to game world camera
     sf::View& GetUIView(); // Access to the UI view
     sf::Vector2f GetUIScale() const; // Get UI scaling factors
     sf::Vector2f WindowToUICoordinates(sf::Vector2i windowPos) const; // Convert window to UI coordinates
     State* GetState() { return state.get(); }
     float GetDeltaTime() const { return deltaTime; }
+    
+    // Fixed-timestep simulation
+    float GetFixedTimestep() const override { return fixedTimestep; }
+    float GetRenderAlpha() const { return renderAlpha; } // Fraction of a tick between the last two sim states
+    void SetTickRate(int ticksPerSecond);
+    int GetTickRate() const { return tickRate; }
+    
+    // Frame cap and vsync from the settings
+    void ApplyDisplaySettings();
+    const FramePacer& GetFramePacer() const { return framePacer; }
         
     InputManager& GetInputManager() { return inputManager; }
+    JobSystem& GetJobSystem() override { return jobSystem; }
+    
+    // SimulationContext: keyboard movement and Steam networking
+    uint8_t SampleLocalMovement() override;
+    bool SendMessage(CSteamID target, const std::string& msg) override;
+    bool BroadcastMessage(const std::string& msg) override;
     bool IsInLobby() const { return inLobby; }
     void SetInLobby(bool status) { 
         inLobby = status; 
@@ -57,12 +78,26 @@ private:
     void HandleZoom(float delta);
     void ProcessEvents(sf::Event& event);
     void AdjustViewToWindow();
+    void ReportPacing();
+    void ReportAllocations();   // Per-frame totals and zones over budget, with ALLOCATION_TRACKING
+    void RecordFlightFrame(int simulationTicks);
     float deltaTime = 0.f;
+    int tickRate = SIMULATION_TICK_RATE;
+    float fixedTimestep = 1.f / SIMULATION_TICK_RATE;
+    float accumulator = 0.f;
+    float renderAlpha = 1.f;
+    FramePacer framePacer;
+    float pacingReportTimer = 0.f;
+    float allocationReportTimer = 0.f;
+    std::vector<Profiler::ZoneStats> allocationStats;
     sf::RenderWindow window;
+    RenderThread renderThread{window};   // Draws published frames; declared after window so it stops first
     sf::Font font;
     sf::View camera;  // Camera for game world
     sf::View uiView;  // View for UI elements
     HUD hud;
+    ProfilerOverlay profilerOverlay;   // Toggled with PROFILER_OVERLAY_KEY
+    JobSystem jobSystem;           // Worker pool for parallel simulation work
     std::unique_ptr<State> state;
     std::unique_ptr<NetworkManager> networkManager;
     std::shared_ptr<SettingsManager> settingsManager;
@@ -0,0 +1,199 @@
+#include "JobSystem.h"
+#include "TraceRecorder.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    // Queue owned by the current thread; 0 for any thread outside the pool
+    thread_local unsigned currentQueue = 0;
+}
+
+TaskGraph::TaskId TaskGraph::Add(std::function<void()> job, std::initializer_list<TaskId> dependencies) {
+    if (nodeCount == nodes.size()) {
+        nodes.push_back(std::unique_ptr<Node>(new Node()));
+    }
+
+    TaskId id = nodeCount++;
+    Node& node = *nodes[id];
+    node.job = std::move(job);
+    node.successors.clear();
+    node.dependencyCount = 0;
+
+    for (TaskId dependency : dependencies) {
+        if (dependency >= id) continue;   // Only earlier tasks, which keeps the graph acyclic
+        nodes[dependency]->successors.push_back(id);
+        node.dependencyCount++;
+    }
+    return id;
+}
+
+JobSystem::JobSystem(int workerThreads) {
+    Start(workerThreads);
+}
+
+JobSystem::~JobSystem() {
+    Stop();
+}
+
+void JobSystem::SetWorkerThreads(int workerThreads) {
+    Stop();
+    Start(workerThreads);
+}
+
+void JobSystem::Start(int workerThreads) {
+    unsigned count = 0;
+    if (workerThreads < 0) {
+        unsigned cores = std::thread::hardware_concurrency();
+        count = cores > 1 ? cores - 1 : 0;
+    } else {
+        count = static_cast<unsigned>(workerThreads);
+    }
+
+    stopping = false;
+    queues.clear();
+    for (unsigned i = 0; i <= count; i++) {
+        queues.push_back(std::unique_ptr<Queue>(new Queue()));
+    }
+    for (unsigned i = 1; i <= count; i++) {
+        workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+
+    std::cout << "[JOBS] Started " << count << " worker threads\n";
+}
+
+void JobSystem::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+void JobSystem::Submit(Job job) {
+    Queue& queue = *queues[currentQueue];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+    queuedJobs.fetch_add(1);
+
+    // Taking the lock orders this against a worker checking queuedJobs before sleeping
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    wake.notify_one();
+}
+
+bool JobSystem::TryRunOne() {
+    Job job;
+    bool found = false;
+
+    // Own queue first, newest job (still warm in cache)
+    {
+        Queue& own = *queues[currentQueue];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            found = true;
+        }
+    }
+
+    // Then steal the oldest job from someone else
+    for (size_t offset = 1; !found && offset < queues.size(); offset++) {
+        Queue& victim = *queues[(currentQueue + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found) return false;
+
+    queuedJobs.fetch_sub(1);
+    job.work();
+    job.pending->fetch_sub(1);
+    return true;
+}
+
+void JobSystem::WaitFor(std::atomic<size_t>& pending) {
+    // Help out instead of blocking; whatever we run may be what we are waiting on
+    while (pending.load() > 0) {
+        if (!TryRunOne()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::WorkerLoop(unsigned index) {
+    currentQueue = index;
+    TraceRecorder::Get().SetThreadName("Job worker " + std::to_string(index));
+    while (true) {
+        if (TryRunOne()) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [this] { return stopping || queuedJobs.load() > 0; });
+        if (stopping) return;
+    }
+}
+
+void JobSystem::ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& body) {
+    if (count == 0) return;
+    grainSize = std::max<size_t>(grainSize, 1);
+    size_t blocks = (count + grainSize - 1) / grainSize;
+
+    if (blocks == 1 || workers.empty()) {
+        for (size_t block = 0; block < blocks; block++) {
+            body(block * grainSize, std::min(count, (block + 1) * grainSize));
+        }
+        return;
+    }
+
+    // Queue every block but the first, which this thread runs straight away
+    std::atomic<size_t> pending(blocks - 1);
+    for (size_t block = 1; block < blocks; block++) {
+        size_t begin = block * grainSize;
+        size_t end = std::min(count, begin + grainSize);
+        Submit(Job{[&body, begin, end] { body(begin, end); }, &pending});
+    }
+    body(0, std::min(count, grainSize));
+    WaitFor(pending);
+}
+
+void JobSystem::RunGraphNode(TaskGraph& graph, TaskGraph::TaskId id, std::atomic<size_t>& pending) {
+    TaskGraph::Node& node = *graph.nodes[id];
+    node.job();
+
+    // Release successors whose last dependency this was
+    for (TaskGraph::TaskId successor : node.successors) {
+        if (graph.nodes[successor]->remaining.fetch_sub(1) == 1) {
+            pending.fetch_add(1);
+            Submit(Job{[this, &graph, successor, &pending] { RunGraphNode(graph, successor, pending); }, &pending});
+        }
+    }
+}
+
+void JobSystem::Run(TaskGraph& graph) {
+    if (graph.Size() == 0) return;
+
+    // pending counts submitted-but-unfinished jobs; a node submits its successors before
+    // its own job is counted done, so it can't reach zero while work is still to come
+    std::atomic<size_t> pending(0);
+    for (size_t i = 0; i < graph.Size(); i++) {
+        TaskGraph::Node& node = *graph.nodes[i];
+        node.remaining.store(node.dependencyCount);
+    }
+    for (size_t i = 0; i < graph.Size(); i++) {
+        if (graph.nodes[i]->dependencyCount == 0) {
+            pending.fetch_add(1);
+            Submit(Job{[this, &graph, i, &pending] { RunGraphNode(graph, i, pending); }, &pending});
+        }
+    }
+    WaitFor(pending);
+}
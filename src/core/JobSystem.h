@@ -0,0 +1,95 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../utils/config/Config.h"
+
+class JobSystem;
+
+// A small dependency graph of jobs, run in one go by JobSystem::Run.
+//
+// Dependencies can only name tasks added earlier, so a graph is acyclic by
+// construction. A graph can be cleared and rebuilt every tick; node storage is kept.
+class TaskGraph {
+public:
+    using TaskId = size_t;
+
+    TaskId Add(std::function<void()> job, std::initializer_list<TaskId> dependencies = {});
+    void Clear() { nodeCount = 0; }
+    size_t Size() const { return nodeCount; }
+
+private:
+    friend class JobSystem;
+
+    struct Node {
+        std::function<void()> job;
+        std::vector<TaskId> successors;
+        int dependencyCount = 0;
+        std::atomic<int> remaining{0};
+    };
+
+    std::vector<std::unique_ptr<Node>> nodes;   // Nodes hold atomics, so they stay put
+    size_t nodeCount = 0;
+};
+
+// Work-stealing thread pool owned by Game.
+//
+// Every worker owns a deque: it pushes and pops its own jobs at the back and steals
+// from the front of the others when it runs dry. Threads outside the pool share
+// queue 0. A thread that waits on a ParallelFor or graph keeps running queued jobs
+// instead of blocking, so parallel work can be nested inside a job.
+class JobSystem {
+public:
+    explicit JobSystem(int workerThreads = JOB_WORKER_THREADS);
+    ~JobSystem();
+
+    // Restarts the pool with this many helper threads on top of the calling thread (-1 = auto)
+    void SetWorkerThreads(int workerThreads);
+    unsigned GetThreadCount() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+    // Calls body(begin, end) over [0, count) in blocks of grainSize and returns once all
+    // are done. Block k always covers [k * grainSize, (k + 1) * grainSize), whatever the
+    // thread count, so per-block output merged in block order is deterministic.
+    void ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& body);
+
+    // Runs every task in the graph, respecting dependencies, and returns when all are done
+    void Run(TaskGraph& graph);
+
+private:
+    struct Job {
+        std::function<void()> work;
+        std::atomic<size_t>* pending;   // Decremented once the work has run
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    void Start(int workerThreads);
+    void Stop();
+    void Submit(Job job);
+    bool TryRunOne();
+    void WaitFor(std::atomic<size_t>& pending);
+    void WorkerLoop(unsigned index);
+    void RunGraphNode(TaskGraph& graph, TaskGraph::TaskId id, std::atomic<size_t>& pending);
+
+    std::vector<std::unique_ptr<Queue>> queues;   // queues[0] belongs to threads outside the pool
+    std::vector<std::thread> workers;
+
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    std::atomic<size_t> queuedJobs{0};
+    bool stopping = false;
+};
+
+#endif // JOB_SYSTEM_H
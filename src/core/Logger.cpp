@@ -0,0 +1,174 @@
+#include "Logger.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+Logger& Logger::Get() {
+    static Logger instance;
+    return instance;
+}
+
+Logger::Logger()
+    : slots(LOG_RING_SIZE)
+{
+    static_assert((LOG_RING_SIZE & (LOG_RING_SIZE - 1)) == 0, "LOG_RING_SIZE must be a power of two");
+
+    // A slot is free for the producer whose position matches its sequence
+    for (size_t i = 0; i < slots.size(); i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    writer = std::thread(&Logger::WriterLoop, this);
+}
+
+Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        stopping = true;
+    }
+    writerWake.notify_one();
+    writer.join();
+    Flush();
+}
+
+void Logger::CaptureText(Record& record, Arg& arg, std::string_view text) {
+    size_t length = std::min(text.size(), TEXT_BYTES - record.textUsed);
+    std::memcpy(record.text + record.textUsed, text.data(), length);
+    arg.type = ArgType::Text;
+    arg.text.offset = static_cast<uint16_t>(record.textUsed);
+    arg.text.length = static_cast<uint16_t>(length);
+    record.textUsed += length;
+}
+
+bool Logger::Admit(LogSite& site, uint32_t& suppressed) {
+    int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    // Whoever notices the window has run out starts the next one
+    int64_t start = site.windowStart.load(std::memory_order_relaxed);
+    if (nowMs - start >= LOG_RATE_WINDOW_MS &&
+        site.windowStart.compare_exchange_strong(start, nowMs, std::memory_order_relaxed)) {
+        site.windowCount.store(0, std::memory_order_relaxed);
+    }
+
+    if (site.windowCount.fetch_add(1, std::memory_order_relaxed) >= LOG_RATE_LIMIT) {
+        site.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    suppressed = site.suppressed.exchange(0, std::memory_order_relaxed);
+    return true;
+}
+
+void Logger::Push(const Record& record) {
+    // Bounded multi-producer queue: claim a position, fill its slot, then publish it
+    size_t position = head.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+        slot = &slots[position & (slots.size() - 1)];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (difference == 0) {
+            if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        } else if (difference < 0) {
+            // The writer hasn't caught up with a full lap; losing a line beats blocking a frame
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            position = head.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->record = record;
+    slot->sequence.store(position + 1, std::memory_order_release);
+}
+
+void Logger::Flush() {
+    Drain();
+}
+
+void Logger::WriterLoop() {
+    std::unique_lock<std::mutex> lock(writerMutex);
+    while (!stopping) {
+        writerWake.wait_for(lock, std::chrono::milliseconds(LOG_FLUSH_INTERVAL_MS),
+                            [this] { return stopping; });
+        lock.unlock();
+        Drain();
+        lock.lock();
+    }
+}
+
+void Logger::Drain() {
+    std::lock_guard<std::mutex> lock(drainMutex);
+    output.clear();
+    errors.clear();
+
+    while (true) {
+        Slot& slot = slots[tail & (slots.size() - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != tail + 1) break;
+
+        Format(slot.record, slot.record.level == LogLevel::Error ? errors : output);
+        slot.sequence.store(tail + slots.size(), std::memory_order_release);
+        tail++;
+    }
+
+    uint64_t lost = dropped.exchange(0, std::memory_order_relaxed);
+    if (lost > 0) {
+        output += "[LOG] " + std::to_string(lost) + " messages dropped, the log ring was full\n";
+    }
+
+    // One write and one flush per batch, however many lines it holds
+    if (!output.empty()) {
+        std::cout << output;
+        std::cout.flush();
+    }
+    if (!errors.empty()) {
+        std::cerr << errors;
+    }
+}
+
+void Logger::Format(const Record& record, std::string& out) const {
+    out += '[';
+    out += record.tag;
+    out += "] ";
+
+    char number[64];
+    int next = 0;
+    for (const char* c = record.format; *c; c++) {
+        if (c[0] != '{' || c[1] != '}' || next >= record.argCount) {
+            out += *c;
+            continue;
+        }
+        c++;
+
+        const Arg& arg = record.args[next++];
+        switch (arg.type) {
+            case ArgType::Int:
+                std::snprintf(number, sizeof(number), "%lld", static_cast<long long>(arg.i));
+                out += number;
+                break;
+            case ArgType::UInt:
+                std::snprintf(number, sizeof(number), "%llu", static_cast<unsigned long long>(arg.u));
+                out += number;
+                break;
+            case ArgType::Double:
+                std::snprintf(number, sizeof(number), "%g", arg.d);
+                out += number;
+                break;
+            case ArgType::Bool:
+                out += arg.b ? "true" : "false";
+                break;
+            case ArgType::Text:
+                out.append(record.text + arg.text.offset, arg.text.length);
+                break;
+            case ArgType::Vector:
+                std::snprintf(number, sizeof(number), "(%g, %g)", arg.v[0], arg.v[1]);
+                out += number;
+                break;
+        }
+    }
+
+    if (record.suppressed > 0) {
+        out += " (" + std::to_string(record.suppressed) + " more suppressed)";
+    }
+    out += '\n';
+}
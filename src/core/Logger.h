@@ -0,0 +1,180 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <SFML/System/Vector2.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "../utils/config/Config.h"
+
+enum class LogLevel : uint8_t {
+    Trace = LOG_LEVEL_TRACE,
+    Debug = LOG_LEVEL_DEBUG,
+    Info = LOG_LEVEL_INFO,
+    Warning = LOG_LEVEL_WARNING,
+    Error = LOG_LEVEL_ERROR
+};
+
+// Rate limit state for one LOG_* call site; the macros make one per site
+struct LogSite {
+    std::atomic<int64_t> windowStart{0};   // ms
+    std::atomic<uint32_t> windowCount{0};
+    std::atomic<uint32_t> suppressed{0};
+};
+
+// Asynchronous logger for code that runs every frame or every message.
+//
+//   LOG_DEBUG("CLIENT", "Added enemy {} at {}", enemyId, position);
+//
+// The calling thread only copies the format pointer and the arguments into a slot of a
+// lock-free ring; a writer thread substitutes the {} placeholders and prints "[TAG] ..."
+// to std::cout (std::cerr for errors) every LOG_FLUSH_INTERVAL_MS. Each call site may log
+// LOG_RATE_LIMIT messages per LOG_RATE_WINDOW_MS; the rest are counted and the count is
+// added to the next message that gets through. Formats and tags must be string literals.
+class Logger {
+public:
+    static Logger& Get();
+
+    template <typename... Args>
+    void Write(LogSite& site, LogLevel level, const char* tag, const char* format, const Args&... args) {
+        static_assert(sizeof...(Args) <= MAX_ARGS, "Too many log arguments");
+        uint32_t suppressed = 0;
+        if (!Admit(site, suppressed)) return;
+
+        Record record;
+        record.level = level;
+        record.tag = tag;
+        record.format = format;
+        record.suppressed = suppressed;
+        (Capture(record, args), ...);
+        Push(record);
+    }
+
+    // Prints everything logged so far before returning
+    void Flush();
+
+private:
+    Logger();
+    ~Logger();
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    static const int MAX_ARGS = 8;
+    static const size_t TEXT_BYTES = 128;   // Room for copied string arguments per message
+
+    enum class ArgType : uint8_t { Int, UInt, Double, Bool, Text, Vector };
+
+    struct Arg {
+        ArgType type;
+        union {
+            int64_t i;
+            uint64_t u;
+            double d;
+            bool b;
+            float v[2];
+            struct { uint16_t offset; uint16_t length; } text;
+        };
+    };
+
+    struct Record {
+        LogLevel level;
+        const char* tag;
+        const char* format;
+        uint32_t suppressed = 0;
+        int argCount = 0;
+        Arg args[MAX_ARGS];
+        size_t textUsed = 0;
+        char text[TEXT_BYTES];
+    };
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        Record record;
+    };
+
+    template <typename T>
+    static void Capture(Record& record, const T& value) {
+        Arg& arg = record.args[record.argCount++];
+        if constexpr (std::is_same<T, bool>::value) {
+            arg.type = ArgType::Bool;
+            arg.b = value;
+        } else if constexpr (std::is_enum<T>::value) {
+            arg.type = ArgType::Int;
+            arg.i = static_cast<int64_t>(value);
+        } else if constexpr (std::is_integral<T>::value && std::is_signed<T>::value) {
+            arg.type = ArgType::Int;
+            arg.i = value;
+        } else if constexpr (std::is_integral<T>::value) {
+            arg.type = ArgType::UInt;
+            arg.u = value;
+        } else if constexpr (std::is_floating_point<T>::value) {
+            arg.type = ArgType::Double;
+            arg.d = value;
+        } else if constexpr (std::is_same<T, sf::Vector2f>::value) {
+            arg.type = ArgType::Vector;
+            arg.v[0] = value.x;
+            arg.v[1] = value.y;
+        } else {
+            // Anything string-like is copied, it may be gone by the time the writer runs
+            CaptureText(record, arg, std::string_view(value));
+        }
+    }
+    static void CaptureText(Record& record, Arg& arg, std::string_view text);
+
+    bool Admit(LogSite& site, uint32_t& suppressed);
+    void Push(const Record& record);
+    void WriterLoop();
+    void Drain();
+    void Format(const Record& record, std::string& out) const;
+
+    std::vector<Slot> slots;
+    std::atomic<size_t> head{0};          // Next slot to claim, shared by all producers
+    size_t tail = 0;                      // Next slot to print, under drainMutex
+    std::atomic<uint64_t> dropped{0};
+
+    std::mutex drainMutex;
+    std::string output;
+    std::string errors;
+
+    std::thread writer;
+    std::mutex writerMutex;
+    std::condition_variable writerWake;
+    bool stopping = false;
+};
+
+#define LOG_WRITE(level, tag, ...) \
+    do { static LogSite logSite; Logger::Get().Write(logSite, level, tag, __VA_ARGS__); } while (0)
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_TRACE
+#define LOG_TRACE(tag, ...) LOG_WRITE(LogLevel::Trace, tag, __VA_ARGS__)
+#else
+#define LOG_TRACE(tag, ...) ((void)0)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(tag, ...) LOG_WRITE(LogLevel::Debug, tag, __VA_ARGS__)
+#else
+#define LOG_DEBUG(tag, ...) ((void)0)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO(tag, ...) LOG_WRITE(LogLevel::Info, tag, __VA_ARGS__)
+#else
+#define LOG_INFO(tag, ...) ((void)0)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_WARNING
+#define LOG_WARNING(tag, ...) LOG_WRITE(LogLevel::Warning, tag, __VA_ARGS__)
+#else
+#define LOG_WARNING(tag, ...) ((void)0)
+#endif
+
+#define LOG_ERROR(tag, ...) LOG_WRITE(LogLevel::Error, tag, __VA_ARGS__)
+
+#endif // LOGGER_H
@@ -0,0 +1,318 @@
+#include "ParticleSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PARTICLE_SIMD_SSE2 1
+#endif
+
+namespace {
+    constexpr float PARTICLE_TWO_PI = 6.2831853f;
+    constexpr float PARTICLE_DEG_TO_RAD = 0.01745329f;
+    
+    // SIMD loops run in blocks of four, so arrays are padded to a multiple of 4
+    constexpr size_t PaddedCapacity() { return (PARTICLE_POOL_CAPACITY + 3) & ~static_cast<size_t>(3); }
+    
+    thread_local std::vector<ParticleDesc>* captureBuffer = nullptr;
+    thread_local std::minstd_rand randomEngine;
+    
+    float RandomRange(float minValue, float maxValue) {
+        return minValue + (maxValue - minValue) * (static_cast<float>(ParticleSystem::Rand()) / RAND_MAX);
+    }
+    
+    // Neighbouring seeds (chunk 0, 1, 2...) would start minstd on correlated values
+    uint32_t MixSeed(uint64_t seed) {
+        seed += 0x9E3779B97F4A7C15ULL;
+        seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBULL;
+        return static_cast<uint32_t>(seed ^ (seed >> 31));
+    }
+}
+
+ParticleSystem& ParticleSystem::Get() {
+    static ParticleSystem instance;
+    return instance;
+}
+
+ParticleSystem::ParticleSystem()
+    : count(0),
+      budget(PARTICLE_DEFAULT_BUDGET),
+      droppedCount(0) {
+    const size_t capacity = PaddedCapacity();
+    posX.resize(capacity, 0.0f);
+    posY.resize(capacity, 0.0f);
+    velX.resize(capacity, 0.0f);
+    velY.resize(capacity, 0.0f);
+    life.resize(capacity, 0.0f);
+    invMaxLife.resize(capacity, 0.0f);
+    baseSize.resize(capacity, 0.0f);
+    size.resize(capacity, 0.0f);
+    shrink.resize(capacity, 0.0f);
+    alpha.resize(capacity, 0.0f);
+    rotation.resize(capacity, 0.0f);
+    colorR.resize(capacity, 0);
+    colorG.resize(capacity, 0);
+    colorB.resize(capacity, 0);
+    colorA.resize(capacity, 0);
+    sides.resize(capacity, 4);
+    
+    // Reserve vertex storage for the common case of quads, then drop the contents
+    vertices.setPrimitiveType(sf::Triangles);
+    vertices.resize(PARTICLE_DEFAULT_BUDGET * 6);
+    vertices.clear();
+    
+    // Unit polygons with the first point at the top, like sf::CircleShape
+    for (int n = 3; n <= PARTICLE_MAX_POLYGON_SIDES; n++) {
+        polygonTables[n].resize(n + 1);
+        for (int i = 0; i <= n; i++) {
+            float angle = i * PARTICLE_TWO_PI / n - PARTICLE_TWO_PI / 4.0f;
+            polygonTables[n][i] = sf::Vector2f(std::cos(angle), std::sin(angle));
+        }
+    }
+}
+
+void ParticleSystem::BindCapture(std::vector<ParticleDesc>* buffer, uint64_t seed) {
+    captureBuffer = buffer;
+    if (buffer) randomEngine.seed(MixSeed(seed));
+}
+
+int ParticleSystem::Rand() {
+    return static_cast<int>(randomEngine() % (static_cast<unsigned>(RAND_MAX) + 1u));
+}
+
+void ParticleSystem::Flush(std::vector<ParticleDesc>& buffer) {
+    for (const ParticleDesc& desc : buffer) {
+        Emit(desc);
+    }
+    buffer.clear();
+}
+
+bool ParticleSystem::Emit(const ParticleDesc& desc) {
+    if (captureBuffer) {
+        captureBuffer->push_back(desc);
+        return true;
+    }
+    
+    if (count >= budget || desc.lifetime <= 0.0f) {
+        droppedCount++;
+        return false;
+    }
+    
+    const size_t i = count++;
+    posX[i] = desc.position.x;
+    posY[i] = desc.position.y;
+    velX[i] = desc.velocity.x;
+    velY[i] = desc.velocity.y;
+    life[i] = desc.lifetime;
+    invMaxLife[i] = 1.0f / desc.lifetime;
+    baseSize[i] = desc.size;
+    size[i] = desc.size;
+    shrink[i] = desc.shrink;
+    alpha[i] = 1.0f;
+    rotation[i] = desc.rotation;
+    colorR[i] = desc.color.r;
+    colorG[i] = desc.color.g;
+    colorB[i] = desc.color.b;
+    colorA[i] = desc.color.a;
+    sides[i] = static_cast<sf::Uint8>(std::max(3, std::min(PARTICLE_MAX_POLYGON_SIDES, desc.sides)));
+    return true;
+}
+
+int ParticleSystem::EmitBurst(const sf::Vector2f& center, int particleCount, const sf::Color& color,
+                              float minSpeed, float maxSpeed, float minSize, float maxSize,
+                              float minLifetime, float maxLifetime, int colorVariation) {
+    int emitted = 0;
+    ParticleDesc desc;
+    desc.position = center;
+    
+    for (int i = 0; i < particleCount; i++) {
+        float angle = RandomRange(0.0f, PARTICLE_TWO_PI);
+        float speed = RandomRange(minSpeed, maxSpeed);
+        desc.velocity = sf::Vector2f(std::cos(angle) * speed, std::sin(angle) * speed);
+        desc.size = RandomRange(minSize, maxSize);
+        desc.lifetime = RandomRange(minLifetime, maxLifetime);
+        
+        desc.color = color;
+        if (colorVariation > 0) {
+            int shift = Rand() % (colorVariation * 2 + 1) - colorVariation;
+            desc.color.r = static_cast<sf::Uint8>(std::max(0, std::min(255, color.r + shift)));
+            desc.color.g = static_cast<sf::Uint8>(std::max(0, std::min(255, color.g + shift)));
+            desc.color.b = static_cast<sf::Uint8>(std::max(0, std::min(255, color.b + shift)));
+        }
+        
+        if (!Emit(desc)) break; // Budget exhausted, the rest would be dropped too
+        emitted++;
+    }
+    
+    return emitted;
+}
+
+void ParticleSystem::Update(float dt) {
+    if (count == 0) return;
+    
+    Integrate(dt);
+    RemoveExpired();
+}
+
+void ParticleSystem::Integrate(float dt) {
+    // Process whole blocks of four; lanes past count are padding and harmless
+    const size_t blockEnd = (count + 3) & ~static_cast<size_t>(3);
+    
+#ifdef PARTICLE_SIMD_SSE2
+    const __m128 vdt = _mm_set1_ps(dt);
+    const __m128 vzero = _mm_setzero_ps();
+    const __m128 vone = _mm_set1_ps(1.0f);
+    
+    for (size_t i = 0; i < blockEnd; i += 4) {
+        __m128 px = _mm_loadu_ps(&posX[i]);
+        __m128 py = _mm_loadu_ps(&posY[i]);
+        px = _mm_add_ps(px, _mm_mul_ps(_mm_loadu_ps(&velX[i]), vdt));
+        py = _mm_add_ps(py, _mm_mul_ps(_mm_loadu_ps(&velY[i]), vdt));
+        _mm_storeu_ps(&posX[i], px);
+        _mm_storeu_ps(&posY[i], py);
+        
+        __m128 remaining = _mm_sub_ps(_mm_loadu_ps(&life[i]), vdt);
+        _mm_storeu_ps(&life[i], remaining);
+        
+        // ratio = clamp(life / maxLife, 0, 1); alpha fades quadratically
+        __m128 ratio = _mm_min_ps(_mm_max_ps(_mm_mul_ps(remaining, _mm_loadu_ps(&invMaxLife[i])), vzero), vone);
+        _mm_storeu_ps(&alpha[i], _mm_mul_ps(ratio, ratio));
+        
+        // size = baseSize * (1 - shrink * (1 - ratio))
+        __m128 shrinkAmount = _mm_mul_ps(_mm_loadu_ps(&shrink[i]), _mm_sub_ps(vone, ratio));
+        _mm_storeu_ps(&size[i], _mm_mul_ps(_mm_loadu_ps(&baseSize[i]), _mm_sub_ps(vone, shrinkAmount)));
+    }
+#else
+    float* px = posX.data();
+    float* py = posY.data();
+    float* remaining = life.data();
+    float* outAlpha = alpha.data();
+    float* outSize = size.data();
+    const float* vx = velX.data();
+    const float* vy = velY.data();
+    const float* inv = invMaxLife.data();
+    const float* base = baseSize.data();
+    const float* shrinkFactor = shrink.data();
+    
+    // Branch-free so the compiler can auto-vectorise it
+    for (size_t i = 0; i < blockEnd; i++) {
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        remaining[i] -= dt;
+        float ratio = std::min(std::max(remaining[i] * inv[i], 0.0f), 1.0f);
+        outAlpha[i] = ratio * ratio;
+        outSize[i] = base[i] * (1.0f - shrinkFactor[i] * (1.0f - ratio));
+    }
+#endif
+}
+
+void ParticleSystem::RemoveExpired() {
+    size_t i = 0;
+    while (i < count) {
+        if (life[i] <= 0.0f) {
+            // Fill the hole with the last live particle and re-check this slot
+            count--;
+            if (i != count) {
+                MoveParticle(count, i);
+            }
+        } else {
+            i++;
+        }
+    }
+}
+
+void ParticleSystem::MoveParticle(size_t from, size_t to) {
+    posX[to] = posX[from];
+    posY[to] = posY[from];
+    velX[to] = velX[from];
+    velY[to] = velY[from];
+    life[to] = life[from];
+    invMaxLife[to] = invMaxLife[from];
+    baseSize[to] = baseSize[from];
+    size[to] = size[from];
+    shrink[to] = shrink[from];
+    alpha[to] = alpha[from];
+    rotation[to] = rotation[from];
+    colorR[to] = colorR[from];
+    colorG[to] = colorG[from];
+    colorB[to] = colorB[from];
+    colorA[to] = colorA[from];
+    sides[to] = sides[from];
+}
+
+void ParticleSystem::Render(RenderSnapshot& frame) {
+    if (count == 0) return;
+    
+    // Only build geometry for particles inside the current view
+    const sf::View& view = frame.GetView();
+    sf::Vector2f halfSize = view.getSize() / 2.0f + sf::Vector2f(PARTICLE_CULL_MARGIN, PARTICLE_CULL_MARGIN);
+    float minX = view.getCenter().x - halfSize.x;
+    float maxX = view.getCenter().x + halfSize.x;
+    float minY = view.getCenter().y - halfSize.y;
+    float maxY = view.getCenter().y + halfSize.y;
+    
+    vertices.clear();
+    
+    for (size_t i = 0; i < count; i++) {
+        if (posX[i] < minX || posX[i] > maxX || posY[i] < minY || posY[i] > maxY) continue;
+        
+        sf::Color color(colorR[i], colorG[i], colorB[i], static_cast<sf::Uint8>(colorA[i] * alpha[i]));
+        if (color.a == 0 || size[i] <= 0.0f) continue;
+        
+        if (sides[i] == 4 && rotation[i] == 0.0f) {
+            // Fast path: axis-aligned quad as two triangles
+            float s = size[i];
+            sf::Vector2f topLeft(posX[i] - s, posY[i] - s);
+            sf::Vector2f topRight(posX[i] + s, posY[i] - s);
+            sf::Vector2f bottomRight(posX[i] + s, posY[i] + s);
+            sf::Vector2f bottomLeft(posX[i] - s, posY[i] + s);
+            
+            vertices.append(sf::Vertex(topLeft, color));
+            vertices.append(sf::Vertex(topRight, color));
+            vertices.append(sf::Vertex(bottomRight, color));
+            vertices.append(sf::Vertex(topLeft, color));
+            vertices.append(sf::Vertex(bottomRight, color));
+            vertices.append(sf::Vertex(bottomLeft, color));
+        } else {
+            AppendPolygon(i, color);
+        }
+    }
+    
+    if (vertices.getVertexCount() > 0) {
+        frame.Draw(vertices);
+    }
+}
+
+void ParticleSystem::AppendPolygon(size_t index, const sf::Color& color) {
+    const std::vector<sf::Vector2f>& unit = polygonTables[sides[index]];
+    const sf::Vector2f center(posX[index], posY[index]);
+    const float s = size[index];
+    const float cosR = std::cos(rotation[index] * PARTICLE_DEG_TO_RAD);
+    const float sinR = std::sin(rotation[index] * PARTICLE_DEG_TO_RAD);
+    
+    for (size_t p = 0; p + 1 < unit.size(); p++) {
+        sf::Vector2f a(unit[p].x * cosR - unit[p].y * sinR, unit[p].x * sinR + unit[p].y * cosR);
+        sf::Vector2f b(unit[p + 1].x * cosR - unit[p + 1].y * sinR, unit[p + 1].x * sinR + unit[p + 1].y * cosR);
+        
+        vertices.append(sf::Vertex(center, color));
+        vertices.append(sf::Vertex(center + a * s, color));
+        vertices.append(sf::Vertex(center + b * s, color));
+    }
+}
+
+void ParticleSystem::Clear() {
+    count = 0;
+    vertices.clear();
+}
+
+void ParticleSystem::SetBudget(size_t newBudget) {
+    budget = std::max<size_t>(1, std::min<size_t>(newBudget, PARTICLE_POOL_CAPACITY));
+    
+    // Drop the newest particles if the pool is now over budget
+    if (count > budget) {
+        count = budget;
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include <array>
+#include "../utils/config/ParticleConfig.h"
+#include "../render/RenderSnapshot.h"
+
+// Everything needed to spawn one particle
+struct ParticleDesc {
+    sf::Vector2f position;
+    sf::Vector2f velocity;
+    sf::Color color = sf::Color::White;
+    float size = 2.0f;          // Half extent (or circumradius for polygons) in pixels
+    float lifetime = 1.0f;      // Seconds until the particle expires
+    float shrink = 1.0f;        // 1 = shrinks to nothing over its life, 0 = keeps its size
+    float rotation = 0.0f;      // Degrees, only used for polygons
+    int sides = 4;              // 4 = axis-aligned quad, 3..8 = regular polygon
+};
+
+// Engine-wide pooled particle system. ForceField zaps, enemy deaths and pentagon
+// afterimages all emit into the same pool, which enforces one global budget.
+//
+// Storage is structure-of-arrays and live particles are packed densely in
+// [0, count), so emitting is O(1) (append), expiring is O(1) (swap the last live
+// particle into the hole) and the per-frame update is a straight SIMD loop.
+class ParticleSystem {
+public:
+    static ParticleSystem& Get();
+    
+    // Returns false when the budget is exhausted and the particle was dropped
+    bool Emit(const ParticleDesc& desc);
+    
+    // Jobs on worker threads can't touch the pool. While a capture buffer is bound on a
+    // thread, Emit() from that thread appends to it instead, and the owner flushes the
+    // buffers on the main thread in a fixed order. The seed restarts the thread's Rand()
+    // stream, so a chunk's particles don't depend on which thread ran it.
+    static void BindCapture(std::vector<ParticleDesc>* buffer, uint64_t seed = 0);
+    
+    // rand() for particle code: 0..RAND_MAX from a per-thread generator, safe in jobs
+    static int Rand();
+    void Flush(std::vector<ParticleDesc>& buffer);
+    
+    // Radial burst with randomised speed, size, lifetime and brightness
+    int EmitBurst(const sf::Vector2f& center, int particleCount, const sf::Color& color,
+                  float minSpeed, float maxSpeed, float minSize, float maxSize,
+                  float minLifetime, float maxLifetime, int colorVariation = 0);
+    
+    void Update(float dt);
+    void Render(RenderSnapshot& frame);
+    void Clear();
+    
+    size_t GetActiveCount() const { return count; }
+    size_t GetBudget() const { return budget; }
+    void SetBudget(size_t newBudget);
+    size_t GetDroppedCount() const { return droppedCount; }
+    
+private:
+    ParticleSystem();
+    ParticleSystem(const ParticleSystem&) = delete;
+    ParticleSystem& operator=(const ParticleSystem&) = delete;
+    
+    void Integrate(float dt);
+    void RemoveExpired();
+    void MoveParticle(size_t from, size_t to);
+    void AppendPolygon(size_t index, const sf::Color& color);
+    
+    // Structure-of-arrays particle data, sized to PARTICLE_POOL_CAPACITY once
+    std::vector<float> posX, posY;
+    std::vector<float> velX, velY;
+    std::vector<float> life, invMaxLife;
+    std::vector<float> baseSize, size, shrink;
+    std::vector<float> alpha;               // 0..1, derived from remaining life
+    std::vector<float> rotation;
+    std::vector<sf::Uint8> colorR, colorG, colorB, colorA;
+    std::vector<sf::Uint8> sides;
+    
+    size_t count;
+    size_t budget;
+    size_t droppedCount;
+    
+    sf::VertexArray vertices;
+    std::array<std::vector<sf::Vector2f>, PARTICLE_MAX_POLYGON_SIDES + 1> polygonTables;
+};
+
+#endif // PARTICLE_SYSTEM_H
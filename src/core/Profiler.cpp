@@ -0,0 +1,194 @@
+#include "Profiler.h"
+#include <algorithm>
+
+std::atomic<Profiler*> Profiler::tracked{nullptr};
+std::atomic<uint32_t> Profiler::otherAllocations{0};
+
+Profiler& Profiler::Get() {
+    static Profiler instance;
+    return instance;
+}
+
+Profiler::Profiler() {
+    Node frame;
+    frame.name = "Frame";
+    frame.parent = -1;
+    frame.depth = 0;
+    frame.history.assign(PROFILER_HISTORY_FRAMES, FrameSample());
+    nodes.push_back(frame);
+    open.reserve(PROFILER_MAX_DEPTH);
+    frameStart = Clock::now();
+    tracked.store(this, std::memory_order_release);
+}
+
+void Profiler::SetOwnerThread() {
+    owner = std::this_thread::get_id();
+}
+
+bool Profiler::BeginZone(const char* name) {
+    if (std::this_thread::get_id() != owner) return false;
+    if (open.size() >= PROFILER_MAX_DEPTH) return false;
+
+    current = FindOrAddChild(current, name);
+    openNames[open.size()].store(name, std::memory_order_relaxed);
+    open.push_back({current, Clock::now()});
+    openCount.store(static_cast<int>(open.size()), std::memory_order_release);
+    return true;
+}
+
+void Profiler::EndZone() {
+    OpenZone zone = open.back();
+    open.pop_back();
+    openCount.store(static_cast<int>(open.size()), std::memory_order_release);
+
+    Node& node = nodes[zone.node];
+    node.frameMs += std::chrono::duration<double, std::milli>(Clock::now() - zone.start).count();
+    node.frameCalls++;
+    current = node.parent;
+}
+
+void Profiler::EndFrame() {
+    if (std::this_thread::get_id() != owner) return;
+
+    Clock::time_point now = Clock::now();
+    nodes[0].frameMs = std::chrono::duration<double, std::milli>(now - frameStart).count();
+    nodes[0].frameCalls = 1;
+    frameStart = now;
+
+    // Roll allocations up into the parents. A child is always added after its parent, so
+    // walking backwards finishes every child before its parent is added to its own parent.
+    for (Node& node : nodes) {
+        node.totalAllocations = node.frameAllocations;
+        node.totalBytes = node.frameBytes;
+    }
+    for (size_t i = nodes.size() - 1; i > 0; i--) {
+        Node& parent = nodes[nodes[i].parent];
+        parent.totalAllocations += nodes[i].totalAllocations;
+        parent.totalBytes += nodes[i].totalBytes;
+    }
+
+    // Zones that weren't entered this frame record a zero, which keeps their average honest
+    for (Node& node : nodes) {
+        FrameSample& sample = node.history[historyHead];
+        sample.ms = static_cast<float>(node.frameMs);
+        sample.allocations = node.totalAllocations;
+        sample.ownAllocations = node.frameAllocations;
+        sample.bytes = node.totalBytes;
+        node.lastCalls = node.frameCalls;
+        node.frameMs = 0.0;
+        node.frameCalls = 0;
+        node.frameAllocations = 0;
+        node.frameBytes = 0;
+    }
+    lastOtherAllocations = otherAllocations.exchange(0, std::memory_order_relaxed);
+    historyHead = (historyHead + 1) % PROFILER_HISTORY_FRAMES;
+    historyCount = std::min<size_t>(historyCount + 1, PROFILER_HISTORY_FRAMES);
+}
+
+int Profiler::FindOrAddChild(int parent, const char* name) {
+    for (int child = nodes[parent].firstChild; child >= 0; child = nodes[child].nextSibling) {
+        if (nodes[child].name == name) return child;
+    }
+
+    Node node;
+    node.name = name;
+    node.parent = parent;
+    node.depth = nodes[parent].depth + 1;
+    node.history.assign(PROFILER_HISTORY_FRAMES, FrameSample());
+    int index = static_cast<int>(nodes.size());
+    nodes.push_back(std::move(node));
+
+    Node& parentNode = nodes[parent];
+    if (parentNode.lastChild >= 0) {
+        nodes[parentNode.lastChild].nextSibling = index;
+    } else {
+        parentNode.firstChild = index;
+    }
+    parentNode.lastChild = index;
+    return index;
+}
+
+void Profiler::GetZoneStats(std::vector<ZoneStats>& out) const {
+    out.clear();
+    CollectStats(0, out);
+}
+
+void Profiler::CollectStats(int index, std::vector<ZoneStats>& out) const {
+    const Node& node = nodes[index];
+
+    ZoneStats stats{node.name, node.depth, 0.0f, 0.0f, 0.0f, node.lastCalls, 0.0f, 0.0f, 0.0f, false};
+    if (historyCount > 0) {
+        size_t last = (historyHead + PROFILER_HISTORY_FRAMES - 1) % PROFILER_HISTORY_FRAMES;
+        stats.lastMs = node.history[last].ms;
+
+        // The ring fills from slot 0, so until it wraps the valid samples are the first historyCount
+        float total = 0.0f;
+        double allocations = 0.0;
+        double ownAllocations = 0.0;
+        double bytes = 0.0;
+        for (size_t i = 0; i < historyCount; i++) {
+            const FrameSample& sample = node.history[i];
+            total += sample.ms;
+            stats.maxMs = std::max(stats.maxMs, sample.ms);
+            allocations += sample.allocations;
+            ownAllocations += sample.ownAllocations;
+            bytes += static_cast<double>(sample.bytes);
+        }
+        stats.averageMs = total / historyCount;
+        stats.allocations = static_cast<float>(allocations / historyCount);
+        stats.ownAllocations = static_cast<float>(ownAllocations / historyCount);
+        stats.allocatedKB = static_cast<float>(bytes / historyCount / 1024.0);
+
+        // Everything outside a zone lands on the frame itself, so it is judged on its total
+        stats.overBudget = index == 0 ? stats.allocations > ALLOCATION_FRAME_BUDGET
+                                      : stats.ownAllocations > ALLOCATION_ZONE_BUDGET;
+    }
+    out.push_back(stats);
+
+    for (int child = node.firstChild; child >= 0; child = nodes[child].nextSibling) {
+        CollectStats(child, out);
+    }
+}
+
+int Profiler::GetLastFrame(ZoneSample* out, int max) const {
+    int count = 0;
+    for (int child = nodes[0].firstChild; child >= 0; child = nodes[child].nextSibling) {
+        CollectLastFrame(child, out, max, count);
+    }
+    return count;
+}
+
+void Profiler::CollectLastFrame(int index, ZoneSample* out, int max, int& count) const {
+    const Node& node = nodes[index];
+    if (node.lastCalls == 0 || count >= max) return;
+
+    size_t last = (historyHead + PROFILER_HISTORY_FRAMES - 1) % PROFILER_HISTORY_FRAMES;
+    out[count++] = {node.name, node.depth, node.history[last].ms};
+    for (int child = node.firstChild; child >= 0; child = nodes[child].nextSibling) {
+        CollectLastFrame(child, out, max, count);
+    }
+}
+
+int Profiler::GetOpenZones(const char** out, int max) const {
+    int count = std::min(openCount.load(std::memory_order_acquire), max);
+    for (int i = 0; i < count; i++) {
+        out[i] = openNames[i].load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+void Profiler::CountAllocation(size_t bytes) {
+    Profiler* profiler = tracked.load(std::memory_order_acquire);
+    if (!profiler) return;
+
+    if (std::this_thread::get_id() != profiler->owner) {
+        otherAllocations.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Owner thread only, like the zones themselves. If this allocation is nodes growing,
+    // the old buffer is still in place until the new one has been returned.
+    Node& node = profiler->nodes[profiler->current];
+    node.frameAllocations++;
+    node.frameBytes += bytes;
+}
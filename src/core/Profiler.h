@@ -0,0 +1,170 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "../utils/config/Config.h"
+#include "TraceRecorder.h"
+
+// Hierarchical CPU zones for the main loop.
+//
+// PROFILE_SCOPE("name") times the rest of the enclosing block. Zones nest into a tree
+// keyed by name under their parent, so the same zone reached from two places shows up
+// twice. EndFrame() folds each zone's time for the frame into a rolling history that
+// the overlay reads averages and maximums from.
+//
+// Only the thread that called SetOwnerThread() is recorded; zones opened on job workers
+// are skipped, so put the zone around the job batch instead of inside the job (traces
+// do record them, see TraceRecorder). Names must be string literals, they are compared
+// by pointer.
+//
+// With ALLOCATION_TRACKING the global operator new (AllocationHook.cpp) reports every
+// allocation here. Owner thread allocations are charged to the innermost open zone and
+// rolled up into its parents at the end of the frame; other threads are only counted.
+class Profiler {
+public:
+    struct ZoneStats {
+        const char* name;
+        int depth;             // 0 for the frame itself
+        float lastMs;          // Last completed frame
+        float averageMs;       // Over the history window
+        float maxMs;
+        int calls;             // Times entered in the last completed frame
+        float allocations;     // Average per frame, including child zones
+        float allocatedKB;     // Average per frame, including child zones
+        float ownAllocations;  // Average per frame made by this zone itself, not its children
+        bool overBudget;       // ownAllocations over ALLOCATION_ZONE_BUDGET (ALLOCATION_FRAME_BUDGET for the frame)
+    };
+
+    // One zone's time in the last completed frame, without the history
+    struct ZoneSample {
+        const char* name;
+        int depth;
+        float ms;
+    };
+
+    static Profiler& Get();
+
+    void SetOwnerThread();
+
+    // Use PROFILE_SCOPE rather than calling these directly. BeginZone returns false
+    // when the zone isn't recorded, in which case EndZone must not be called.
+    bool BeginZone(const char* name);
+    void EndZone();
+
+    // Closes the frame: everything since the previous call counts as one frame
+    void EndFrame();
+
+    // Depth-first, children in the order they were first entered
+    void GetZoneStats(std::vector<ZoneStats>& out) const;
+
+    // Zones entered in the last completed frame, depth-first, up to max; returns the count
+    int GetLastFrame(ZoneSample* out, int max) const;
+
+    // Zones open right now on the owner thread, outermost first. Safe to call from any
+    // thread, e.g. a watchdog looking at a main thread that has stopped.
+    int GetOpenZones(const char** out, int max) const;
+
+    // Called by the allocation hook for every operator new; must not allocate
+    static void CountAllocation(size_t bytes);
+
+    // Allocations made off the owner thread in the last completed frame
+    uint32_t GetOtherThreadAllocations() const { return lastOtherAllocations; }
+
+private:
+    Profiler();
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct FrameSample {
+        float ms = 0.0f;
+        uint32_t allocations = 0;       // Including children
+        uint32_t ownAllocations = 0;
+        uint64_t bytes = 0;             // Including children
+    };
+
+    struct Node {
+        const char* name;
+        int parent;
+        int depth;
+        int firstChild = -1;
+        int lastChild = -1;
+        int nextSibling = -1;
+        double frameMs = 0.0;         // Accumulated in the current frame
+        int frameCalls = 0;
+        int lastCalls = 0;
+        uint32_t frameAllocations = 0;  // Made by this zone itself in the current frame
+        uint64_t frameBytes = 0;
+        uint32_t totalAllocations = 0;  // Including children, filled in by EndFrame
+        uint64_t totalBytes = 0;
+        std::vector<FrameSample> history;   // Ring of per-frame samples, PROFILER_HISTORY_FRAMES long
+    };
+
+    struct OpenZone {
+        int node;
+        Clock::time_point start;
+    };
+
+    int FindOrAddChild(int parent, const char* name);
+    void CollectStats(int node, std::vector<ZoneStats>& out) const;
+    void CollectLastFrame(int node, ZoneSample* out, int max, int& count) const;
+
+    std::thread::id owner;
+    std::vector<Node> nodes;          // nodes[0] is the frame
+    std::vector<OpenZone> open;
+    std::atomic<const char*> openNames[PROFILER_MAX_DEPTH] = {};   // Mirror of open for other threads
+    std::atomic<int> openCount{0};
+    int current = 0;
+    Clock::time_point frameStart;
+    size_t historyHead = 0;           // Slot the next completed frame goes in
+    size_t historyCount = 0;
+
+    // Set once construction is done, so the allocation hook never reaches a half-built
+    // profiler (or builds one from inside operator new)
+    static std::atomic<Profiler*> tracked;
+    static std::atomic<uint32_t> otherAllocations;
+    uint32_t lastOtherAllocations = 0;
+};
+
+// Times its scope as a zone; PROFILE_SCOPE makes one. While a trace is recording the
+// zone is also written to it, from any thread.
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* name)
+        : name(name),
+          active(Profiler::Get().BeginZone(name)),
+          traced(TraceRecorder::Get().IsRecording()),
+          traceStart(traced ? TraceRecorder::Now() : 0) {}
+
+    ~ProfileZone() {
+        if (active) Profiler::Get().EndZone();
+        if (traced) TraceRecorder::Get().Zone(name, traceStart, TraceRecorder::Now());
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name;
+    bool active;
+    bool traced;
+    uint64_t traceStart;
+};
+
+#if PROFILING_ENABLED
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_FRAME_END() Profiler::Get().EndFrame()
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#endif
+
+#endif // PROFILER_H
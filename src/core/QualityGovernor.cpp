@@ -0,0 +1,126 @@
+#include "QualityGovernor.h"
+#include "ParticleSystem.h"
+#include <algorithm>
+#include <iostream>
+
+QualityGovernor& QualityGovernor::Get() {
+    static QualityGovernor instance;
+    return instance;
+}
+
+QualityGovernor::QualityGovernor()
+    : nextSample(0),
+      sampleCount(0),
+      tier(QualityTier::High),
+      profile(ProfileFor(QualityTier::High)),
+      evalTimer(0.0f),
+      overBudgetTime(0.0f),
+      underBudgetTime(0.0f),
+      upgradeHold(QUALITY_UPGRADE_HOLD),
+      timeSinceUpgrade(QUALITY_FLAP_WINDOW),
+      percentileFrameTime(0.0f),
+      targetFrameTime(QUALITY_TARGET_FRAME_TIME) {
+    samples.resize(QUALITY_SAMPLE_WINDOW, 0.0f);
+    scratch.reserve(QUALITY_SAMPLE_WINDOW);
+}
+
+QualityProfile QualityGovernor::ProfileFor(QualityTier tier) {
+    switch (tier) {
+        case QualityTier::Low:
+            return { QUALITY_LOW_PARTICLE_BUDGET, QUALITY_LOW_GLOW_PASSES, false, 
+                     QUALITY_LOW_AFTERIMAGE_STRIDE, false };
+        case QualityTier::Medium:
+            return { QUALITY_MEDIUM_PARTICLE_BUDGET, QUALITY_MEDIUM_GLOW_PASSES, true, 
+                     QUALITY_MEDIUM_AFTERIMAGE_STRIDE, true };
+        case QualityTier::High:
+        default:
+            return { QUALITY_HIGH_PARTICLE_BUDGET, QUALITY_HIGH_GLOW_PASSES, true, 
+                     QUALITY_HIGH_AFTERIMAGE_STRIDE, true };
+    }
+}
+
+std::string QualityGovernor::TierToString(QualityTier tier) {
+    switch (tier) {
+        case QualityTier::Low: return "Low";
+        case QualityTier::Medium: return "Medium";
+        case QualityTier::High: return "High";
+        default: return "Unknown";
+    }
+}
+
+void QualityGovernor::RecordFrame(float dt, float workTime) {
+    // Ignore hitches from loading, window drags and breakpoints
+    if (dt <= 0.0f || dt > 0.5f) return;
+    
+    samples[nextSample] = std::max(workTime, 0.0f);
+    nextSample = (nextSample + 1) % samples.size();
+    sampleCount = std::min(sampleCount + 1, samples.size());
+    
+    timeSinceUpgrade += dt;
+    evalTimer += dt;
+    if (evalTimer < QUALITY_EVAL_INTERVAL) return;
+    
+    float elapsed = evalTimer;
+    evalTimer = 0.0f;
+    
+    if (sampleCount < QUALITY_MIN_SAMPLES) return;
+    
+    percentileFrameTime = ComputePercentile();
+    
+    // Track how long we have been continuously over or under budget
+    if (percentileFrameTime > targetFrameTime * QUALITY_DOWNGRADE_RATIO) {
+        overBudgetTime += elapsed;
+        underBudgetTime = 0.0f;
+    } else if (percentileFrameTime < targetFrameTime * QUALITY_UPGRADE_RATIO) {
+        underBudgetTime += elapsed;
+        overBudgetTime = 0.0f;
+    } else {
+        // Inside the dead band - hold the current tier
+        overBudgetTime = 0.0f;
+        underBudgetTime = 0.0f;
+    }
+    
+    Evaluate();
+}
+
+void QualityGovernor::Evaluate() {
+    if (overBudgetTime >= QUALITY_DOWNGRADE_HOLD && tier != QualityTier::Low) {
+        // Dropping right after an upgrade means that tier is not sustainable; wait longer next time
+        if (timeSinceUpgrade < QUALITY_FLAP_WINDOW) {
+            upgradeHold = std::min(upgradeHold * 2.0f, QUALITY_UPGRADE_HOLD_MAX);
+        }
+        SetTier(static_cast<QualityTier>(static_cast<int>(tier) - 1));
+    } else if (underBudgetTime >= upgradeHold && tier != QualityTier::High) {
+        SetTier(static_cast<QualityTier>(static_cast<int>(tier) + 1));
+        timeSinceUpgrade = 0.0f;
+    } else if (underBudgetTime >= QUALITY_UPGRADE_HOLD_MAX) {
+        // Stable at the top tier for a long time, forget earlier flapping
+        upgradeHold = QUALITY_UPGRADE_HOLD;
+    }
+}
+
+void QualityGovernor::SetTier(QualityTier newTier) {
+    overBudgetTime = 0.0f;
+    underBudgetTime = 0.0f;
+    
+    // Frame times from the old tier say nothing about the new one
+    sampleCount = 0;
+    nextSample = 0;
+    
+    if (newTier == tier) return;
+    
+    std::cout << "[QUALITY] Effects tier " << TierToString(tier) << " -> " << TierToString(newTier)
+              << " (p" << static_cast<int>(QUALITY_PERCENTILE * 100.0f) << " "
+              << percentileFrameTime * 1000.0f << "ms)\n";
+    
+    tier = newTier;
+    profile = ProfileFor(newTier);
+    ParticleSystem::Get().SetBudget(profile.particleBudget);
+}
+
+float QualityGovernor::ComputePercentile() {
+    scratch.assign(samples.begin(), samples.begin() + sampleCount);
+    size_t index = static_cast<size_t>(QUALITY_PERCENTILE * (sampleCount - 1));
+    std::nth_element(scratch.begin(), scratch.begin() + index, scratch.end());
+    return scratch[index];
+}
@@ -0,0 +1,74 @@
+#ifndef QUALITY_GOVERNOR_H
+#define QUALITY_GOVERNOR_H
+
+#include <vector>
+#include <string>
+#include "../utils/config/QualityConfig.h"
+
+enum class QualityTier {
+    Low,
+    Medium,
+    High
+};
+
+// What each heavy visual system is allowed to do at the current tier
+struct QualityProfile {
+    size_t particleBudget;      // Global ParticleSystem budget
+    int glowPasses;             // Zap glow layers (0 = none, 1 = primary, 2 = primary + background)
+    bool zapSparkles;           // Random sparkles along the zap path
+    int afterImageStride;       // Pentagons emit every Nth afterimage
+    bool gridMinorLines;        // Grid draws minor lines as well as major ones
+};
+
+// Watches a rolling frame-time percentile and steps effect tiers down when the
+// frame budget is blown and back up once there is headroom again. The frame time it
+// judges is the work in a frame, without the time spent waiting on the frame cap, and
+// the budget is the frame period the cap asks for.
+//
+// Hysteresis comes from separate up/down thresholds and hold times: the window
+// has to stay over budget for QUALITY_DOWNGRADE_HOLD before dropping a tier and
+// under budget for the (backed-off) upgrade hold before raising one.
+class QualityGovernor {
+public:
+    static QualityGovernor& Get();
+    
+    // Feed one frame: dt is the whole frame, workTime the part that wasn't spent waiting on
+    // the frame cap or the render thread. Evaluates and applies tier changes.
+    void RecordFrame(float dt, float workTime);
+    
+    // The frame period being aimed for, in seconds; follows the frame rate cap
+    void SetTargetFrameTime(float seconds) { targetFrameTime = seconds; }
+    
+    QualityTier GetTier() const { return tier; }
+    const QualityProfile& GetProfile() const { return profile; }
+    float GetPercentileFrameTime() const { return percentileFrameTime; }
+    static std::string TierToString(QualityTier tier);
+    
+private:
+    QualityGovernor();
+    QualityGovernor(const QualityGovernor&) = delete;
+    QualityGovernor& operator=(const QualityGovernor&) = delete;
+    
+    void Evaluate();
+    void SetTier(QualityTier newTier);
+    float ComputePercentile();
+    static QualityProfile ProfileFor(QualityTier tier);
+    
+    std::vector<float> samples;         // Ring buffer of frame times
+    std::vector<float> scratch;         // Reused for nth_element
+    size_t nextSample;
+    size_t sampleCount;
+    
+    QualityTier tier;
+    QualityProfile profile;
+    
+    float evalTimer;
+    float overBudgetTime;               // Continuous time spent over the downgrade threshold
+    float underBudgetTime;              // Continuous time spent under the upgrade threshold
+    float upgradeHold;                  // Current upgrade hold, doubled when the tier flaps
+    float timeSinceUpgrade;
+    float percentileFrameTime;
+    float targetFrameTime;
+};
+
+#endif // QUALITY_GOVERNOR_H
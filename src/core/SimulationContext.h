@@ -0,0 +1,33 @@
+#ifndef SIMULATION_CONTEXT_H
+#define SIMULATION_CONTEXT_H
+
+#include <SFML/Graphics.hpp>
+#include <steam/steam_api.h>   // CSteamID only
+#include <cstdint>
+#include <string>
+#include "GameState.h"
+#include "JobSystem.h"
+
+// What the simulation (players, enemies, force fields) asks of whoever is running it.
+//
+// Game provides this for the real client, backed by the window, input and Steam
+// networking. HeadlessSimulation provides it with scripted input and a message counter,
+// so the same simulation code can run without a window or a Steam client.
+class SimulationContext {
+public:
+    virtual ~SimulationContext() = default;
+
+    virtual GameState GetCurrentState() const = 0;
+    virtual float GetFixedTimestep() const = 0;
+    virtual JobSystem& GetJobSystem() = 0;
+    virtual sf::Font& GetFont() = 0;
+
+    // Movement bits for the local player this tick, in Player::SampleMovementInput's format
+    virtual uint8_t SampleLocalMovement() = 0;
+
+    // Outgoing simulation messages
+    virtual bool SendMessage(CSteamID target, const std::string& msg) = 0;
+    virtual bool BroadcastMessage(const std::string& msg) = 0;
+};
+
+#endif // SIMULATION_CONTEXT_H
@@ -0,0 +1,91 @@
+#include "SimulationTick.h"
+#include "SimulationContext.h"
+#include "Profiler.h"
+#include "../entities/player/PlayerManager.h"
+#include "../entities/enemies/EnemyManager.h"
+#include "../utils/config/Config.h"
+
+SimulationTick::SimulationTick(SimulationContext* context, PlayerManager* playerManager, EnemyManager* enemyManager)
+    : context(context),
+      playerManager(playerManager),
+      enemyManager(enemyManager) {
+}
+
+void SimulationTick::UpdateFields(float dt) {
+    PROFILE_SCOPE("Force fields");
+    
+    // Force field visuals run as one job per player next to the particle pass. Their
+    // particles are captured per field and flushed in player order afterwards; zaps
+    // touch enemies and the network, so they stay on this thread.
+    fieldTasks.Clear();
+    fieldOwners.clear();
+    for (auto& pair : playerManager->GetPlayers()) {
+        RemotePlayer& rp = pair.second;
+        if (rp.player.HasForceField() && !rp.player.IsDead()) {
+            fieldOwners.push_back(&rp);
+        }
+    }
+    if (fieldEffects.size() < fieldOwners.size()) {
+        fieldEffects.resize(fieldOwners.size());
+    }
+    uint64_t tickSeed = static_cast<uint64_t>(fieldTick++) << 32;
+    for (size_t i = 0; i < fieldOwners.size(); i++) {
+        ForceField* field = fieldOwners[i]->player.GetForceField();
+        std::vector<ParticleDesc>* effects = &fieldEffects[i];
+        uint64_t seed = tickSeed | i;
+        fieldTasks.Add([field, effects, seed, dt] {
+            ParticleSystem::BindCapture(effects, seed);
+            field->UpdateField(dt);
+            ParticleSystem::BindCapture(nullptr);
+        });
+    }
+    
+    // Advance every pooled particle (force fields, deaths, afterimages) in one pass
+    fieldTasks.Add([dt] { ParticleSystem::Get().Update(dt); });
+    context->GetJobSystem().Run(fieldTasks);
+    
+    for (size_t i = 0; i < fieldOwners.size(); i++) {
+        ParticleSystem::Get().Flush(fieldEffects[i]);
+        fieldOwners[i]->player.GetForceField()->UpdateZapping(dt, *playerManager, *enemyManager);
+    }
+}
+
+void SimulationTick::ResolveBulletHits() {
+    PROFILE_SCOPE("Bullet hits");
+    const BulletPool& bullets = playerManager->GetAllBullets();
+    
+    // Sweep every bullet's path this tick against the enemy broadphase
+    bulletHits.clear();
+    bulletsToRemove.clear();
+    enemyManager->CollectBulletHits(bullets, BULLET_RADIUS, bulletHits);
+    
+    for (const BulletHit& hit : bulletHits) {
+        int hitEnemyId = hit.targetId;
+        
+        // An earlier bullet in this batch may have already killed it; let this one fly on
+        if (!enemyManager->FindEnemy(hitEnemyId)) continue;
+        
+        // Enemy hit! Apply damage
+        bool killed = enemyManager->InflictDamage(hitEnemyId, BULLET_DAMAGE);
+        
+        // Mark this bullet for removal
+        bulletsToRemove.push_back(hit.bulletIndex);
+        int shooterIndex = bullets.GetShooter(hit.bulletIndex);
+        
+        // Use centralized kill tracking if enemy was killed
+        if (killed) {
+            playerManager->HandleKill(shooterIndex, hitEnemyId);
+        }
+        
+        // Only modify money locally for local player's bullets on hit (not kill)
+        if (shooterIndex == playerManager->GetLocalPlayerIndex()) {
+            auto& localPlayer = playerManager->GetLocalPlayer();
+            localPlayer.money += (killed ? 0 : 10); // Hits give 10, kills are handled by HandleKill
+        }
+    }
+    
+    // Remove bullets that hit enemies
+    if (!bulletsToRemove.empty()) {
+        playerManager->RemoveBullets(bulletsToRemove);
+    }
+}
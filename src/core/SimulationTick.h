@@ -0,0 +1,46 @@
+#ifndef SIMULATION_TICK_H
+#define SIMULATION_TICK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CollisionStage.h"
+#include "JobSystem.h"
+#include "ParticleSystem.h"
+
+class SimulationContext;
+class PlayerManager;
+class EnemyManager;
+struct RemotePlayer;
+
+// The steps of a tick that PlayingState and HeadlessSimulation share, so the runner
+// measures the same code players get. Both update players and enemies, run their own
+// wave logic, then call UpdateFields and ResolveBulletHits in that order. The steps are
+// separate calls so the runner can time each one.
+class SimulationTick {
+public:
+    SimulationTick(SimulationContext* context, PlayerManager* playerManager, EnemyManager* enemyManager);
+
+    // Force field visuals and the particle pass as jobs, then zaps on this thread
+    void UpdateFields(float dt);
+
+    // Bullet-enemy hits: damage, kills, hit money for the local player, spent bullets
+    void ResolveBulletHits();
+
+private:
+    SimulationContext* context;
+    PlayerManager* playerManager;
+    EnemyManager* enemyManager;
+
+    // Bullet-enemy hit batch, reused every tick
+    std::vector<BulletHit> bulletHits;
+    std::vector<size_t> bulletsToRemove;
+
+    // Per-tick force field / particle jobs, reused every tick
+    TaskGraph fieldTasks;
+    std::vector<RemotePlayer*> fieldOwners;
+    std::vector<std::vector<ParticleDesc>> fieldEffects;   // Particles captured per force field
+    uint32_t fieldTick = 0;                                 // Seeds each field's particle randomness
+};
+
+#endif // SIMULATION_TICK_H
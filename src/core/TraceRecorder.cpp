@@ -0,0 +1,242 @@
+#include "TraceRecorder.h"
+#include "../utils/TimestampedPath.h"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+namespace {
+    const std::chrono::steady_clock::time_point EPOCH = std::chrono::steady_clock::now();
+
+    thread_local std::string pendingThreadName;
+
+    // Trace timestamps are microseconds; keep the nanoseconds as decimals
+    void FormatMicros(char* out, size_t size, uint64_t ns) {
+        std::snprintf(out, size, "%llu.%03u", static_cast<unsigned long long>(ns / 1000),
+                      static_cast<unsigned>(ns % 1000));
+    }
+}
+
+TraceRecorder& TraceRecorder::Get() {
+    static TraceRecorder instance;
+    return instance;
+}
+
+TraceRecorder::~TraceRecorder() {
+    Stop();
+}
+
+uint64_t TraceRecorder::Now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - EPOCH).count());
+}
+
+bool TraceRecorder::Start(const std::string& requestedPath) {
+    if (IsRecording()) return false;
+
+    path = requestedPath.empty() ? MakeTimestampedPath(TRACE_FILE_PREFIX, ".json") : requestedPath;
+    file.open(path, std::ios::out | std::ios::trunc);
+    if (!file) {
+        std::cerr << "[TRACE] Could not open " << path << "\n";
+        return false;
+    }
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"SteamGame\"}}";
+    eventsWritten = 0;
+
+    // Anything left over from the last recording belongs to it, not to this one
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (auto& buffer : buffers) {
+            buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+            buffer->dropped.store(0);
+            buffer->named = false;
+        }
+    }
+
+    writerStopping = false;
+    recording.store(true);
+    writer = std::thread(&TraceRecorder::WriterLoop, this);
+    std::cout << "[TRACE] Recording to " << path << "\n";
+    return true;
+}
+
+void TraceRecorder::Stop() {
+    if (!recording.exchange(false)) return;
+
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        writerStopping = true;
+    }
+    writerWake.notify_one();
+    writer.join();
+
+    uint64_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (auto& buffer : buffers) {
+            dropped += buffer->dropped.load();
+        }
+    }
+
+    file << "\n]}\n";
+    file.close();
+    std::cout << "[TRACE] Wrote " << eventsWritten << " events to " << path;
+    if (dropped > 0) {
+        std::cout << " (" << dropped << " dropped, raise TRACE_BUFFER_EVENTS)";
+    }
+    std::cout << "\n";
+}
+
+void TraceRecorder::SetThreadName(const std::string& name) {
+    pendingThreadName = name;
+}
+
+TraceRecorder::ThreadBuffer* TraceRecorder::GetThreadBuffer() {
+    // Created the first time a thread records and kept for the life of the process
+    thread_local ThreadBuffer* threadBuffer = nullptr;
+    if (threadBuffer) return threadBuffer;
+
+    std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer());
+    buffer->events.resize(TRACE_BUFFER_EVENTS);
+
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    buffer->threadId = static_cast<uint32_t>(buffers.size() + 1);
+    buffer->name = pendingThreadName.empty() ? "Thread " + std::to_string(buffer->threadId) : pendingThreadName;
+    threadBuffer = buffer.get();
+    buffers.push_back(std::move(buffer));
+    return threadBuffer;
+}
+
+void TraceRecorder::Push(const Event& event) {
+    ThreadBuffer* buffer = GetThreadBuffer();
+    size_t head = buffer->head.load(std::memory_order_relaxed);
+    if (head - buffer->tail.load(std::memory_order_acquire) >= buffer->events.size()) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    buffer->events[head % buffer->events.size()] = event;
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+void TraceRecorder::Zone(const char* name, uint64_t startNs, uint64_t endNs) {
+    if (!IsRecording()) return;
+
+    Event event{};
+    event.kind = EventKind::Zone;
+    event.name = name;
+    event.startNs = startNs;
+    event.durationNs = endNs - startNs;
+    Push(event);
+}
+
+void TraceRecorder::Message(bool outgoing, const std::string& msg, size_t size, uint64_t peer) {
+    if (!IsRecording()) return;
+
+    Event event{};
+    event.kind = EventKind::Message;
+    event.name = outgoing ? "Send" : "Recv";
+    event.startNs = Now();
+    event.peer = peer;
+    event.argNames[0] = "size";
+    event.argValues[0] = static_cast<int64_t>(size);
+
+    // Message types are short letter codes before the first '|'; keep anything else out of the JSON
+    size_t length = 0;
+    for (char c : msg) {
+        if (c == '|' || length + 1 >= sizeof(event.label)) break;
+        bool plain = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_';
+        event.label[length++] = plain ? c : '?';
+    }
+    event.label[length] = '\0';
+    Push(event);
+}
+
+void TraceRecorder::Marker(const char* name, const char* argName, int64_t argValue,
+                           const char* argName2, int64_t argValue2) {
+    if (!IsRecording()) return;
+
+    Event event{};
+    event.kind = EventKind::Marker;
+    event.name = name;
+    event.startNs = Now();
+    event.argNames[0] = argName;
+    event.argValues[0] = argValue;
+    event.argNames[1] = argName2;
+    event.argValues[1] = argValue2;
+    Push(event);
+}
+
+void TraceRecorder::WriterLoop() {
+    std::unique_lock<std::mutex> lock(writerMutex);
+    while (!writerStopping) {
+        writerWake.wait_for(lock, std::chrono::milliseconds(TRACE_FLUSH_INTERVAL_MS),
+                            [this] { return writerStopping; });
+
+        // Last pass after Stop() picks up whatever was recorded before it
+        lock.unlock();
+        Drain();
+        lock.lock();
+    }
+}
+
+void TraceRecorder::Drain() {
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    for (auto& buffer : buffers) {
+        if (!buffer->named) {
+            file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+                 << ",\"args\":{\"name\":\"" << buffer->name << "\"}}";
+            buffer->named = true;
+        }
+
+        size_t tail = buffer->tail.load(std::memory_order_relaxed);
+        size_t head = buffer->head.load(std::memory_order_acquire);
+        for (size_t i = tail; i != head; i++) {
+            WriteEvent(buffer->events[i % buffer->events.size()], buffer->threadId);
+        }
+        buffer->tail.store(head, std::memory_order_release);
+    }
+    file.flush();
+}
+
+void TraceRecorder::WriteEvent(const Event& event, uint32_t threadId) {
+    char ts[32];
+    char line[512];
+    FormatMicros(ts, sizeof(ts), event.startNs);
+
+    switch (event.kind) {
+        case EventKind::Zone: {
+            char dur[32];
+            FormatMicros(dur, sizeof(dur), event.durationNs);
+            std::snprintf(line, sizeof(line),
+                ",\n{\"name\":\"%s\",\"cat\":\"zone\",\"ph\":\"X\",\"ts\":%s,\"dur\":%s,\"pid\":1,\"tid\":%u}",
+                event.name, ts, dur, threadId);
+            break;
+        }
+        case EventKind::Message:
+            // Peers are 64-bit Steam ids, which a JSON number can't hold exactly
+            std::snprintf(line, sizeof(line),
+                ",\n{\"name\":\"%s %s\",\"cat\":\"net\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%s,\"pid\":1,\"tid\":%u,"
+                "\"args\":{\"type\":\"%s\",\"size\":%lld,\"peer\":\"%llu\"}}",
+                event.name, event.label, ts, threadId, event.label,
+                static_cast<long long>(event.argValues[0]), static_cast<unsigned long long>(event.peer));
+            break;
+        case EventKind::Marker: {
+            char args[160] = "";
+            if (event.argNames[0] && event.argNames[1]) {
+                std::snprintf(args, sizeof(args), ",\"args\":{\"%s\":%lld,\"%s\":%lld}",
+                              event.argNames[0], static_cast<long long>(event.argValues[0]),
+                              event.argNames[1], static_cast<long long>(event.argValues[1]));
+            } else if (event.argNames[0]) {
+                std::snprintf(args, sizeof(args), ",\"args\":{\"%s\":%lld}",
+                              event.argNames[0], static_cast<long long>(event.argValues[0]));
+            }
+            std::snprintf(line, sizeof(line),
+                ",\n{\"name\":\"%s\",\"cat\":\"session\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%s,\"pid\":1,\"tid\":%u%s}",
+                event.name, ts, threadId, args);
+            break;
+        }
+    }
+
+    file << line;
+    eventsWritten++;
+}
@@ -0,0 +1,98 @@
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../utils/config/Config.h"
+
+// Records a session to a Chrome trace-event JSON file (chrome://tracing, Perfetto).
+//
+// Profiling zones, network messages and wave markers are pushed into a ring owned by the
+// calling thread, so recording takes no locks. A writer thread drains every ring each
+// TRACE_FLUSH_INTERVAL_MS and formats the JSON, keeping the file I/O off the main loop.
+// When a ring is full the event is dropped and counted rather than waiting for the writer.
+class TraceRecorder {
+public:
+    static TraceRecorder& Get();
+
+    // Starts a new file, timestamped when no path is given. Returns false if already recording.
+    bool Start(const std::string& path = "");
+    void Stop();
+    bool IsRecording() const { return recording.load(std::memory_order_relaxed); }
+
+    // Shown as the thread's track name; call as the thread starts, before it records anything
+    void SetThreadName(const std::string& name);
+
+    // Nanoseconds on the recorder's clock, for zone start and end times
+    static uint64_t Now();
+
+    // A completed zone; name must be a string literal
+    void Zone(const char* name, uint64_t startNs, uint64_t endNs);
+
+    // One network message on the wire; the type is taken from its prefix
+    void Message(bool outgoing, const std::string& msg, size_t size, uint64_t peer);
+
+    // A session-wide marker with up to two named values, e.g. a wave starting
+    void Marker(const char* name, const char* argName = nullptr, int64_t argValue = 0,
+                const char* argName2 = nullptr, int64_t argValue2 = 0);
+
+private:
+    TraceRecorder() = default;
+    ~TraceRecorder();
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    enum class EventKind : uint8_t { Zone, Message, Marker };
+
+    struct Event {
+        EventKind kind;
+        const char* name;
+        uint64_t startNs;
+        uint64_t durationNs;
+        uint64_t peer;
+        const char* argNames[2];
+        int64_t argValues[2];
+        char label[16];           // Message type
+    };
+
+    // Single producer (the owning thread), single consumer (the writer)
+    struct ThreadBuffer {
+        std::vector<Event> events;
+        std::atomic<size_t> head{0};
+        std::atomic<size_t> tail{0};
+        std::atomic<uint64_t> dropped{0};
+        std::string name;
+        uint32_t threadId = 0;
+        bool named = false;       // Thread name written to the current file
+    };
+
+    ThreadBuffer* GetThreadBuffer();
+    void Push(const Event& event);
+    void WriterLoop();
+    void Drain();
+    void WriteEvent(const Event& event, uint32_t threadId);
+
+    std::atomic<bool> recording{false};
+
+    std::mutex buffersMutex;      // Taken when a thread registers and while draining
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+    std::thread writer;
+    std::mutex writerMutex;
+    std::condition_variable writerWake;
+    bool writerStopping = false;
+
+    // Writer thread only while recording
+    std::ofstream file;
+    std::string path;
+    uint64_t eventsWritten = 0;
+};
+
+#endif // TRACE_RECORDER_H
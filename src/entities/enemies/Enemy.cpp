@@ -5,19 +5,40 @@
 #include "SquareEnemy.h"
 #include "PentagonEnemy.h"
 #include <cmath>
+#include <cstdio>
 #include <sstream>
 #include <iostream>
 
+namespace {
+    // -1 for anything that isn't a hex digit, so a mangled blob is rejected, not thrown on
+    int HexDigit(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+}
+
 Enemy::Enemy(int id, const sf::Vector2f& position, float health, float speed)
     : id(id), 
       position(position), 
+      previousPosition(position),
       velocity(0.0f, 0.0f),
       health(health), 
       speed(speed),
       radius(ENEMY_SIZE / 2.0f),
       hasTarget(false),
       targetPosition(0.0f, 0.0f),
-      lastAttackerID("") {
+      lastAttackerID(""),
+      rngState(0x9E3779B9u ^ (static_cast<uint32_t>(id) * 0x85EBCA6Bu)) {
+    if (rngState == 0) rngState = 1;   // xorshift never leaves zero
+}
+
+uint32_t Enemy::NextRandom(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
 }
 
 void Enemy::Update(float dt, PlayerManager& playerManager) {
@@ -29,24 +50,42 @@ void Enemy::Update(float dt, PlayerManager& playerManager) {
 }
 
 void Enemy::FindTarget(PlayerManager& playerManager) {
+    const PlayerRegistry& players = playerManager.GetPlayers();
+    
+    // Clients keep chasing the host's choice while that player is alive
+    if (replicatedBehavior) {
+        const RemotePlayer* target = players.At(targetSlot);
+        if (target && !target->player.IsDead()) {
+            targetPosition = target->player.GetPosition();
+            hasTarget = true;
+            return;
+        }
+    }
+    
     // Default implementation finds closest player
-    const auto& players = playerManager.GetPlayers();
     float closestDistance = 99999.0f;
+    int closestSlot = PLAYER_INVALID_INDEX;
     hasTarget = false;
     
-    for (const auto& pair : players) {
+    for (auto it = players.begin(); it != players.end(); ++it) {
         // Skip dead players
-        if (pair.second.player.IsDead()) continue;
+        if (it->second.player.IsDead()) continue;
         
-        sf::Vector2f playerPos = pair.second.player.GetPosition();
+        sf::Vector2f playerPos = it->second.player.GetPosition();
         float distance = std::hypot(position.x - playerPos.x, position.y - playerPos.y);
         
         if (distance < closestDistance) {
             closestDistance = distance;
+            closestSlot = players.IndexOf(it);
             targetPosition = playerPos;
             hasTarget = true;
         }
     }
+    
+    if (closestSlot != targetSlot) {
+        targetSlot = closestSlot;
+        behaviorDirty = true;
+    }
 }
 
 void Enemy::UpdateMovement(float dt, PlayerManager& playerManager) {
@@ -72,11 +111,22 @@ void Enemy::UpdateVisualRepresentation() {
     // Derived classes will implement this
 }
 
-void Enemy::Render(sf::RenderWindow& window) {
+void Enemy::Render(RenderSnapshot& frame) {
     // Base class doesn't render anything
     // Derived classes will implement this
 }
 
+void Enemy::RenderInterpolated(RenderSnapshot& frame, float alpha) {
+    // Draw at the blend of the last two ticks, then put the sim state back
+    sf::Vector2f simPosition = position;
+    position = previousPosition + (simPosition - previousPosition) * alpha;
+    UpdateVisualRepresentation();
+    Render(frame);
+    
+    position = simPosition;
+    UpdateVisualRepresentation();
+}
+
 bool Enemy::CheckBulletCollision(const sf::Vector2f& bulletPos, float bulletRadius) {
     float distanceSquared = 
         (position.x - bulletPos.x) * (position.x - bulletPos.x) + 
@@ -145,38 +195,93 @@ void Enemy::Die(const std::string& killerID) {
 }
 
 std::string Enemy::Serialize() const {
-    std::ostringstream oss;
-    oss << id << "|"
-        << static_cast<int>(GetType()) << "|"
-        << position.x << "," << position.y << "|"
-        << health;
-    return oss.str();
+    std::string data;
+    SerializeTo(data);
+    return data;
+}
+
+void Enemy::SerializeTo(std::string& out) const {
+    // %g is what an ostream prints a float as by default
+    char fields[96];
+    std::snprintf(fields, sizeof(fields), "%d|%d|%g,%g|%g", id, static_cast<int>(GetType()),
+                  position.x, position.y, health);
+    out += fields;
+    
+    // Behaviour blob, hex encoded so it survives the text protocol
+    static thread_local std::vector<uint8_t> behavior;
+    behavior.clear();
+    if (SerializeBehavior(behavior)) {
+        static const char digits[] = "0123456789abcdef";
+        out += '|';
+        for (uint8_t byte : behavior) {
+            out += digits[byte >> 4];
+            out += digits[byte & 0x0F];
+        }
+    }
+}
+
+void Enemy::SerializeCommonBehavior(std::vector<uint8_t>& out) const {
+    WriteState(out, rngState);
+    WriteState(out, static_cast<uint8_t>(targetSlot == PLAYER_INVALID_INDEX ? 0xFF : targetSlot));
+}
+
+bool Enemy::DeserializeCommonBehavior(const uint8_t*& cursor, const uint8_t* end) {
+    uint32_t rng = 0;
+    uint8_t slot = 0;
+    if (!ReadState(cursor, end, rng) || !ReadState(cursor, end, slot)) return false;
+    rngState = rng != 0 ? rng : 1;
+    targetSlot = slot == 0xFF ? PLAYER_INVALID_INDEX : slot;
+    return true;
 }
 
 void Enemy::Deserialize(const std::string& data) {
     std::istringstream iss(data);
     std::string token;
     
-    // Parse ID
-    if (std::getline(iss, token, '|')) {
-        id = std::stoi(token);
-    }
-    
-    // Skip type (already known when deserializing into concrete type)
-    std::getline(iss, token, '|');
-    
-    // Parse position
-    if (std::getline(iss, token, '|')) {
-        size_t commaPos = token.find(',');
-        if (commaPos != std::string::npos) {
-            position.x = std::stof(token.substr(0, commaPos));
-            position.y = std::stof(token.substr(commaPos + 1));
+    // The fields come off the network, so a bad one drops the update instead of throwing
+    try {
+        // Parse ID
+        if (std::getline(iss, token, '|')) {
+            id = std::stoi(token);
+        }
+        
+        // Skip type (already known when deserializing into concrete type)
+        std::getline(iss, token, '|');
+        
+        // Parse position
+        if (std::getline(iss, token, '|')) {
+            size_t commaPos = token.find(',');
+            if (commaPos != std::string::npos) {
+                position.x = std::stof(token.substr(0, commaPos));
+                position.y = std::stof(token.substr(commaPos + 1));
+            }
         }
+        
+        // Parse health
+        if (std::getline(iss, token, '|')) {
+            health = std::stof(token);
+        }
+    } catch (const std::exception& e) {
+        std::cout << "[ENEMY] Bad state for enemy " << id << ": " << e.what() << "\n";
+        return;
     }
     
-    // Parse health
-    if (std::getline(iss, token, '|')) {
-        health = std::stof(token);
+    // Parse behaviour state
+    if (std::getline(iss, token, '|') && !token.empty() && token.size() % 2 == 0) {
+        std::vector<uint8_t> behavior(token.size() / 2);
+        bool validHex = true;
+        for (size_t i = 0; i < behavior.size() && validHex; i++) {
+            int high = HexDigit(token[i * 2]);
+            int low = HexDigit(token[i * 2 + 1]);
+            validHex = high >= 0 && low >= 0;
+            behavior[i] = static_cast<uint8_t>((high << 4) | low);
+        }
+        const uint8_t* cursor = behavior.data();
+        if (validHex && DeserializeBehavior(cursor, behavior.data() + behavior.size())) {
+            replicatedBehavior = true;
+        } else {
+            std::cout << "[ENEMY] Bad behaviour state for enemy " << id << "\n";
+        }
     }
 }
 
@@ -2,12 +2,17 @@
 #define ENEMY_H
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <vector>
 #include "../../network/messages/MessageHandler.h"
 #include "../../utils/config/EnemyConfig.h"
 #include "EnemyTypes.h"
+#include "../../render/RenderSnapshot.h"
 
 // Forward declarations
 class Game;
@@ -26,13 +31,15 @@ public:
 
     // Core functionality
     virtual void Update(float dt, PlayerManager& playerManager);
-    virtual void Render(sf::RenderWindow& window);
+    virtual void Render(RenderSnapshot& frame);
+    void RenderInterpolated(RenderSnapshot& frame, float alpha);
     virtual bool CheckBulletCollision(const sf::Vector2f& bulletPos, float bulletRadius);
     virtual bool CheckPlayerCollision(const sf::RectangleShape& playerShape);
     
     // Getters/Setters
     sf::Vector2f GetPosition() const { return position; }
     void SetPosition(const sf::Vector2f& pos) { position = pos; }
+    void SavePreviousPosition() { previousPosition = position; }
     bool IsDead() const { return health <= 0.0f; }
     float GetHealth() const { return health; }
     void SetHealth(float newHealth) { health = newHealth; }
@@ -41,10 +48,18 @@ public:
     virtual EnemyType GetType() const = 0;
     float GetRadius() const { return radius; }
     
-    // Network serialization
+    // Network serialization: id|type|x,y|health, plus |behaviour (hex) for archetypes that replicate it
     virtual std::string Serialize() const;
+    void SerializeTo(std::string& out) const;   // Appends the same to out, without a temporary
     virtual void Deserialize(const std::string& data);
     
+    // Behaviour state replication. The host sends the AI state machine so clients can
+    // run the same AI between updates; the per-enemy RNG keeps their choices in step.
+    virtual bool ReplicatesBehavior() const { return false; }
+    bool HasReplicatedBehavior() const { return replicatedBehavior; }   // Client: host state applied
+    bool IsBehaviorDirty() const { return behaviorDirty; }             // Host: state machine changed
+    void ClearBehaviorDirty() { behaviorDirty = false; }
+    
     // Damage handling
     bool TakeDamage(float amount);
     bool TakeDamage(float amount, const std::string& attackerID);
@@ -63,6 +78,7 @@ protected:
     // Core properties
     int id;
     sf::Vector2f position;
+    sf::Vector2f previousPosition;   // Position at the start of the current tick
     sf::Vector2f velocity;
     float health;
     float speed;
@@ -71,6 +87,38 @@ protected:
     sf::Vector2f targetPosition;
     std::string lastAttackerID;
     
+    // Replicated behaviour state
+    uint32_t rngState;               // Per-enemy RNG, seeded from the ID so host and clients agree
+    int targetSlot = PLAYER_INVALID_INDEX;   // Session slot of the player being chased
+    bool replicatedBehavior = false;
+    bool behaviorDirty = true;
+    
+    uint32_t NextRandom() { return NextRandom(rngState); }
+    static uint32_t NextRandom(uint32_t& state);
+    
+    // Archetype behaviour blobs; the common part carries the RNG and target slot
+    virtual bool SerializeBehavior(std::vector<uint8_t>& /*out*/) const { return false; }
+    virtual bool DeserializeBehavior(const uint8_t*& /*cursor*/, const uint8_t* /*end*/) { return false; }
+    void SerializeCommonBehavior(std::vector<uint8_t>& out) const;
+    bool DeserializeCommonBehavior(const uint8_t*& cursor, const uint8_t* end);
+    
+    // One field at a time: a struct would send its padding bytes along with it
+    template <typename T>
+    static void WriteState(std::vector<uint8_t>& out, const T& value) {
+        static_assert(std::is_arithmetic<T>::value, "Write behaviour state field by field");
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+    
+    template <typename T>
+    static bool ReadState(const uint8_t*& cursor, const uint8_t* end, T& value) {
+        static_assert(std::is_arithmetic<T>::value, "Read behaviour state field by field");
+        if (end - cursor < static_cast<std::ptrdiff_t>(sizeof(T))) return false;
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return true;
+    }
+    
     // Visualization data
     virtual void UpdateVisualRepresentation();
     
@@ -1,23 +1,26 @@
 #include "EnemyManager.h"
-#include "../../core/Game.h"
+#include "../../core/SimulationContext.h"
+#include "../../core/ParticleSystem.h"
+#include "../../core/Profiler.h"
+#include "../../core/TraceRecorder.h"
+#include "../../core/Logger.h"
 #include "../player/PlayerManager.h"
-#include "../../network/Host.h"
-#include "../../network/Client.h"
-#include "../../network/NetworkManager.h"
 #include "../../network/messages/MessageHandler.h"
 #include "../../network/messages/PlayerMessageHandler.h"
 #include "../../network/messages/EnemyMessageHandler.h"
 #include "../../network/messages/StateMessageHandler.h"
 #include "../../network/messages/SystemMessageHandler.h"
+#include "../../network/SessionContext.h"
 #include <algorithm>
+#include <limits>
 #include <random>
 #include <iostream>
 #include <cmath>
 #include <ctime>
 #include <sstream>
 
-EnemyManager::EnemyManager(Game* game, PlayerManager* playerManager)
-    : game(game),
+EnemyManager::EnemyManager(SimulationContext* context, PlayerManager* playerManager)
+    : context(context),
       playerManager(playerManager),
       nextEnemyId(1),
       syncTimer(0.0f),
@@ -29,21 +32,22 @@ EnemyManager::EnemyManager(Game* game, PlayerManager* playerManager)
 }
 
 void EnemyManager::Update(float dt) {
-    if (game->GetCurrentState() != GameState::Playing) return;
+    PROFILE_SCOPE("EnemyManager::Update");
+    if (context->GetCurrentState() != GameState::Playing) return;
 
     if (!queuedEnemies.empty()) {
         UpdateSpawning(dt);
     }
 
-    for (auto& pair : enemies) {
-        pair.second->Update(dt, *playerManager);
-    }
+    UpdateEnemies(dt);
+    ApplyDeadReckoning(dt);
 
     CheckPlayerCollisions();
 
-    CSteamID myID = SteamUser()->GetSteamID();
-    CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
-    if (myID == hostID) {
+    if (SessionContext::Get().IsHost()) {
+        RecordEnemyHistory();
+        
+        behaviorCorrectionTimer += dt;
         syncTimer += dt;
         if (syncTimer >= POSITION_SYNC_INTERVAL) {
             SyncCriticalUpdates();
@@ -57,12 +61,44 @@ void EnemyManager::Update(float dt) {
             recentlyAddedIds.clear(); // Clear after sync
             recentlyRemovedIds.clear();
         }
+        
+        SyncEnemyBehaviors(dt);
+    }
+}
+
+void EnemyManager::UpdateEnemies(float dt) {
+    // Enemy AI only reads shared state, so fixed-size chunks of enemies update in parallel.
+    // Particles they emit are captured per chunk and merged in chunk order, which keeps the
+    // tick's result independent of the thread count.
+    updateList.clear();
+    for (auto& pair : enemies) {
+        updateList.push_back(pair.second.get());
+    }
+    
+    size_t chunkCount = (updateList.size() + ENEMY_UPDATE_CHUNK_SIZE - 1) / ENEMY_UPDATE_CHUNK_SIZE;
+    if (chunkEffects.size() < chunkCount) {
+        chunkEffects.resize(chunkCount);
+    }
+    
+    uint64_t tickSeed = static_cast<uint64_t>(updateTick++) << 32;
+    context->GetJobSystem().ParallelFor(updateList.size(), ENEMY_UPDATE_CHUNK_SIZE, [this, dt, tickSeed](size_t begin, size_t end) {
+        size_t chunk = begin / ENEMY_UPDATE_CHUNK_SIZE;
+        ParticleSystem::BindCapture(&chunkEffects[chunk], tickSeed | chunk);
+        for (size_t i = begin; i < end; i++) {
+            updateList[i]->SavePreviousPosition();
+            updateList[i]->Update(dt, *playerManager);
+        }
+        ParticleSystem::BindCapture(nullptr);
+    });
+    
+    for (size_t chunk = 0; chunk < chunkCount; chunk++) {
+        ParticleSystem::Get().Flush(chunkEffects[chunk]);
     }
 }
 
-void EnemyManager::Render(sf::RenderWindow& window) {
+void EnemyManager::Render(RenderSnapshot& frame, float alpha) {
     for (auto& pair : enemies) {
-        pair.second->Render(window);
+        pair.second->RenderInterpolated(frame, alpha);
     }
 }
 
@@ -100,14 +136,12 @@ int EnemyManager::AddEnemy(EnemyType type, const sf::Vector2f& position, float h
     recentlyAddedIds.insert(id);
     
     // If we're the host, broadcast this new enemy to all clients
-    CSteamID myID = SteamUser()->GetSteamID();
-    CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
     
-    if (myID == hostID) {
+    if (SessionContext::Get().IsHost()) {
         std::string addMsg = EnemyMessageHandler::FormatEnemyAddMessage(
             id, type, position, health);
         
-        game->GetNetworkManager().BroadcastMessage(addMsg);
+        context->BroadcastMessage(addMsg);
     }
     
     return id;
@@ -117,12 +151,10 @@ void EnemyManager::RemoveEnemy(int id) {
     auto it = enemies.find(id);
     if (it != enemies.end()) {
         // If we're the host, broadcast this removal to all clients
-        CSteamID myID = SteamUser()->GetSteamID();
-        CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
         
-        if (myID == hostID) {
+        if (SessionContext::Get().IsHost()) {
             std::string removeMsg = EnemyMessageHandler::FormatEnemyRemoveMessage(id);
-            game->GetNetworkManager().BroadcastMessage(removeMsg);
+            context->BroadcastMessage(removeMsg);
         }
         
         // Track recently removed enemies for sync purposes
@@ -131,6 +163,8 @@ void EnemyManager::RemoveEnemy(int id) {
         // Remove from other tracking sets
         recentlyAddedIds.erase(id);
         syncedEnemyIds.erase(id);
+        enemyTracks.erase(id);
+        sentEnemyStates.erase(id);
         
         // Actually remove the enemy
         enemies.erase(it);
@@ -139,16 +173,16 @@ void EnemyManager::RemoveEnemy(int id) {
 
 void EnemyManager::ClearEnemies() {
     enemies.clear();
+    enemyTracks.clear();
+    sentEnemyStates.clear();
     recentlyAddedIds.clear();
     recentlyRemovedIds.clear();
     syncedEnemyIds.clear();
     
     // If we're the host, broadcast a clear command
-    CSteamID myID = SteamUser()->GetSteamID();
-    CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
     
-    if (myID == hostID) {
-        game->GetNetworkManager().BroadcastMessage("EC");
+    if (SessionContext::Get().IsHost()) {
+        context->BroadcastMessage("EC");
     }
 }
 
@@ -167,21 +201,18 @@ bool EnemyManager::InflictDamage(int enemyId, float damage, const std::string& a
     bool killed = it->second->TakeDamage(damage, attackerID);
     
     // If we're the host, broadcast this damage to all clients
-    CSteamID myID = SteamUser()->GetSteamID();
-    CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
     
-    if (myID == hostID) {
+    if (SessionContext::Get().IsHost()) {
         std::string damageMsg = EnemyMessageHandler::FormatEnemyDamageMessage(
             enemyId, damage, it->second->GetHealth());
-        game->GetNetworkManager().BroadcastMessage(damageMsg);
+        context->BroadcastMessage(damageMsg);
     }
     
     return killed;
 }
 
 void EnemyManager::HandleEnemyDeath(int enemyId, const sf::Vector2f& position, const std::string& killerID) {
-    std::cout << "[EnemyManager] Enemy " << enemyId << " died at position (" 
-              << position.x << "," << position.y << "), killed by " << killerID << std::endl;
+    LOG_DEBUG("ENEMY", "Enemy {} died at {}, killed by {}", enemyId, position, killerID);
     
     // If the enemy is killed by a player, give the player credit
     if (!killerID.empty()) {
@@ -189,20 +220,47 @@ void EnemyManager::HandleEnemyDeath(int enemyId, const sf::Vector2f& position, c
         playerManager->IncrementPlayerKills(killerID);
         
         // If we're the host, broadcast this kill
-        CSteamID myID = SteamUser()->GetSteamID();
-        CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
         
-        if (myID == hostID) {
+        if (SessionContext::Get().IsHost()) {
             // Create kill message
-            std::string killMsg = PlayerMessageHandler::FormatKillMessage(killerID, enemyId);
-            game->GetNetworkManager().BroadcastMessage(killMsg);
+            std::string killMsg = PlayerMessageHandler::FormatKillMessage(playerManager->GetPlayers().IndexOf(killerID), enemyId);
+            context->BroadcastMessage(killMsg);
         }
     }
     
+    // Burst of debris where the enemy died
+    Enemy* enemy = FindEnemy(enemyId);
+    if (enemy) {
+        EmitDeathParticles(*enemy);
+    }
+    
     // Remove the enemy
     RemoveEnemy(enemyId);
 }
 
+void EnemyManager::EmitDeathParticles(const Enemy& enemy) {
+    sf::Color color;
+    switch (enemy.GetType()) {
+        case EnemyType::Triangle:
+            color = TRIANGLE_FILL_COLOR;
+            break;
+        case EnemyType::Square:
+            color = SQUARE_FILL_COLOR;
+            break;
+        case EnemyType::Pentagon:
+            color = PENTAGON_FILL_COLOR;
+            break;
+        default:
+            color = sf::Color::White;
+    }
+    
+    ParticleSystem::Get().EmitBurst(enemy.GetPosition(), ENEMY_DEATH_PARTICLES, color,
+                                    ENEMY_DEATH_PARTICLE_SPEED_MIN, ENEMY_DEATH_PARTICLE_SPEED_MAX,
+                                    ENEMY_DEATH_PARTICLE_SIZE_MIN, ENEMY_DEATH_PARTICLE_SIZE_MAX,
+                                    ENEMY_DEATH_PARTICLE_LIFETIME_MIN, ENEMY_DEATH_PARTICLE_LIFETIME_MAX,
+                                    ENEMY_DEATH_COLOR_VARIATION);
+}
+
 void EnemyManager::HandleEnemyDamage(int enemyId, float amount, float actualDamage) {
     // Optional: Do something when an enemy takes damage
     // This could include sound effects, visual effects, etc.
@@ -218,14 +276,12 @@ void EnemyManager::HandlePlayerCollision(int enemyId, const std::string& playerI
         playerIt->second.player.TakeDamage(TRIANGLE_DAMAGE);
         
         // If we're the host, broadcast this collision
-        CSteamID myID = SteamUser()->GetSteamID();
-        CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
         
-        if (myID == hostID) {
+        if (SessionContext::Get().IsHost()) {
             // Create player damage message
             std::string damageMsg = PlayerMessageHandler::FormatPlayerDamageMessage(
-                playerID, TRIANGLE_DAMAGE, enemyId);
-            game->GetNetworkManager().BroadcastMessage(damageMsg);
+                players.IndexOf(playerID), TRIANGLE_DAMAGE, enemyId);
+            context->BroadcastMessage(damageMsg);
         }
         
         // Remove the enemy after collision
@@ -281,7 +337,93 @@ bool EnemyManager::CheckBulletCollision(const sf::Vector2f& bulletPos, float bul
     return false;
 }
 
+void EnemyManager::CollectBulletHits(const BulletPool& bullets, float bulletRadius, std::vector<BulletHit>& outHits) {
+    if (bullets.Empty() || enemies.empty()) return;
+    
+    bulletStage.Clear();
+    for (auto& pair : enemies) {
+        if (pair.second->IsDead()) continue;
+        bulletStage.AddTarget(pair.first, pair.second->GetPosition(), pair.second->GetRadius());
+    }
+    bulletStage.Build();
+    
+    // Bullets from clients are tested against enemies as the shooter saw them
+    size_t firstHit = outHits.size();
+    bool anyRewound = false;
+    rewindInFlight.assign(256, false);
+    for (size_t i = 0; i < bullets.Size(); i++) {
+        uint8_t rewind = bullets.GetRewind(i);
+        if (rewind != 0) {
+            rewindInFlight[rewind] = true;
+            anyRewound = true;
+        }
+    }
+    
+    if (!anyRewound) {
+        bulletStage.SweepBullets(bullets, bulletRadius, outHits);
+        return;
+    }
+    
+    bulletStage.SweepBullets(bullets, bulletRadius, outHits, 0);
+    for (int rewind = 1; rewind < 256; rewind++) {
+        if (!rewindInFlight[rewind]) continue;
+        const std::vector<CollisionTarget>* frame = GetEnemyHistory(rewind);
+        if (!frame) {
+            // Not enough history yet: test against the present instead
+            bulletStage.SweepBullets(bullets, bulletRadius, outHits, static_cast<uint8_t>(rewind));
+            continue;
+        }
+        
+        rewindStage.Clear();
+        for (const CollisionTarget& target : *frame) {
+            rewindStage.AddTarget(target.id, target.center, target.radius);
+        }
+        rewindStage.Build();
+        rewindStage.SweepBullets(bullets, bulletRadius, outHits, static_cast<uint8_t>(rewind));
+    }
+    
+    // Keep the batch ordered by bullet index like a single sweep
+    std::sort(outHits.begin() + firstHit, outHits.end(),
+              [](const BulletHit& a, const BulletHit& b) { return a.bulletIndex < b.bulletIndex; });
+}
+
+int EnemyManager::GetMaxRewindTicks() const {
+    float dt = context->GetFixedTimestep();
+    if (dt <= 0.f) return 0;
+    int ticks = static_cast<int>(std::ceil(BULLET_LAG_COMP_MAX_REWIND / dt));
+    return std::min(ticks, 255);
+}
+
+void EnemyManager::RecordEnemyHistory() {
+    size_t frames = static_cast<size_t>(GetMaxRewindTicks()) + 1;
+    if (enemyHistory.size() != frames) {
+        enemyHistory.assign(frames, std::vector<CollisionTarget>());
+        historyHead = 0;
+        historyCount = 0;
+    }
+    
+    historyHead = (historyHead + 1) % frames;
+    historyCount = std::min(historyCount + 1, frames);
+    std::vector<CollisionTarget>& frame = enemyHistory[historyHead];
+    frame.clear();
+    for (auto& pair : enemies) {
+        if (pair.second->IsDead()) continue;
+        CollisionTarget target;
+        target.id = pair.first;
+        target.center = pair.second->GetPosition();
+        target.radius = pair.second->GetRadius();
+        frame.push_back(target);
+    }
+}
+
+const std::vector<CollisionTarget>* EnemyManager::GetEnemyHistory(int ticksAgo) const {
+    if (ticksAgo < 0 || static_cast<size_t>(ticksAgo) >= historyCount) return nullptr;
+    size_t frames = enemyHistory.size();
+    return &enemyHistory[(historyHead + frames - static_cast<size_t>(ticksAgo)) % frames];
+}
+
 void EnemyManager::SyncEnemyPositions() {
+    PROFILE_SCOPE("EnemyManager::SyncEnemyPositions");
     if (enemies.empty()) return;
     
     // Get priority list of enemies to sync
@@ -326,7 +468,7 @@ void EnemyManager::SyncEnemyPositions() {
         epMessage = EnemyMessageHandler::FormatEnemyPositionUpdateMessage(enemyIds, positions, velocities);
     }
     
-    game->GetNetworkManager().BroadcastMessage(epMessage);
+    context->BroadcastMessage(epMessage);
 }
 
 void EnemyManager::HandleSyncFullState(bool forceSend) {
@@ -351,6 +493,7 @@ void EnemyManager::HandleSyncFullState(bool forceSend) {
 }
 
 void EnemyManager::SyncFullState() {
+    PROFILE_SCOPE("EnemyManager::SyncFullState");
     if (enemies.empty() && recentlyRemovedIds.empty()) return;
     
     // Create vectors for batch update
@@ -375,14 +518,13 @@ void EnemyManager::SyncFullState() {
     if (fullStateMsg.length() > MAX_PACKET_SIZE) {
         std::vector<std::string> chunks = SystemMessageHandler::ChunkMessage(fullStateMsg, "ECS");
         for (const auto& chunk : chunks) {
-            game->GetNetworkManager().BroadcastMessage(chunk);
+            context->BroadcastMessage(chunk);
         }
     } else {
-        game->GetNetworkManager().BroadcastMessage(fullStateMsg);
+        context->BroadcastMessage(fullStateMsg);
     }
     
-    std::cout << "[HOST] Sent complete enemy state with " << enemyIds.size() 
-              << " enemies" << std::endl;
+    LOG_DEBUG("HOST", "Sent complete enemy state with {} enemies", enemyIds.size());
 }
 
 void EnemyManager::ApplyNetworkUpdate(int enemyId, const sf::Vector2f& position, float health) {
@@ -417,15 +559,117 @@ void EnemyManager::RemoteAddEnemy(int enemyId, EnemyType type, const sf::Vector2
         nextEnemyId = enemyId + 1;
     }
     
-    std::cout << "[CLIENT] Added enemy " << enemyId << " at position ("
-              << position.x << "," << position.y << ")" << std::endl;
+    LOG_DEBUG("CLIENT", "Added enemy {} at {}", enemyId, position);
 }
 
 void EnemyManager::RemoteRemoveEnemy(int enemyId) {
     auto it = enemies.find(enemyId);
     if (it != enemies.end()) {
+        EmitDeathParticles(*it->second);
         enemies.erase(it);
-        std::cout << "[CLIENT] Removed enemy " << enemyId << std::endl;
+        enemyTracks.erase(enemyId);
+        LOG_DEBUG("CLIENT", "Removed enemy {}", enemyId);
+    }
+}
+
+void EnemyManager::PushEnemySnapshot(int enemyId, uint64_t hostTimeMs, const sf::Vector2f& position, const sf::Vector2f* velocity) {
+    SnapshotClock& clock = SnapshotClock::Get();
+    clock.Observe(hostTimeMs);
+    
+    Enemy* enemy = FindEnemy(enemyId);
+    if (!enemy) return;
+    
+    // Full state carries no velocity; keep coasting on the last one
+    EnemyTrack& track = enemyTracks[enemyId];
+    if (velocity) {
+        track.velocity = *velocity;
+    }
+    
+    // Bring the update forward to the present along its velocity
+    double age = clock.HostTime() - static_cast<double>(hostTimeMs) / 1000.0;
+    float lead = static_cast<float>(std::max(0.0, std::min(age, static_cast<double>(ENEMY_DR_MAX_EXTRAPOLATION))));
+    sf::Vector2f authoritative = position + track.velocity * lead;
+    sf::Vector2f offset = enemy->GetPosition() - authoritative;
+    
+    // Enemies running the host's behaviour locally only take a correction once they drift
+    if (enemy->HasReplicatedBehavior() &&
+        offset.x * offset.x + offset.y * offset.y <= ENEMY_BEHAVIOR_CORRECTION_DISTANCE * ENEMY_BEHAVIOR_CORRECTION_DISTANCE) {
+        return;
+    }
+    
+    // Converge from what is on screen instead of jumping
+    track.position = authoritative;
+    track.blendOffset = offset;
+    track.blendRemaining = ENEMY_DR_BLEND_TIME;
+}
+
+void EnemyManager::ApplyDeadReckoning(float dt) {
+    // Client only: runs after the local enemy updates so replicated motion has the last word
+    for (auto& pair : enemyTracks) {
+        auto it = enemies.find(pair.first);
+        if (it == enemies.end()) continue;
+        Enemy* enemy = it->second.get();
+        EnemyTrack& track = pair.second;
+        
+        // Share of the remaining error to remove this tick
+        float blend = track.blendRemaining > dt ? dt / track.blendRemaining : 1.0f;
+        track.blendRemaining = std::max(0.0f, track.blendRemaining - dt);
+        sf::Vector2f step = track.blendOffset * blend;
+        track.blendOffset -= step;
+        
+        if (enemy->HasReplicatedBehavior()) {
+            // The local AI keeps moving it; the correction is pulled in on top
+            enemy->SetPosition(enemy->GetPosition() - step);
+        } else {
+            track.position += track.velocity * dt;
+            enemy->SetPosition(track.position + track.blendOffset);
+            enemy->SetVelocity(track.velocity);
+        }
+    }
+}
+
+void EnemyManager::ApplyEnemyBehavior(int enemyId, const std::string& state) {
+    Enemy* enemy = FindEnemy(enemyId);
+    if (!enemy) return;   // EA / ECS bring it in; the next refresh will catch up
+    
+    // Host state replaces the local AI state and position; snapshots no longer drive it
+    enemy->Deserialize(state);
+    enemy->SavePreviousPosition();
+    enemyTracks.erase(enemyId);
+}
+
+void EnemyManager::SyncEnemyBehaviors(float dt) {
+    PROFILE_SCOPE("EnemyManager::SyncEnemyBehaviors");
+    // Changed state machines go out right away, everything else on the refresh interval
+    behaviorRefreshTimer += dt;
+    bool refreshAll = behaviorRefreshTimer >= ENEMY_BEHAVIOR_REFRESH_INTERVAL;
+    if (refreshAll) {
+        behaviorRefreshTimer = 0.0f;
+    }
+    
+    // Built straight into one reused string, flushed whenever it reaches half a packet
+    bool messageOpen = false;
+    for (auto& pair : enemies) {
+        Enemy* enemy = pair.second.get();
+        if (!enemy->ReplicatesBehavior() || enemy->IsDead()) continue;
+        if (!refreshAll && !enemy->IsBehaviorDirty()) continue;
+        
+        if (!messageOpen) {
+            EnemyMessageHandler::BeginEnemyBehaviorMessage(behaviorMessage);
+            messageOpen = true;
+        }
+        behaviorMessage += '|';
+        enemy->SerializeTo(behaviorMessage);
+        enemy->ClearBehaviorDirty();
+        
+        if (behaviorMessage.size() > MAX_PACKET_SIZE / 2) {
+            context->BroadcastMessage(behaviorMessage);
+            messageOpen = false;
+        }
+    }
+    
+    if (messageOpen) {
+        context->BroadcastMessage(behaviorMessage);
     }
 }
 
@@ -473,6 +717,7 @@ void EnemyManager::StartNewWave(int enemyCount, EnemyType type) {
 
     // Override type parameter with our wave-based type
     currentWaveEnemyType = waveType;
+    TraceRecorder::Get().Marker("Wave start", "wave", currentWave, "enemies", enemyCount);
 
     auto& players = playerManager->GetPlayers();
     std::vector<sf::Vector2f> playerPositions;
@@ -498,11 +743,9 @@ void EnemyManager::StartNewWave(int enemyCount, EnemyType type) {
     }
 
     // If host, start broadcasting spawn chunks
-    CSteamID myID = SteamUser()->GetSteamID();
-    CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
-    if (myID == hostID) {
+    if (SessionContext::Get().IsHost()) {
         std::string waveMsg = StateMessageHandler::FormatWaveStartMessage(currentWave, enemyCount);
-        game->GetNetworkManager().BroadcastMessage(waveMsg);
+        context->BroadcastMessage(waveMsg);
     }
 }
 
@@ -659,9 +902,7 @@ void EnemyManager::UpdateSpawning(float dt) {
     std::vector<QueuedEnemy> batch(queuedEnemies.begin(), queuedEnemies.begin() + spawnCount);
     queuedEnemies.erase(queuedEnemies.begin(), queuedEnemies.begin() + spawnCount);
 
-    CSteamID myID = SteamUser()->GetSteamID();
-    CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
-    bool isHost = (myID == hostID);
+    bool isHost = SessionContext::Get().IsHost();
 
     // Spawn locally
     for (const auto& queued : batch) {
@@ -690,10 +931,10 @@ void EnemyManager::UpdateSpawning(float dt) {
         if (spawnMsg.length() > MAX_PACKET_SIZE) {
             std::vector<std::string> chunks = SystemMessageHandler::ChunkMessage(spawnMsg, "ES");
             for (const auto& chunk : chunks) {
-                game->GetNetworkManager().BroadcastMessage(chunk);
+                context->BroadcastMessage(chunk);
             }
         } else {
-            game->GetNetworkManager().BroadcastMessage(spawnMsg);
+            context->BroadcastMessage(spawnMsg);
         }
     }
 
@@ -725,13 +966,12 @@ void EnemyManager::RemoveEnemiesNotInList(const std::vector<int>& validIds) {
     
     // Then remove them one by one
     for (int id : enemyIdsToRemove) {
-        std::cout << "[CLIENT] Removing enemy " << id << " not present in sync message" << std::endl;
+        LOG_DEBUG("CLIENT", "Removing enemy {} not present in sync message", id);
         RemoteRemoveEnemy(id);
     }
     
     if (!enemyIdsToRemove.empty()) {
-        std::cout << "[CLIENT] Removed " << enemyIdsToRemove.size() 
-                  << " enemies to stay in sync with host" << std::endl;
+        LOG_DEBUG("CLIENT", "Removed {} enemies to stay in sync with host", enemyIdsToRemove.size());
     }
 }
 
@@ -772,28 +1012,76 @@ void EnemyManager::PrintEnemyStats() const {
 }
 
 void EnemyManager::SyncCriticalUpdates() {
-    std::vector<int> enemyIds;
-    std::vector<sf::Vector2f> positions;
-    std::vector<sf::Vector2f> velocities;
-
+    PROFILE_SCOPE("EnemyManager::SyncCriticalUpdates");
+    // Clients simulate squares and pentagons themselves, so they need far fewer corrections
+    bool correctionsDue = behaviorCorrectionTimer >= ENEMY_BEHAVIOR_CORRECTION_INTERVAL;
+    if (correctionsDue) {
+        behaviorCorrectionTimer = 0.0f;
+    }
+    
+    // Everything else is dead-reckoned on clients; resend only where that prediction drifted
+    uint64_t now = SnapshotClock::HostNow();
+    std::vector<std::pair<float, int>> candidates;   // (prediction error, id)
     for (const auto& pair : enemies) {
         int id = pair.first;
         Enemy* enemy = pair.second.get();
-
-        // Sync if target changed recently or enemy is near a player
-        bool shouldSync = recentlyAddedIds.count(id) > 0 || IsNearPlayer(enemy);
-        if (shouldSync) {
-            enemyIds.push_back(id);
-            positions.push_back(enemy->GetPosition());
-            velocities.push_back(enemy->GetVelocity());
+        if (enemy->IsDead()) continue;
+        
+        if (enemy->ReplicatesBehavior()) {
+            if (correctionsDue) {
+                candidates.emplace_back(ENEMY_DR_ERROR_THRESHOLD, id);
+            }
+            continue;
+        }
+        
+        auto sent = sentEnemyStates.find(id);
+        if (sent == sentEnemyStates.end()) {
+            candidates.emplace_back(std::numeric_limits<float>::max(), id);
+            continue;
+        }
+        
+        float age = static_cast<float>(now - sent->second.time) / 1000.0f;
+        sf::Vector2f predicted = sent->second.position + sent->second.velocity * age;
+        sf::Vector2f delta = enemy->GetPosition() - predicted;
+        float error = std::hypot(delta.x, delta.y);
+        if (error > ENEMY_DR_ERROR_THRESHOLD || age >= ENEMY_DR_MAX_SILENCE) {
+            candidates.emplace_back(error, id);
         }
-
-        if (enemyIds.size() >= MAX_ENEMIES_PER_UPDATE) break;
     }
-
+    if (candidates.empty()) return;
+    
+    // Worst predictions first; the rest keep drifting and win the next sync
+    size_t budget = std::min(candidates.size(), static_cast<size_t>(ENEMY_DR_MAX_UPDATES));
+    std::partial_sort(candidates.begin(), candidates.begin() + budget, candidates.end(),
+                      [](const std::pair<float, int>& a, const std::pair<float, int>& b) { return a.first > b.first; });
+    
+    std::vector<int> enemyIds;
+    std::vector<sf::Vector2f> positions;
+    std::vector<sf::Vector2f> velocities;
+    for (size_t i = 0; i < budget; ++i) {
+        int id = candidates[i].second;
+        Enemy* enemy = enemies[id].get();
+        enemyIds.push_back(id);
+        positions.push_back(enemy->GetPosition());
+        velocities.push_back(enemy->GetVelocity());
+        
+        SentEnemyState& sent = sentEnemyStates[id];
+        sent.position = enemy->GetPosition();
+        sent.velocity = enemy->GetVelocity();
+        sent.time = now;
+        
+        if (enemyIds.size() >= MAX_ENEMIES_PER_UPDATE) {
+            context->BroadcastMessage(
+                EnemyMessageHandler::FormatEnemyPositionUpdateMessage(enemyIds, positions, velocities));
+            enemyIds.clear();
+            positions.clear();
+            velocities.clear();
+        }
+    }
+    
     if (!enemyIds.empty()) {
-        std::string epMessage = EnemyMessageHandler::FormatEnemyPositionUpdateMessage(enemyIds, positions, velocities);
-        game->GetNetworkManager().BroadcastMessage(epMessage);
+        context->BroadcastMessage(
+            EnemyMessageHandler::FormatEnemyPositionUpdateMessage(enemyIds, positions, velocities));
     }
 }
 
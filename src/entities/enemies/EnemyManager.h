@@ -8,12 +8,15 @@
 #include <chrono>
 #include <SFML/Graphics.hpp>
 #include "Enemy.h"
+#include "../../core/CollisionStage.h"
+#include "../../core/ParticleSystem.h"
+#include "../../network/SnapshotBuffer.h"
 #include "../../utils/config/EnemyConfig.h"
 #include "../../utils/config/GameplayConfig.h"
 #include "../../utils/config/Config.h" // For MAX_PACKET_SIZE
 
 // Forward declarations
-class Game;
+class SimulationContext;
 class PlayerManager;
 
 class EnemyManager {
@@ -25,12 +28,12 @@ public:
         float health;
     };
     std::vector<QueuedEnemy> queuedEnemies;
-    explicit EnemyManager(Game* game, PlayerManager* playerManager);
+    explicit EnemyManager(SimulationContext* context, PlayerManager* playerManager);
     ~EnemyManager() = default;
 
     // Core functionality
     void Update(float dt);
-    void Render(sf::RenderWindow& window);
+    void Render(RenderSnapshot& frame, float alpha = 1.0f);
     
     // Enemy management
     int AddEnemy(EnemyType type, const sf::Vector2f& position, float health = ENEMY_HEALTH);
@@ -49,6 +52,8 @@ public:
     // Collision detection
     void CheckPlayerCollisions();
     bool CheckBulletCollision(const sf::Vector2f& bulletPos, float bulletRadius, int& outEnemyId);
+    void CollectBulletHits(const BulletPool& bullets, float bulletRadius, std::vector<BulletHit>& outHits);
+    int GetMaxRewindTicks() const;   // Lag compensation depth, in ticks
     
     // Network synchronization
     void SyncEnemyPositions();
@@ -57,6 +62,8 @@ public:
     void ApplyNetworkUpdate(int enemyId, const sf::Vector2f& position, float health);
     void RemoteAddEnemy(int enemyId, EnemyType type, const sf::Vector2f& position, float health);
     void RemoteRemoveEnemy(int enemyId);
+    void PushEnemySnapshot(int enemyId, uint64_t hostTimeMs, const sf::Vector2f& position, const sf::Vector2f* velocity);
+    void ApplyEnemyBehavior(int enemyId, const std::string& state);
     void HandleSyncFullState(bool forceSend = false);
     bool IsNearPlayer(Enemy* enemy);
     
@@ -82,16 +89,55 @@ public:
 private:
     // Helper methods
     void InitializeEnemyCallbacks(Enemy* enemy);
+    void EmitDeathParticles(const Enemy& enemy);
+    void UpdateEnemies(float dt);
+    void ApplyDeadReckoning(float dt);
+    void SyncEnemyBehaviors(float dt);
+    void RecordEnemyHistory();
+    const std::vector<CollisionTarget>* GetEnemyHistory(int ticksAgo) const;
     
     // Private member variables
-    Game* game;
+    SimulationContext* context;
     PlayerManager* playerManager;
     std::unordered_map<int, std::unique_ptr<Enemy>> enemies;
     int nextEnemyId;
+    CollisionStage bulletStage;      // Broadphase for swept bullet hits, rebuilt each tick
+    
+    // Parallel update scratch, reused every tick
+    std::vector<Enemy*> updateList;
+    std::vector<std::vector<ParticleDesc>> chunkEffects;   // Particles emitted per chunk
+    uint32_t updateTick = 0;                                // Seeds each chunk's particle randomness
+    
+    // Client dead reckoning: enemies coast on the last replicated velocity and blend onto corrections
+    struct EnemyTrack {
+        sf::Vector2f position;       // Authoritative position, advanced along velocity every tick
+        sf::Vector2f velocity;
+        sf::Vector2f blendOffset;    // Displayed minus authoritative, blended out over ENEMY_DR_BLEND_TIME
+        float blendRemaining = 0.0f;
+    };
+    std::unordered_map<int, EnemyTrack> enemyTracks;
+    
+    // Host: what clients were last told per enemy, to measure their prediction error
+    struct SentEnemyState {
+        sf::Vector2f position;
+        sf::Vector2f velocity;
+        uint64_t time = 0;           // SnapshotClock::HostNow() when sent
+    };
+    std::unordered_map<int, SentEnemyState> sentEnemyStates;
+    
+    // Host lag compensation: enemy hit circles for the last GetMaxRewindTicks() ticks
+    std::vector<std::vector<CollisionTarget>> enemyHistory;   // Ring, one frame per tick
+    size_t historyHead = 0;          // Most recent frame
+    size_t historyCount = 0;
+    CollisionStage rewindStage;      // Rebuilt from a history frame per rewind in flight
+    std::vector<bool> rewindInFlight;
     
     // Sync timers
     float syncTimer;
     float fullSyncTimer;
+    float behaviorRefreshTimer = 0.0f;     // Host: resend all replicated behaviour states
+    std::string behaviorMessage;           // Host: EB message being built, reused every tick
+    float behaviorCorrectionTimer = 0.0f;  // Host: position corrections for client-simulated enemies
     std::chrono::steady_clock::time_point lastFullSyncTime;
     
     // Wave management
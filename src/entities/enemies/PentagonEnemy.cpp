@@ -1,5 +1,7 @@
 #include "PentagonEnemy.h"
 #include "../player/PlayerManager.h"
+#include "../../core/ParticleSystem.h"
+#include "../../core/QualityGovernor.h"
 #include <cmath>
 #include <iostream>
 #include <algorithm>
@@ -253,18 +255,6 @@ void PentagonEnemy::UpdateMovement(float dt, PlayerManager& playerManager) {
         rotationAngle -= 360.0f;
     }
     
-    // Update afterimages
-    for (auto& afterImage : afterImages) {
-        afterImage.lifetime -= dt;
-        afterImage.alpha = afterImage.lifetime; // Alpha fades with lifetime
-    }
-    
-    // Remove expired afterimages
-    afterImages.erase(
-        std::remove_if(afterImages.begin(), afterImages.end(), 
-                      [](const AfterImage& img) { return img.lifetime <= 0.0f; }),
-        afterImages.end());
-    
     // Update behavior state machine
     UpdateBehavior(dt);
     
@@ -305,7 +295,7 @@ void PentagonEnemy::UpdateBehavior(float dt) {
                 // Choose next behavior based on distance to player
                 if (targetPlayerDistance < 150.0f) {
                     // When close, either charge or teleport
-                    if (rand() % 2 == 0) {
+                    if (NextRandom() % 2 == 0) {
                         currentBehavior = PentagonBehavior::Charging;
                         chargingUp = true;
                         isCharging = false;
@@ -316,8 +306,8 @@ void PentagonEnemy::UpdateBehavior(float dt) {
                         teleportProgress = 0.0f;
                         
                         // Choose teleport destination
-                        float angle = (rand() % 360) * PI / 180.0f;
-                        float distance = 200.0f + (rand() % 100);
+                        float angle = (NextRandom() % 360) * PI / 180.0f;
+                        float distance = 200.0f + (NextRandom() % 100);
                         teleportDestination = targetPosition + sf::Vector2f(cos(angle) * distance, sin(angle) * distance);
                         
                         // Add initial afterimage
@@ -325,12 +315,13 @@ void PentagonEnemy::UpdateBehavior(float dt) {
                     }
                 } else if (targetPlayerDistance < 300.0f) {
                     // At medium range, start pulsating or encircling
-                    if (rand() % 2 == 0) {
+                    if (NextRandom() % 2 == 0) {
                         currentBehavior = PentagonBehavior::Pulsating;
                         pulsePhase = 0.0f;
                         pulseCount = 0;
                     } else {
                         currentBehavior = PentagonBehavior::Encircling;
+                        formationSeed = NextRandom();
                         GenerateEncirclingFormation();
                         currentFormationIndex = 0;
                     }
@@ -377,7 +368,7 @@ void PentagonEnemy::UpdateBehavior(float dt) {
         case PentagonBehavior::Encircling:
             // After completing the formation or if player moves too far, change behavior
             if (currentFormationIndex >= formationPositions.size() || targetPlayerDistance > 400.0f) {
-                if (rand() % 2 == 0 && targetPlayerDistance < 250.0f) {
+                if (NextRandom() % 2 == 0 && targetPlayerDistance < 250.0f) {
                     currentBehavior = PentagonBehavior::Teleporting;
                     isTeleporting = true;
                     teleportProgress = 0.0f;
@@ -390,7 +381,7 @@ void PentagonEnemy::UpdateBehavior(float dt) {
                         teleportDestination = targetPosition - playerToEnemy * 150.0f;
                     } else {
                         // Random angle if directly on top of player
-                        float angle = (rand() % 360) * PI / 180.0f;
+                        float angle = (NextRandom() % 360) * PI / 180.0f;
                         teleportDestination = targetPosition + sf::Vector2f(cos(angle) * 150.0f, sin(angle) * 150.0f);
                     }
                     
@@ -406,7 +397,7 @@ void PentagonEnemy::UpdateBehavior(float dt) {
         case PentagonBehavior::Teleporting:
             // After teleport completes, return to stalking or start charging
             if (!isTeleporting) {
-                if (targetPlayerDistance < 150.0f && rand() % 2 == 0) {
+                if (targetPlayerDistance < 150.0f && NextRandom() % 2 == 0) {
                     currentBehavior = PentagonBehavior::Charging;
                     chargingUp = true;
                     isCharging = false;
@@ -423,6 +414,7 @@ void PentagonEnemy::UpdateBehavior(float dt) {
     if (lastBehavior != currentBehavior) {
         stateTransitionTimer = 0.0f;
         behaviorTimer = 0.0f;
+        behaviorDirty = true;
     }
 }
 
@@ -460,7 +452,7 @@ void PentagonEnemy::HandleStalkingBehavior(float dt) {
         speedMultiplier = 0.8f;
         
         // Occasionally reverse circling direction
-        if (rand() % 100 < 1) {
+        if (NextRandom() % 100 < 1) {
             moveDirection = -moveDirection;
         }
     }
@@ -688,55 +680,120 @@ void PentagonEnemy::GenerateEncirclingFormation() {
     }
     
     // Shuffle the formation positions to create more unpredictable movement
-    // Use a simple swap-based shuffle
+    // Use a simple swap-based shuffle, driven by the replicated formation seed
+    uint32_t shuffleState = formationSeed != 0 ? formationSeed : 1;
     for (int i = 0; i < formationPositions.size(); i++) {
-        int j = rand() % formationPositions.size();
+        int j = NextRandom(shuffleState) % formationPositions.size();
         std::swap(formationPositions[i], formationPositions[j]);
     }
 }
 
-void PentagonEnemy::ClearAfterImages() {
-    afterImages.clear();
+bool PentagonEnemy::SerializeBehavior(std::vector<uint8_t>& out) const {
+    SerializeCommonBehavior(out);
+    
+    BehaviorState state;
+    state.behaviorTimer = behaviorTimer;
+    state.stateTransitionTimer = stateTransitionTimer;
+    state.chargeEnergy = chargeEnergy;
+    state.teleportProgress = teleportProgress;
+    state.teleportDestinationX = teleportDestination.x;
+    state.teleportDestinationY = teleportDestination.y;
+    state.pulsePhase = pulsePhase;
+    state.rotationAngle = rotationAngle;
+    state.formationSeed = formationSeed;
+    state.behavior = static_cast<uint8_t>(currentBehavior);
+    state.flags = (chargingUp ? BEHAVIOR_FLAG_CHARGING_UP : 0) |
+                  (isCharging ? BEHAVIOR_FLAG_CHARGING : 0) |
+                  (isTeleporting ? BEHAVIOR_FLAG_TELEPORTING : 0);
+    state.pulseCount = static_cast<uint8_t>(std::min(pulseCount, 255));
+    state.formationIndex = static_cast<uint8_t>(std::min(currentFormationIndex, 255));
+    state.Write(out);
+    return true;
+}
+
+void PentagonEnemy::BehaviorState::Write(std::vector<uint8_t>& out) const {
+    WriteState(out, behaviorTimer);
+    WriteState(out, stateTransitionTimer);
+    WriteState(out, chargeEnergy);
+    WriteState(out, teleportProgress);
+    WriteState(out, teleportDestinationX);
+    WriteState(out, teleportDestinationY);
+    WriteState(out, pulsePhase);
+    WriteState(out, rotationAngle);
+    WriteState(out, formationSeed);
+    WriteState(out, behavior);
+    WriteState(out, flags);
+    WriteState(out, pulseCount);
+    WriteState(out, formationIndex);
+}
+
+bool PentagonEnemy::BehaviorState::Read(const uint8_t*& cursor, const uint8_t* end) {
+    return ReadState(cursor, end, behaviorTimer) &&
+           ReadState(cursor, end, stateTransitionTimer) &&
+           ReadState(cursor, end, chargeEnergy) &&
+           ReadState(cursor, end, teleportProgress) &&
+           ReadState(cursor, end, teleportDestinationX) &&
+           ReadState(cursor, end, teleportDestinationY) &&
+           ReadState(cursor, end, pulsePhase) &&
+           ReadState(cursor, end, rotationAngle) &&
+           ReadState(cursor, end, formationSeed) &&
+           ReadState(cursor, end, behavior) &&
+           ReadState(cursor, end, flags) &&
+           ReadState(cursor, end, pulseCount) &&
+           ReadState(cursor, end, formationIndex);
+}
+
+bool PentagonEnemy::DeserializeBehavior(const uint8_t*& cursor, const uint8_t* end) {
+    BehaviorState state;
+    if (!DeserializeCommonBehavior(cursor, end) || !state.Read(cursor, end)) return false;
+    if (state.behavior > static_cast<uint8_t>(PentagonBehavior::Teleporting)) return false;
+    
+    behaviorTimer = state.behaviorTimer;
+    stateTransitionTimer = state.stateTransitionTimer;
+    chargeEnergy = state.chargeEnergy;
+    teleportProgress = state.teleportProgress;
+    teleportDestination = sf::Vector2f(state.teleportDestinationX, state.teleportDestinationY);
+    pulsePhase = state.pulsePhase;
+    rotationAngle = state.rotationAngle;
+    currentBehavior = static_cast<PentagonBehavior>(state.behavior);
+    lastBehavior = currentBehavior;
+    chargingUp = (state.flags & BEHAVIOR_FLAG_CHARGING_UP) != 0;
+    isCharging = (state.flags & BEHAVIOR_FLAG_CHARGING) != 0;
+    isTeleporting = (state.flags & BEHAVIOR_FLAG_TELEPORTING) != 0;
+    pulseCount = state.pulseCount;
+    currentFormationIndex = state.formationIndex;
+    
+    // The formation itself is rebuilt from its seed rather than sent
+    if (state.formationSeed != formationSeed || formationPositions.empty()) {
+        formationSeed = state.formationSeed;
+        GenerateEncirclingFormation();
+    }
+    UpdateAxes();
+    return true;
 }
 
 void PentagonEnemy::AddAfterImage(float lifetime) {
-    // Create a new afterimage at the current position
-    AfterImage image;
+    // Lower quality tiers only keep every Nth afterimage
+    int stride = QualityGovernor::Get().GetProfile().afterImageStride;
+    if (afterImageCounter++ % stride != 0) return;
+    
+    // Afterimages are pooled particles that stay put and fade out
+    ParticleDesc image;
     image.position = position;
     image.lifetime = lifetime;
-    image.alpha = 1.0f;
-    
-    // Add to the collection
-    afterImages.push_back(image);
-    
-    // Limit the number of afterimages
-    if (afterImages.size() > 10) {
-        afterImages.pop_front();
-    }
+    image.size = PENTAGON_SIZE / 2.0f;
+    image.shrink = 0.0f;
+    image.rotation = rotationAngle;
+    image.sides = 5;
+    image.color = shape.getFillColor();
+    image.color.a = PENTAGON_AFTERIMAGE_ALPHA;
+    
+    ParticleSystem::Get().Emit(image);
 }
 
-void PentagonEnemy::Render(sf::RenderWindow& window) {
+void PentagonEnemy::Render(RenderSnapshot& frame) {
     if (IsDead()) return;
     
-    // First render any afterimages
-    for (const auto& afterImage : afterImages) {
-        // Create a copy of the shape for the afterimage
-        sf::ConvexShape afterImageShape = shape;
-        afterImageShape.setPosition(afterImage.position);
-        
-        // Set color with transparency based on lifetime
-        sf::Color color = shape.getFillColor();
-        color.a = static_cast<sf::Uint8>(255 * afterImage.alpha * 0.5f); // 50% max opacity
-        afterImageShape.setFillColor(color);
-        
-        sf::Color outlineColor = shape.getOutlineColor();
-        outlineColor.a = static_cast<sf::Uint8>(255 * afterImage.alpha * 0.7f); // 70% max opacity
-        afterImageShape.setOutlineColor(outlineColor);
-        
-        // Draw the afterimage
-        window.draw(afterImageShape);
-    }
-    
     // Don't render the main shape during teleportation fade-out
     if (isTeleporting && teleportProgress < 0.5f) {
         // Create a fading version of the shape
@@ -753,7 +810,7 @@ void PentagonEnemy::Render(sf::RenderWindow& window) {
         fadingShape.setFillColor(fillColor);
         fadingShape.setOutlineColor(outlineColor);
         
-        window.draw(fadingShape);
+        frame.Draw(fadingShape);
     } else if (isTeleporting && teleportProgress >= 0.5f) {
         // Create a fading-in version of the shape
         sf::ConvexShape fadingShape = shape;
@@ -769,10 +826,10 @@ void PentagonEnemy::Render(sf::RenderWindow& window) {
         fadingShape.setFillColor(fillColor);
         fadingShape.setOutlineColor(outlineColor);
         
-        window.draw(fadingShape);
+        frame.Draw(fadingShape);
     } else {
         // Normal rendering
-        window.draw(shape);
+        frame.Draw(shape);
     }
     
     // Debug visualization: Draw the five axis lines
@@ -786,7 +843,7 @@ void PentagonEnemy::Render(sf::RenderWindow& window) {
             sf::Vertex(position, lineColor),
             sf::Vertex(position + axis * lineLength, lineColor)
         };
-        window.draw(line, 2, sf::Lines);
+        frame.Draw(line, 2, sf::Lines);
     }*/
     
     // Debug visualization: Draw encircling formation points
@@ -796,7 +853,7 @@ void PentagonEnemy::Render(sf::RenderWindow& window) {
             point.setFillColor(i == currentFormationIndex ? sf::Color::Red : sf::Color::Yellow);
             point.setOrigin(3.0f, 3.0f);
             point.setPosition(targetPosition + formationPositions[i]);
-            window.draw(point);
+            frame.Draw(point);
         }
     }*/
 }
\ No newline at end of file
@@ -4,7 +4,6 @@
 #include "Enemy.h"
 #include "../../utils/config/EnemyConfig.h"
 #include <SFML/Graphics.hpp>
-#include <deque>
 
 // Forward declarations
 class PlayerManager;
@@ -29,16 +28,42 @@ public:
     ~PentagonEnemy() override = default;
     
     void FindTarget(PlayerManager& playerManager) override;
-    void Render(sf::RenderWindow& window) override;
+    void Render(RenderSnapshot& frame) override;
     EnemyType GetType() const override { return EnemyType::Pentagon; }
+    bool ReplicatesBehavior() const override { return true; }
     
     std::vector<sf::Vector2f> GetAxes() const;
     
 protected:
     void UpdateVisualRepresentation() override;
     void UpdateMovement(float dt, PlayerManager& playerManager) override;
+    bool SerializeBehavior(std::vector<uint8_t>& out) const override;
+    bool DeserializeBehavior(const uint8_t*& cursor, const uint8_t* end) override;
     
 private:
+    // Replicated behaviour state machine, sent as one block after the common state
+    struct BehaviorState {
+        float behaviorTimer;
+        float stateTransitionTimer;
+        float chargeEnergy;
+        float teleportProgress;
+        float teleportDestinationX;
+        float teleportDestinationY;
+        float pulsePhase;
+        float rotationAngle;
+        uint32_t formationSeed;
+        uint8_t behavior;
+        uint8_t flags;   // BEHAVIOR_FLAG_*
+        uint8_t pulseCount;
+        uint8_t formationIndex;
+        
+        void Write(std::vector<uint8_t>& out) const;
+        bool Read(const uint8_t*& cursor, const uint8_t* end);
+    };
+    static constexpr uint8_t BEHAVIOR_FLAG_CHARGING_UP = 1;
+    static constexpr uint8_t BEHAVIOR_FLAG_CHARGING = 2;
+    static constexpr uint8_t BEHAVIOR_FLAG_TELEPORTING = 4;
+    
     void InitializeAxes();
     sf::ConvexShape shape;
     std::vector<sf::Vector2f> axes;
@@ -69,17 +94,12 @@ private:
     bool chargingUp;
     bool isCharging;
     
-    // Afterimage and teleportation system
-    struct AfterImage {
-        sf::Vector2f position;
-        float lifetime;
-        float alpha;
-    };
-    std::deque<AfterImage> afterImages;
+    // Teleportation system (afterimages are emitted into the ParticleSystem)
     bool isTeleporting;
     sf::Vector2f teleportDestination;
     float teleportProgress;
     float teleportDuration;
+    int afterImageCounter = 0;    // Used to thin afterimages at lower quality tiers
     
     // Pulsating system
     float pulsePhase;
@@ -93,10 +113,10 @@ private:
     int currentFormationIndex;
     float formationRadius;
     float formationAngle;
+    uint32_t formationSeed = 0;   // Seeds the formation shuffle so clients rebuild the same one
     
     // Pattern creation
     void GenerateEncirclingFormation();
-    void ClearAfterImages();
     void AddAfterImage(float lifetime = 1.0f);
     
     // Behavior methods
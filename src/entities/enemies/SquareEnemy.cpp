@@ -277,7 +277,7 @@ void SquareEnemy::UpdateMovementPhase(float dt) {
         case MovementPhase::FlyBy:
             // After the fly-by duration, switch to orbiting or retreating
             if (phaseTimer > flyByDuration) {
-                if (targetPlayerDistance < 150.0f && rand() % 2 == 0) { // 50% chance
+                if (targetPlayerDistance < 150.0f && NextRandom() % 2 == 0) { // 50% chance
                     movementPhase = MovementPhase::Orbiting;
                 } else {
                     movementPhase = MovementPhase::Retreating;
@@ -290,7 +290,7 @@ void SquareEnemy::UpdateMovementPhase(float dt) {
         case MovementPhase::Orbiting:
             // After orbiting for a while, go back to seeking or do another fly-by
             if (phaseTimer > 3.0f) {
-                if (targetPlayerDistance < 150.0f && rand() % 3 == 0) { // 33% chance
+                if (targetPlayerDistance < 150.0f && NextRandom() % 3 == 0) { // 33% chance
                     movementPhase = MovementPhase::FlyBy;
                     flyByTimer = 0.0f;
                     flyByActive = true;
@@ -318,9 +318,69 @@ void SquareEnemy::UpdateMovementPhase(float dt) {
     // Reset directionChangeTimer if we changed state
     if (lastState != movementPhase) {
         directionChangeTimer = 0.0f;
+        behaviorDirty = true;
     }
 }
 
+bool SquareEnemy::SerializeBehavior(std::vector<uint8_t>& out) const {
+    SerializeCommonBehavior(out);
+    
+    BehaviorState state;
+    state.phaseTimer = phaseTimer;
+    state.flyByTimer = flyByTimer;
+    state.directionChangeTimer = directionChangeTimer;
+    state.rotationAngle = rotationAngle;
+    state.orbitSpeedMultiplier = orbitSpeedMultiplier;
+    state.flyByDirectionX = flyByDirection.x;
+    state.flyByDirectionY = flyByDirection.y;
+    state.movementPhase = static_cast<uint8_t>(movementPhase);
+    state.flyByActive = flyByActive ? 1 : 0;
+    state.Write(out);
+    return true;
+}
+
+void SquareEnemy::BehaviorState::Write(std::vector<uint8_t>& out) const {
+    WriteState(out, phaseTimer);
+    WriteState(out, flyByTimer);
+    WriteState(out, directionChangeTimer);
+    WriteState(out, rotationAngle);
+    WriteState(out, orbitSpeedMultiplier);
+    WriteState(out, flyByDirectionX);
+    WriteState(out, flyByDirectionY);
+    WriteState(out, movementPhase);
+    WriteState(out, flyByActive);
+}
+
+bool SquareEnemy::BehaviorState::Read(const uint8_t*& cursor, const uint8_t* end) {
+    return ReadState(cursor, end, phaseTimer) &&
+           ReadState(cursor, end, flyByTimer) &&
+           ReadState(cursor, end, directionChangeTimer) &&
+           ReadState(cursor, end, rotationAngle) &&
+           ReadState(cursor, end, orbitSpeedMultiplier) &&
+           ReadState(cursor, end, flyByDirectionX) &&
+           ReadState(cursor, end, flyByDirectionY) &&
+           ReadState(cursor, end, movementPhase) &&
+           ReadState(cursor, end, flyByActive);
+}
+
+bool SquareEnemy::DeserializeBehavior(const uint8_t*& cursor, const uint8_t* end) {
+    BehaviorState state;
+    if (!DeserializeCommonBehavior(cursor, end) || !state.Read(cursor, end)) return false;
+    if (state.movementPhase > static_cast<uint8_t>(MovementPhase::Retreating)) return false;
+    
+    phaseTimer = state.phaseTimer;
+    flyByTimer = state.flyByTimer;
+    directionChangeTimer = state.directionChangeTimer;
+    rotationAngle = state.rotationAngle;
+    orbitSpeedMultiplier = state.orbitSpeedMultiplier;
+    flyByDirection = sf::Vector2f(state.flyByDirectionX, state.flyByDirectionY);
+    movementPhase = static_cast<MovementPhase>(state.movementPhase);
+    lastState = movementPhase;
+    flyByActive = state.flyByActive != 0;
+    UpdateAxes();
+    return true;
+}
+
 void SquareEnemy::HandleSeekingMovement(float dt) {
     if (!hasTarget) return;
     
@@ -446,7 +506,7 @@ void SquareEnemy::HandleOrbitingMovement(float dt) {
     position += velocity * dt;
     
     // Occasionally reverse the orbit direction
-    if (directionChangeTimer > 2.0f && rand() % 10 == 0) {
+    if (directionChangeTimer > 2.0f && NextRandom() % 10 == 0) {
         orbitSpeedMultiplier = -orbitSpeedMultiplier;
         directionChangeTimer = 0.0f;
     }
@@ -499,15 +559,15 @@ void SquareEnemy::HandleRetreatMovement(float dt) {
             sf::Vector2f zigzagDirection = axes[zigzagAxis];
             
             // Apply a zigzag movement
-            position += zigzagDirection * (10.0f * (rand() % 2 == 0 ? 1.0f : -1.0f));
+            position += zigzagDirection * (10.0f * (NextRandom() % 2 == 0 ? 1.0f : -1.0f));
         }
     }
 }
 
-void SquareEnemy::Render(sf::RenderWindow& window) {
+void SquareEnemy::Render(RenderSnapshot& frame) {
     if (!IsDead()) {
         // Draw the square
-        window.draw(shape);
+        frame.Draw(shape);
         
         // Debug visualization: Draw the four axis lines
         /*for (int i = 0; i < axes.size(); i++) {
@@ -520,7 +580,7 @@ void SquareEnemy::Render(sf::RenderWindow& window) {
                 sf::Vertex(position, lineColor),
                 sf::Vertex(position + axis * lineLength, lineColor)
             };
-            window.draw(line, 2, sf::Lines);
+            frame.Draw(line, 2, sf::Lines);
         }*/
     }
 }
\ No newline at end of file
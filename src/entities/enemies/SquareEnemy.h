@@ -27,16 +27,35 @@ public:
     ~SquareEnemy() override = default;
     
     void FindTarget(PlayerManager& playerManager) override;
-    void Render(sf::RenderWindow& window) override;
+    void Render(RenderSnapshot& frame) override;
     EnemyType GetType() const override { return EnemyType::Square; }
+    bool ReplicatesBehavior() const override { return true; }
     
     std::vector<sf::Vector2f> GetAxes() const;
     
 protected:
     void UpdateVisualRepresentation() override;
     void UpdateMovement(float dt, PlayerManager& playerManager) override;
+    bool SerializeBehavior(std::vector<uint8_t>& out) const override;
+    bool DeserializeBehavior(const uint8_t*& cursor, const uint8_t* end) override;
     
 private:
+    // Replicated movement state machine, sent as one block after the common state
+    struct BehaviorState {
+        float phaseTimer;
+        float flyByTimer;
+        float directionChangeTimer;
+        float rotationAngle;
+        float orbitSpeedMultiplier;
+        float flyByDirectionX;
+        float flyByDirectionY;
+        uint8_t movementPhase;
+        uint8_t flyByActive;
+        
+        void Write(std::vector<uint8_t>& out) const;
+        bool Read(const uint8_t*& cursor, const uint8_t* end);
+    };
+    
     void InitializeAxes();
     sf::ConvexShape shape;
     std::vector<sf::Vector2f> axes;
@@ -87,8 +87,8 @@ void TriangleEnemy::UpdateMovement(float dt, PlayerManager& playerManager) {
     }
 }
 
-void TriangleEnemy::Render(sf::RenderWindow& window) {
+void TriangleEnemy::Render(RenderSnapshot& frame) {
     if (!IsDead()) {
-        window.draw(shape);
+        frame.Draw(shape);
     }
 }
\ No newline at end of file
@@ -13,7 +13,7 @@ public:
     TriangleEnemy(int id, const sf::Vector2f& position, float health = TRIANGLE_HEALTH, float speed = ENEMY_SPEED);
     ~TriangleEnemy() override = default;
     void FindTarget(PlayerManager& playerManager) override;
-    void Render(sf::RenderWindow& window) override;
+    void Render(RenderSnapshot& frame) override;
     EnemyType GetType() const override { return EnemyType::Triangle; }
 
 protected:
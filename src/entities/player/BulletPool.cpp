@@ -0,0 +1,101 @@
+#include "BulletPool.h"
+
+BulletPool::BulletPool()
+    : count(0),
+      vertices(sf::Triangles) {
+    posX.resize(BULLET_POOL_CAPACITY, 0.f);
+    posY.resize(BULLET_POOL_CAPACITY, 0.f);
+    prevX.resize(BULLET_POOL_CAPACITY, 0.f);
+    prevY.resize(BULLET_POOL_CAPACITY, 0.f);
+    velX.resize(BULLET_POOL_CAPACITY, 0.f);
+    velY.resize(BULLET_POOL_CAPACITY, 0.f);
+    lifetime.resize(BULLET_POOL_CAPACITY, 0.f);
+    shooter.resize(BULLET_POOL_CAPACITY, BULLET_INVALID_SHOOTER);
+    rewind.resize(BULLET_POOL_CAPACITY, 0);
+    
+    // Reserve room for a full pool of quads, then drop the contents
+    vertices.resize(BULLET_POOL_CAPACITY * 6);
+    vertices.clear();
+}
+
+bool BulletPool::Spawn(uint8_t shooterIndex, const sf::Vector2f& position, const sf::Vector2f& velocity, uint8_t rewindTicks) {
+    if (count >= BULLET_POOL_CAPACITY || shooterIndex == BULLET_INVALID_SHOOTER) {
+        return false;
+    }
+    
+    size_t i = count++;
+    posX[i] = prevX[i] = position.x;
+    posY[i] = prevY[i] = position.y;
+    velX[i] = velocity.x;
+    velY[i] = velocity.y;
+    lifetime[i] = BULLET_LIFETIME;
+    shooter[i] = shooterIndex;
+    rewind[i] = rewindTicks;
+    return true;
+}
+
+void BulletPool::Update(float dt) {
+    for (size_t i = 0; i < count; i++) {
+        prevX[i] = posX[i];
+        prevY[i] = posY[i];
+        posX[i] += velX[i] * dt;
+        posY[i] += velY[i] * dt;
+        lifetime[i] -= dt;
+    }
+}
+
+void BulletPool::Remove(size_t index) {
+    if (index >= count) return;
+    
+    size_t last = --count;
+    if (index != last) {
+        posX[index] = posX[last];
+        posY[index] = posY[last];
+        prevX[index] = prevX[last];
+        prevY[index] = prevY[last];
+        velX[index] = velX[last];
+        velY[index] = velY[last];
+        lifetime[index] = lifetime[last];
+        shooter[index] = shooter[last];
+        rewind[index] = rewind[last];
+    }
+}
+
+void BulletPool::Clear() {
+    count = 0;
+}
+
+void BulletPool::ReassignShooter(uint8_t from, uint8_t to) {
+    for (size_t i = 0; i < count; i++) {
+        if (shooter[i] == from) {
+            shooter[i] = to;
+        }
+    }
+}
+
+void BulletPool::Render(RenderSnapshot& frame, float alpha) const {
+    vertices.clear();
+    if (count == 0) return;
+    
+    const float half = BULLET_RADIUS / 2.0f;
+    const sf::Color color = BULLET_COLOR;
+    
+    for (size_t i = 0; i < count; i++) {
+        float x = prevX[i] + (posX[i] - prevX[i]) * alpha;
+        float y = prevY[i] + (posY[i] - prevY[i]) * alpha;
+        
+        sf::Vector2f topLeft(x - half, y - half);
+        sf::Vector2f topRight(x + half, y - half);
+        sf::Vector2f bottomRight(x + half, y + half);
+        sf::Vector2f bottomLeft(x - half, y + half);
+        
+        vertices.append(sf::Vertex(topLeft, color));
+        vertices.append(sf::Vertex(topRight, color));
+        vertices.append(sf::Vertex(bottomRight, color));
+        vertices.append(sf::Vertex(topLeft, color));
+        vertices.append(sf::Vertex(bottomRight, color));
+        vertices.append(sf::Vertex(bottomLeft, color));
+    }
+    
+    frame.Draw(vertices);
+}
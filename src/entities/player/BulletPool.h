@@ -0,0 +1,55 @@
+#ifndef BULLET_POOL_H
+#define BULLET_POOL_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "../../utils/config/BulletConfig.h"
+#include "../../render/RenderSnapshot.h"
+
+// Every live bullet in the session, stored structure-of-arrays.
+//
+// Live bullets are packed densely in [0, size), so spawning appends and removal
+// swaps the last bullet into the hole. Iterate from the back when removing while
+// looping. Shooters are referenced by their PlayerRegistry index, and the render
+// quads are generated at draw time, so steady-state firing never touches the heap.
+class BulletPool {
+public:
+    BulletPool();
+    
+    // Returns false when the pool is full and the bullet was dropped. rewindTicks is how many
+    // ticks behind the host the shooter saw the world (lag compensation, host only).
+    bool Spawn(uint8_t shooter, const sf::Vector2f& position, const sf::Vector2f& velocity, uint8_t rewindTicks = 0);
+    void Update(float dt);
+    void Remove(size_t index);
+    void Clear();
+    
+    // Re-tags in-flight bullets when their shooter moves to another slot
+    void ReassignShooter(uint8_t from, uint8_t to);
+    
+    size_t Size() const { return count; }
+    bool Empty() const { return count == 0; }
+    
+    sf::Vector2f GetPosition(size_t index) const { return sf::Vector2f(posX[index], posY[index]); }
+    sf::Vector2f GetPreviousPosition(size_t index) const { return sf::Vector2f(prevX[index], prevY[index]); }
+    sf::Vector2f GetVelocity(size_t index) const { return sf::Vector2f(velX[index], velY[index]); }
+    bool IsExpired(size_t index) const { return lifetime[index] <= 0.f; }
+    uint8_t GetShooter(size_t index) const { return shooter[index]; }
+    uint8_t GetRewind(size_t index) const { return rewind[index]; }
+    
+    // Draws every bullet as one batch, blended alpha of the way between ticks
+    void Render(RenderSnapshot& frame, float alpha) const;
+    
+private:
+    std::vector<float> posX, posY;
+    std::vector<float> prevX, prevY;     // Positions before the last tick
+    std::vector<float> velX, velY;
+    std::vector<float> lifetime;
+    std::vector<uint8_t> shooter;
+    std::vector<uint8_t> rewind;         // Lag compensation ticks
+    size_t count;
+    
+    mutable sf::VertexArray vertices;    // Scratch for Render, rebuilt every draw
+};
+
+#endif // BULLET_POOL_H
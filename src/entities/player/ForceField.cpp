@@ -1,14 +1,21 @@
 #include "ForceField.h"
 #include "Player.h"
 #include "PlayerManager.h"
+#include "LightningTemplates.h"
 #include "../enemies/EnemyManager.h"
 #include "../enemies/Enemy.h"
-#include "../../core/Game.h"
+#include "../../core/ParticleSystem.h"
+#include "../../core/QualityGovernor.h"
+#include "../../core/Profiler.h"
 #include <cmath>
 #include <iostream>
 #include <random>
 #include <array>
 
+const std::vector<sf::Vector2f> ForceField::unitCircle = ForceField::buildUnitCircle(FIELD_BATCH_CIRCLE_SEGMENTS);
+const std::vector<sf::Vector2f> ForceField::unitSparkleCircle = ForceField::buildUnitCircle(FIELD_BATCH_PARTICLE_SEGMENTS);
+const std::vector<sf::Vector2f> ForceField::unitPowerMarker = ForceField::buildUnitCircle(POWER_MARKER_SIDES);
+
 // Enhanced constructor with more visual flair and gameplay options
 ForceField::ForceField(Player* player, float radius)
     : player(player),
@@ -170,8 +177,10 @@ ForceField::ForceField(Player* player, float radius)
     chainEffect.setPrimitiveType(sf::Lines);
     chainEffect.resize(0);
     
-    // Initialize particles system
-    initializeParticles();
+    // Setup the render batch and reserve room so steady-state frames don't reallocate
+    fieldBatch.setPrimitiveType(sf::Triangles);
+    fieldBatch.resize(FIELD_BATCH_RESERVE_VERTICES);
+    fieldBatch.clear();
     
     // Fire initial zap quickly
     zapTimer = INITIAL_ZAP_TIMER;
@@ -180,12 +189,9 @@ ForceField::ForceField(Player* player, float radius)
     updateFieldColor();
 }
 
-void ForceField::Update(float dt, PlayerManager& playerManager, EnemyManager& enemyManager) {
+void ForceField::UpdateField(float dt) {
     // Skip if player is dead
-    if (player->IsDead()) {
-        isZapping = false;
-        return;
-    }
+    if (player->IsDead()) return;
     
     // Update the force field position to follow the player
     sf::Vector2f playerCenter = player->GetPosition() + sf::Vector2f(25.0f, 25.0f);
@@ -248,7 +254,7 @@ void ForceField::Update(float dt, PlayerManager& playerManager, EnemyManager& en
     }
     
     // Update particles
-    updateParticles(dt, playerCenter);
+    updateParticles(playerCenter);
     
     // Update combo timer
     if (consecutiveHits > 0) {
@@ -262,6 +268,15 @@ void ForceField::Update(float dt, PlayerManager& playerManager, EnemyManager& en
     if (!isZapping) {
         chargeLevel = std::max(0.0f, chargeLevel - dt * FIELD_CHARGE_DECAY_RATE);
     }
+}
+
+void ForceField::UpdateZapping(float dt, PlayerManager& playerManager, EnemyManager& enemyManager) {
+    PROFILE_SCOPE("ForceField::UpdateZapping");
+    // Skip if player is dead
+    if (player->IsDead()) {
+        isZapping = false;
+        return;
+    }
     
     // Update zap effect timer
     if (isZapping) {
@@ -270,6 +285,10 @@ void ForceField::Update(float dt, PlayerManager& playerManager, EnemyManager& en
             isZapping = false;
             zapEffect.resize(0);
             chainEffect.resize(0);
+            zapBolt.shape = nullptr;
+            chainBolts.clear();
+        } else if (ZAP_TEMPLATE_JITTER > 0.0f) {
+            rebuildLightning();
         }
     }
     
@@ -289,36 +308,43 @@ void ForceField::Update(float dt, PlayerManager& playerManager, EnemyManager& en
     updateFieldColor();
 }
 
-void ForceField::Render(sf::RenderWindow& window) {
+void ForceField::Render(RenderSnapshot& frame) {
+    PROFILE_SCOPE("ForceField::Render");
     // Skip if player is dead
     if (player->IsDead()) return;
     
     // Get player position
     sf::Vector2f playerCenter = player->GetPosition() + sf::Vector2f(25.0f, 25.0f);
     
-    // Render particles behind everything else
-    renderParticles(window);
+    // Rebuild this frame's geometry; clear() keeps the vertex capacity
+    fieldBatch.clear();
     
-    // Render field rings
+    // Render field rings (outline only)
     for (int i = 0; i < NUM_FIELD_RINGS; i++) {
-        window.draw(fieldRings[i]);
+        batchRing(fieldRings[i].getPosition(), fieldRings[i].getRadius(), fieldRings[i].getOutlineThickness(),
+                  fieldRings[i].getOutlineColor(), unitCircle);
     }
     
     // Render main force field
-    window.draw(fieldShape);
+    batchCircle(fieldShape.getPosition(), fieldShape.getRadius(), fieldShape.getFillColor(), unitCircle);
+    batchRing(fieldShape.getPosition(), fieldShape.getRadius(), fieldShape.getOutlineThickness(),
+              fieldShape.getOutlineColor(), unitCircle);
     
     // Render energy orbs
     for (int i = 0; i < NUM_ENERGY_ORBS; i++) {
-        window.draw(energyOrbs[i]);
+        batchCircle(energyOrbs[i].getPosition(), energyOrbs[i].getRadius(), energyOrbs[i].getFillColor(), unitCircle);
     }
     
     // Render zap effects if active
     if (isZapping) {
-        renderZapEffects(window);
+        renderZapEffects();
     }
     
     // Render power level indicator
-    renderPowerIndicator(window, playerCenter);
+    renderPowerIndicator(playerCenter);
+    
+    // Everything above goes out in a single draw call
+    frame.Draw(fieldBatch);
 }
 
 // This method needs to be updated in ForceField.cpp to properly handle kills
@@ -425,171 +451,78 @@ void ForceField::FindAndZapEnemy(PlayerManager& playerManager, EnemyManager& ene
 }
 
 void ForceField::CreateZapEffect(const sf::Vector2f& start, const sf::Vector2f& end) {
-    // Clear existing effect
-    zapEffect.clear();
-    
-    // Number of line segments for the zap - more at higher power levels
-    const int segments = ZAP_BASE_SEGMENTS + powerLevel * ZAP_SEGMENTS_PER_POWER;
-    
-    // Direction vector
-    sf::Vector2f direction = end - start;
-    float distance = std::hypot(direction.x, direction.y);
-    
-    if (distance < 0.001f) return; // Prevent division by zero
-    
-    // Normalized perpendicular vector for zig-zag
-    sf::Vector2f perpendicular(-direction.y / distance, direction.x / distance);
-    
-    // Determine zap color based on field type
-    sf::Color zapBaseColor;
-    sf::Color zapBrightColor;
-    
+    // Pick a pre-generated bolt for this power level; the geometry is only mapped
+    // onto start->end, never generated here
+    zapBolt.shape = &LightningTemplates::Get().PickBolt(powerLevel);
+    zapBolt.start = start;
+    zapBolt.end = end;
+    zapBolt.mirrored = (rand() % 2 == 0);
+    
+    rebuildLightning();
+}
+
+void ForceField::getZapColors(sf::Color& baseColor, sf::Color& brightColor) const {
     switch (fieldType) {
         case FieldType::SHOCK:
-            zapBaseColor = ZAP_SHOCK_BASE_COLOR;
-            zapBrightColor = ZAP_SHOCK_BRIGHT_COLOR;
+            baseColor = ZAP_SHOCK_BASE_COLOR;
+            brightColor = ZAP_SHOCK_BRIGHT_COLOR;
             break;
         case FieldType::PLASMA:
-            zapBaseColor = ZAP_PLASMA_BASE_COLOR;
-            zapBrightColor = ZAP_PLASMA_BRIGHT_COLOR;
+            baseColor = ZAP_PLASMA_BASE_COLOR;
+            brightColor = ZAP_PLASMA_BRIGHT_COLOR;
             break;
         case FieldType::VORTEX:
-            zapBaseColor = ZAP_VORTEX_BASE_COLOR;
-            zapBrightColor = ZAP_VORTEX_BRIGHT_COLOR;
+            baseColor = ZAP_VORTEX_BASE_COLOR;
+            brightColor = ZAP_VORTEX_BRIGHT_COLOR;
             break;
         default:
-            zapBaseColor = ZAP_STANDARD_BASE_COLOR;
-            zapBrightColor = ZAP_STANDARD_BRIGHT_COLOR;
-    }
-    
-    // Create a jagged lightning effect with power level influencing complexity
-    sf::Vector2f currentPos = start;
-    for (int i = 0; i < segments; i++) {
-        // Calculate next position along the line with random offset
-        float t = (i + 1.0f) / segments;
-        sf::Vector2f nextPos = start + (direction * t);
-        
-        // Add some randomness for zig-zag effect (more pronounced at higher power)
-        if (i < segments - 1) {
-            float offset = (rand() % (ZAP_OFFSET_MAX - ZAP_OFFSET_MIN + 1) + ZAP_OFFSET_MIN) * 
-                           (1.0f + powerLevel * ZAP_OFFSET_POWER_FACTOR) / 2.0f;
-            nextPos += perpendicular * offset;
-        }
-        
-        // Add line segment with glow effect
-        sf::Color startColor = zapBaseColor;
-        sf::Color endColor = zapBrightColor;
-        
-        // Adjust alpha for fade-out effect
-        startColor.a = 255 - (i * 255 / segments);
-        endColor.a = 255 - (i * 255 / segments);
-        
-        // Main line
-        zapEffect.append(sf::Vertex(currentPos, startColor));
-        zapEffect.append(sf::Vertex(nextPos, endColor));
-        
-        // Add parallel lines for thickness effect
-        float thickness = ZAP_THICKNESS_BASE * (1.0f + ZAP_THICKNESS_POWER_FACTOR * powerLevel);
-        sf::Vector2f offsetPerp = perpendicular * thickness;
-        
-        zapEffect.append(sf::Vertex(currentPos + offsetPerp, startColor));
-        zapEffect.append(sf::Vertex(nextPos + offsetPerp, endColor));
-        
-        zapEffect.append(sf::Vertex(currentPos - offsetPerp, startColor));
-        zapEffect.append(sf::Vertex(nextPos - offsetPerp, endColor));
-        
-        // Add branches based on power level
-        int branchChance = ZAP_BRANCH_CHANCE_BASE + powerLevel * ZAP_BRANCH_CHANCE_PER_POWER;
-        if (i > 0 && i < segments - 2 && rand() % 100 < branchChance) {
-            createLightningBranch(currentPos, direction, distance, i, segments, zapBaseColor, zapBrightColor);
-        }
-        
-        currentPos = nextPos;
+            baseColor = ZAP_STANDARD_BASE_COLOR;
+            brightColor = ZAP_STANDARD_BRIGHT_COLOR;
     }
 }
 
-void ForceField::createLightningBranch(
-    const sf::Vector2f& branchStart, 
-    const sf::Vector2f& mainDirection, 
-    float mainDistance,
-    int currentSegment, 
-    int totalSegments,
-    const sf::Color& baseColor,
-    const sf::Color& brightColor
-) {
-    // Create perpendicular vector for branch direction
-    sf::Vector2f branchDir(mainDirection.y, -mainDirection.x);
-    
-    // Randomize branch direction
-    if (rand() % 2 == 0) {
-        branchDir = -branchDir;
+void ForceField::getChainColors(sf::Color& baseColor, sf::Color& brightColor) const {
+    switch (fieldType) {
+        case FieldType::SHOCK:
+            baseColor = CHAIN_SHOCK_BASE_COLOR;
+            brightColor = CHAIN_SHOCK_BRIGHT_COLOR;
+            break;
+        case FieldType::PLASMA:
+            baseColor = CHAIN_PLASMA_BASE_COLOR;
+            brightColor = CHAIN_PLASMA_BRIGHT_COLOR;
+            break;
+        case FieldType::VORTEX:
+            baseColor = CHAIN_VORTEX_BASE_COLOR;
+            brightColor = CHAIN_VORTEX_BRIGHT_COLOR;
+            break;
+        default:
+            baseColor = CHAIN_STANDARD_BASE_COLOR;
+            brightColor = CHAIN_STANDARD_BRIGHT_COLOR;
     }
+}
+
+void ForceField::rebuildLightning() {
+    // Cheap flicker: re-map the same templates with a slightly different amplitude
+    auto jitter = []() {
+        return 1.0f + ZAP_TEMPLATE_JITTER * ((rand() % 201) - 100) / 100.0f;
+    };
     
-    // Add some randomness to branch angle
-    float angleAdjust = (rand() % (ZAP_BRANCH_ANGLE_MAX - ZAP_BRANCH_ANGLE_MIN + 1) + ZAP_BRANCH_ANGLE_MIN) * PI / 180.0f;
-    float cosA = cos(angleAdjust);
-    float sinA = sin(angleAdjust);
-    branchDir = sf::Vector2f(
-        branchDir.x * cosA - branchDir.y * sinA,
-        branchDir.x * sinA + branchDir.y * cosA
-    );
-    
-    // Normalize and scale branch direction
-    float branchLen = mainDistance * (ZAP_BRANCH_LENGTH_FACTOR + (rand() % 100) / 500.0f) * (1.0f + ZAP_BRANCH_LENGTH_VARIATION * powerLevel);
-    float branchDirMag = std::hypot(branchDir.x, branchDir.y);
-    branchDir = branchDir * (branchLen / branchDirMag);
+    sf::Color baseColor, brightColor;
     
-    // Create the branch using configurable number of segments (more at higher power)
-    sf::Vector2f branchPos = branchStart;
-    int branchSegments = ZAP_BRANCH_MIN_SEGMENTS + rand() % (1 + powerLevel);
+    zapEffect.clear();
+    if (zapBolt.shape) {
+        getZapColors(baseColor, brightColor);
+        LightningTemplates::Instantiate(*zapBolt.shape, zapBolt.start, zapBolt.end, baseColor, brightColor,
+                                        zapBolt.mirrored, jitter(), zapEffect);
+    }
     
-    for (int j = 0; j < branchSegments; j++) {
-        float bt = (j + 1.0f) / branchSegments;
-        sf::Vector2f nextBranchPos = branchStart + (branchDir * bt);
-        
-        // Add randomness to branch
-        nextBranchPos += sf::Vector2f(
-            (rand() % ZAP_BRANCH_RANDOMNESS - ZAP_BRANCH_RANDOMNESS/2) * (1.0f + ZAP_BRANCH_LENGTH_VARIATION * powerLevel),
-            (rand() % ZAP_BRANCH_RANDOMNESS - ZAP_BRANCH_RANDOMNESS/2) * (1.0f + ZAP_BRANCH_LENGTH_VARIATION * powerLevel)
-        );
-        
-        // Calculate colors with alpha fade
-        sf::Color startBranchColor = baseColor;
-        sf::Color endBranchColor = brightColor;
-        
-        float alphaMultiplier = 1.0f - (float)currentSegment / totalSegments;
-        startBranchColor.a = static_cast<sf::Uint8>(200 * alphaMultiplier - (j * 40));
-        endBranchColor.a = static_cast<sf::Uint8>(150 * alphaMultiplier - (j * 40));
-        
-        // Add branch segment
-        zapEffect.append(sf::Vertex(branchPos, startBranchColor));
-        zapEffect.append(sf::Vertex(nextBranchPos, endBranchColor));
-        
-        // Chance for sub-branches at higher power levels
-        if (powerLevel >= ZAP_SUB_BRANCH_POWER_MIN && j < branchSegments - 1 && rand() % 100 < ZAP_SUB_BRANCH_CHANCE) {
-            sf::Vector2f subBranchDir(branchDir.y, -branchDir.x);
-            if (rand() % 2 == 0) subBranchDir = -subBranchDir;
-            
-            float subLen = branchLen * ZAP_SUB_BRANCH_LENGTH;
-            subBranchDir = subBranchDir * (subLen / std::hypot(subBranchDir.x, subBranchDir.y));
-            
-            sf::Vector2f subBranchEnd = branchPos + subBranchDir;
-            
-            // Add randomness
-            subBranchEnd += sf::Vector2f(
-                (rand() % 30 - 15), 
-                (rand() % 30 - 15)
-            );
-            
-            // Add sub-branch
-            sf::Color subColor = startBranchColor;
-            subColor.a = static_cast<sf::Uint8>(subColor.a * 0.7f);
-            
-            zapEffect.append(sf::Vertex(branchPos, subColor));
-            zapEffect.append(sf::Vertex(subBranchEnd, sf::Color(brightColor.r, brightColor.g, brightColor.b, 0)));
+    chainEffect.clear();
+    if (!chainBolts.empty()) {
+        getChainColors(baseColor, brightColor);
+        for (const BoltInstance& bolt : chainBolts) {
+            LightningTemplates::Instantiate(*bolt.shape, bolt.start, bolt.end, baseColor, brightColor,
+                                            bolt.mirrored, jitter(), chainEffect);
         }
-        
-        branchPos = nextBranchPos;
     }
 }
 
@@ -602,6 +535,7 @@ void ForceField::performChainLightning(
 ) {
     // Clear existing chain effects
     chainEffect.clear();
+    chainBolts.clear();
     
     // Calculate how many chain targets based on power level
     int effectiveChainTargets = std::min(static_cast<int>(enemiesInRange.size() - 1), 
@@ -661,74 +595,25 @@ void ForceField::performChainLightning(
 }
 
 void ForceField::createChainLightningEffect(const sf::Vector2f& start, const sf::Vector2f& end) {
-    // Direction vector
-    sf::Vector2f direction = end - start;
-    float distance = std::hypot(direction.x, direction.y);
-    
-    if (distance < 0.001f) return; // Prevent division by zero
-    
-    // Normalized perpendicular vector for zig-zag
-    sf::Vector2f perpendicular(-direction.y / distance, direction.x / distance);
-    
-    // Determine chain color based on field type but more transparent
-    sf::Color chainBaseColor;
-    sf::Color chainBrightColor;
-    
-    switch (fieldType) {
-        case FieldType::SHOCK:
-            chainBaseColor = CHAIN_SHOCK_BASE_COLOR;
-            chainBrightColor = CHAIN_SHOCK_BRIGHT_COLOR;
-            break;
-        case FieldType::PLASMA:
-            chainBaseColor = CHAIN_PLASMA_BASE_COLOR;
-            chainBrightColor = CHAIN_PLASMA_BRIGHT_COLOR;
-            break;
-        case FieldType::VORTEX:
-            chainBaseColor = CHAIN_VORTEX_BASE_COLOR;
-            chainBrightColor = CHAIN_VORTEX_BRIGHT_COLOR;
-            break;
-        default:
-            chainBaseColor = CHAIN_STANDARD_BASE_COLOR;
-            chainBrightColor = CHAIN_STANDARD_BRIGHT_COLOR;
-    }
-    
-    // Create chain lightning with fewer segments than primary
-    const int segments = CHAIN_ZAP_BASE_SEGMENTS + powerLevel;
-    sf::Vector2f currentPos = start;
-    
-    for (int i = 0; i < segments; i++) {
-        // Calculate next position along the line with random offset
-        float t = (i + 1.0f) / segments;
-        sf::Vector2f nextPos = start + (direction * t);
-        
-        // Add some randomness for zig-zag effect
-        if (i < segments - 1) {
-            float offset = (rand() % (CHAIN_OFFSET_MAX - CHAIN_OFFSET_MIN + 1) + CHAIN_OFFSET_MIN) * 
-                          (1.0f + powerLevel * CHAIN_OFFSET_POWER_FACTOR) / 2.0f;
-            nextPos += perpendicular * offset;
-        }
-        
-        // Adjusted colors with fade-out
-        sf::Color startColor = chainBaseColor;
-        sf::Color endColor = chainBrightColor;
-        
-        startColor.a = static_cast<sf::Uint8>(startColor.a * (1.0f - (float)i / segments));
-        endColor.a = static_cast<sf::Uint8>(endColor.a * (1.0f - (float)i / segments));
-        
-        // Add chain segment
-        chainEffect.append(sf::Vertex(currentPos, startColor));
-        chainEffect.append(sf::Vertex(nextPos, endColor));
-        
-        currentPos = nextPos;
-    }
+    BoltInstance bolt;
+    bolt.shape = &LightningTemplates::Get().PickChain(powerLevel);
+    bolt.start = start;
+    bolt.end = end;
+    bolt.mirrored = (rand() % 2 == 0);
+    chainBolts.push_back(bolt);
+    
+    sf::Color baseColor, brightColor;
+    getChainColors(baseColor, brightColor);
+    LightningTemplates::Instantiate(*bolt.shape, start, end, baseColor, brightColor, bolt.mirrored, 1.0f, chainEffect);
 }
 
-void ForceField::renderZapEffects(sf::RenderWindow& window) {
+void ForceField::renderZapEffects() {
+    const QualityProfile& quality = QualityGovernor::Get().GetProfile();
+    
     // Main zap effect rendering with enhanced glow
     if (zapEffect.getVertexCount() > 0) {
         // Add background glow effect for more dramatic lighting
-        sf::CircleShape backgroundGlow;
-        backgroundGlow.setRadius(ZAP_GLOW_RADIUS_BASE + ZAP_GLOW_RADIUS_PER_POWER * powerLevel);
+        float backgroundGlowRadius = ZAP_GLOW_RADIUS_BASE + ZAP_GLOW_RADIUS_PER_POWER * powerLevel;
         
         sf::Color bgGlowColor;
         switch (fieldType) {
@@ -745,18 +630,15 @@ void ForceField::renderZapEffects(sf::RenderWindow& window) {
                 bgGlowColor = sf::Color(150, 200, 255, 50);
         }
         
-        backgroundGlow.setFillColor(bgGlowColor);
-        backgroundGlow.setOrigin(backgroundGlow.getRadius(), backgroundGlow.getRadius());
-        
         // Place larger background glows at major vertices
-        for (size_t i = 0; i < zapEffect.getVertexCount(); i += 12) {
-            backgroundGlow.setPosition(zapEffect[i].position);
-            window.draw(backgroundGlow);
+        if (quality.glowPasses >= 2) {
+            for (size_t i = 0; i < zapEffect.getVertexCount(); i += 12) {
+                batchCircle(zapEffect[i].position, backgroundGlowRadius, bgGlowColor, unitCircle);
+            }
         }
         
         // Add primary glow effect
-        sf::CircleShape zapGlow;
-        zapGlow.setRadius(ZAP_PRIMARY_GLOW_RADIUS_BASE + ZAP_PRIMARY_GLOW_RADIUS_PER_POWER * powerLevel);
+        float zapGlowRadius = ZAP_PRIMARY_GLOW_RADIUS_BASE + ZAP_PRIMARY_GLOW_RADIUS_PER_POWER * powerLevel;
         
         sf::Color glowColor;
         switch (fieldType) {
@@ -773,29 +655,25 @@ void ForceField::renderZapEffects(sf::RenderWindow& window) {
                 glowColor = sf::Color(150, 200, 255, 100);
         }
         
-        zapGlow.setFillColor(glowColor);
-        zapGlow.setOrigin(zapGlow.getRadius(), zapGlow.getRadius());
-        
         // Place glows at key vertices with pulsing effect
-        for (size_t i = 0; i < zapEffect.getVertexCount(); i += 6) {
-            // Add subtle variation to each glow
-            float pulseOffset = (i * 0.01f) + fieldPulsePhase * 3.0f;
-            float pulseFactor = 0.8f + 0.2f * std::sin(pulseOffset);
-            
-            zapGlow.setPosition(zapEffect[i].position);
-            zapGlow.setScale(pulseFactor, pulseFactor);
-            window.draw(zapGlow);
+        if (quality.glowPasses >= 1) {
+            for (size_t i = 0; i < zapEffect.getVertexCount(); i += 6) {
+                // Add subtle variation to each glow
+                float pulseOffset = (i * 0.01f) + fieldPulsePhase * 3.0f;
+                float pulseFactor = 0.8f + 0.2f * std::sin(pulseOffset);
+                
+                batchCircle(zapEffect[i].position, zapGlowRadius * pulseFactor, glowColor, unitCircle);
+            }
         }
         
-        // Draw the actual zap effect
-        window.draw(zapEffect);
+        // Tessellate the actual zap lines into the batch
+        for (size_t i = 0; i + 1 < zapEffect.getVertexCount(); i += 2) {
+            batchLine(zapEffect[i].position, zapEffect[i + 1].position, 
+                      zapEffect[i].color, zapEffect[i + 1].color, ZAP_LINE_WIDTH);
+        }
         
         // Add dynamic electricity particles along the zap path
-        if (powerLevel >= ZAP_SPARKLE_MIN_POWER) {
-            sf::CircleShape sparkle;
-            sparkle.setRadius(ZAP_SPARKLE_RADIUS);
-            sparkle.setOrigin(sparkle.getRadius() / 2, sparkle.getRadius() / 2);
-            
+        if (quality.zapSparkles && powerLevel >= ZAP_SPARKLE_MIN_POWER) {
             sf::Color sparkleColor;
             switch (fieldType) {
                 case FieldType::SHOCK:
@@ -810,7 +688,6 @@ void ForceField::renderZapEffects(sf::RenderWindow& window) {
                 default:
                     sparkleColor = sf::Color(220, 240, 255, 200);
             }
-            sparkle.setFillColor(sparkleColor);
             
             // Add random sparkles along the path
             int numSparkles = ZAP_SPARKLE_BASE + ZAP_SPARKLE_PER_POWER * powerLevel;
@@ -832,23 +709,20 @@ void ForceField::renderZapEffects(sf::RenderWindow& window) {
                         (1.0f + ZAP_SPARKLE_OFFSET_POWER_FACTOR * powerLevel)
                     );
                     
-                    sparkle.setPosition(pos);
+                    // Sparkles keep their old half-radius origin offset
                     float scale = 0.5f + (rand() % 100) / 50.0f;
-                    sparkle.setScale(scale, scale);
-                    window.draw(sparkle);
+                    float sparkleRadius = ZAP_SPARKLE_RADIUS * scale;
+                    batchCircle(pos + sf::Vector2f(sparkleRadius / 2, sparkleRadius / 2), sparkleRadius, 
+                                sparkleColor, unitSparkleCircle);
                 }
             }
         }
         
         // Add impact flash at target with enhanced effects
-        sf::CircleShape impactFlash;
-        impactFlash.setRadius(ZAP_IMPACT_FLASH_RADIUS_BASE + ZAP_IMPACT_FLASH_RADIUS_PER_POWER * powerLevel);
-        impactFlash.setOrigin(impactFlash.getRadius(), impactFlash.getRadius());
-        impactFlash.setPosition(zapEndPosition);
+        float flashRadius = ZAP_IMPACT_FLASH_RADIUS_BASE + ZAP_IMPACT_FLASH_RADIUS_PER_POWER * powerLevel;
         
         // Pulsing impact flash
         float flashPulse = ZAP_IMPACT_PULSE_MIN + ZAP_IMPACT_PULSE_MAX * std::sin(fieldPulsePhase * ZAP_IMPACT_PULSE_FREQUENCY);
-        impactFlash.setScale(flashPulse, flashPulse);
         
         // Impact color based on field type
         sf::Color impactColor;
@@ -865,8 +739,7 @@ void ForceField::renderZapEffects(sf::RenderWindow& window) {
             default:
                 impactColor = sf::Color(180, 220, 255, 180);
         }
-        impactFlash.setFillColor(impactColor);
-        window.draw(impactFlash);
+        batchCircle(zapEndPosition, flashRadius * flashPulse, impactColor, unitCircle);
         
         // Add secondary impact rings for more dramatic effect
         if (zapEffectTimer > zapEffectDuration * ZAP_IMPACT_RING_DURATION_FACTOR) { // Only during initial part of effect
@@ -877,50 +750,32 @@ void ForceField::renderZapEffects(sf::RenderWindow& window) {
                 float ringProgress = 1.0f - (zapEffectTimer / zapEffectDuration);
                 float ringSize = (10.0f + 40.0f * ringProgress) * (1.0f + 0.2f * i);
                 
-                sf::CircleShape impactRing;
-                impactRing.setRadius(ringSize);
-                impactRing.setOrigin(ringSize, ringSize);
-                impactRing.setPosition(zapEndPosition);
-                impactRing.setFillColor(sf::Color::Transparent);
-                
                 // Ring color based on field type but fading out as it expands
                 sf::Color ringColor = impactColor;
                 ringColor.a = static_cast<sf::Uint8>(200 * (1.0f - ringProgress) / (i + 1));
-                impactRing.setOutlineColor(ringColor);
-                impactRing.setOutlineThickness(2.0f);
                 
-                window.draw(impactRing);
+                batchRing(zapEndPosition, ringSize, 2.0f, ringColor, unitCircle);
             }
         }
         
         // Add dramatic shockwave if this was a critical hit (combo >= 3 or full charge)
         if (consecutiveHits >= ZAP_CRITICAL_COMBO_THRESHOLD || chargeLevel > ZAP_CRITICAL_CHARGE_THRESHOLD) {
-            sf::CircleShape shockwave;
             float shockwaveProgress = 1.0f - (zapEffectTimer / zapEffectDuration);
             float shockwaveSize = ZAP_SHOCKWAVE_SIZE_BASE * shockwaveProgress * 
                                   (1.0f + ZAP_SHOCKWAVE_POWER_FACTOR * powerLevel);
             
-            shockwave.setRadius(shockwaveSize);
-            shockwave.setOrigin(shockwaveSize, shockwaveSize);
-            shockwave.setPosition(zapEndPosition);
-            shockwave.setFillColor(sf::Color::Transparent);
-            
             // Shockwave color based on field type
             sf::Color shockwaveColor = impactColor;
             shockwaveColor.a = static_cast<sf::Uint8>(150 * (1.0f - shockwaveProgress));
-            shockwave.setOutlineColor(shockwaveColor);
-            shockwave.setOutlineThickness(3.0f + 2.0f * (1.0f - shockwaveProgress));
             
-            window.draw(shockwave);
+            batchRing(zapEndPosition, shockwaveSize, 3.0f + 2.0f * (1.0f - shockwaveProgress), shockwaveColor, unitCircle);
         }
     }
     
     // Render chain lightning effects with added glow
     if (chainEffect.getVertexCount() > 0) {
         // Add glow along chain lightning path
-        sf::CircleShape chainGlow;
-        chainGlow.setRadius(CHAIN_GLOW_RADIUS_BASE + powerLevel);
-        chainGlow.setOrigin(chainGlow.getRadius(), chainGlow.getRadius());
+        float chainGlowRadius = CHAIN_GLOW_RADIUS_BASE + powerLevel;
         
         sf::Color chainGlowColor;
         switch (fieldType) {
@@ -936,219 +791,144 @@ void ForceField::renderZapEffects(sf::RenderWindow& window) {
             default:
                 chainGlowColor = sf::Color(150, 200, 255, CHAIN_GLOW_ALPHA);
         }
-        chainGlow.setFillColor(chainGlowColor);
         
         // Place glows along chain path
-        for (size_t i = 0; i < chainEffect.getVertexCount(); i += 4) {
-            if (i < chainEffect.getVertexCount()) {
-                chainGlow.setPosition(chainEffect[i].position);
-                window.draw(chainGlow);
+        if (quality.glowPasses >= 1) {
+            for (size_t i = 0; i < chainEffect.getVertexCount(); i += 4) {
+                batchCircle(chainEffect[i].position, chainGlowRadius, chainGlowColor, unitCircle);
             }
         }
         
-        // Draw the chain lightning effect
-        window.draw(chainEffect);
-    }
-}
-
-void ForceField::initializeParticles() {
-    // Initialize all particles as inactive
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        particles[i].active = false;
-    }
-}
-
-void ForceField::updateParticles(float dt, const sf::Vector2f& playerCenter) {
-    // Update existing particles
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        if (particles[i].active) {
-            // Update lifetime
-            particles[i].lifetime -= dt;
-            if (particles[i].lifetime <= 0.0f) {
-                particles[i].active = false;
-                continue;
-            }
-            
-            // Update position
-            particles[i].position += particles[i].velocity * dt;
-            
-            // Update alpha based on lifetime
-            float lifeRatio = particles[i].lifetime / particles[i].maxLifetime;
-            particles[i].color.a = static_cast<sf::Uint8>(255 * lifeRatio * lifeRatio);
-            
-            // Update size with a slight pulse
-            float sizePulse = 1.0f + 0.2f * std::sin(particles[i].lifetime * 5.0f);
-            particles[i].size = particles[i].baseSize * lifeRatio * sizePulse;
-            
-            // For orbiting particles, update orbit position
-            if (particles[i].type == ParticleType::ORBIT) {
-                // Update orbit angle
-                particles[i].orbitAngle += dt * particles[i].orbitSpeed;
-                
-                // Calculate orbit position
-                float orbitX = playerCenter.x + std::cos(particles[i].orbitAngle) * particles[i].orbitDistance;
-                float orbitY = playerCenter.y + std::sin(particles[i].orbitAngle) * particles[i].orbitDistance;
-                
-                // Gradually move toward orbit position
-                particles[i].position = particles[i].position * 0.9f + sf::Vector2f(orbitX, orbitY) * 0.1f;
-            }
+        // Tessellate the chain lightning lines into the batch
+        for (size_t i = 0; i + 1 < chainEffect.getVertexCount(); i += 2) {
+            batchLine(chainEffect[i].position, chainEffect[i + 1].position, 
+                      chainEffect[i].color, chainEffect[i + 1].color, ZAP_LINE_WIDTH);
         }
     }
-    
-    // Generate new ambient particles when field is active
-    if (fieldIntensity > 1.0f && rand() % 100 < 30 * fieldIntensity) {
-        createAmbientParticle(playerCenter);
-    }
 }
 
-void ForceField::renderParticles(sf::RenderWindow& window) {
-    sf::CircleShape particleShape;
-    
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        if (particles[i].active) {
-            particleShape.setRadius(particles[i].size);
-            particleShape.setOrigin(particles[i].size, particles[i].size);
-            particleShape.setPosition(particles[i].position);
-            particleShape.setFillColor(particles[i].color);
-            window.draw(particleShape);
-        }
+void ForceField::updateParticles(const sf::Vector2f& playerCenter) {
+    // Particles themselves are simulated by the shared ParticleSystem; the field
+    // only decides when to emit new ambient ones
+    if (fieldIntensity > 1.0f && ParticleSystem::Rand() % 100 < 30 * fieldIntensity) {
+        createAmbientParticle(playerCenter);
     }
 }
 
 void ForceField::createImpactParticles(const sf::Vector2f& impactPos) {
     // Create a burst of particles at impact position
     const int numParticles = IMPACT_PARTICLES_BASE + powerLevel * IMPACT_PARTICLES_PER_POWER;
+    ParticleSystem& particleSystem = ParticleSystem::Get();
+    
+    ParticleDesc desc;
+    desc.position = impactPos;
     
     for (int j = 0; j < numParticles; j++) {
-        // Find an inactive particle
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            if (!particles[i].active) {
-                // Random angle
-                float angle = (rand() % 360) * PI / 180.0f;
-                float speed = IMPACT_PARTICLE_SPEED_MIN + (rand() % (int)(IMPACT_PARTICLE_SPEED_MAX - IMPACT_PARTICLE_SPEED_MIN));
-                
-                particles[i].active = true;
-                particles[i].type = ParticleType::IMPACT;
-                particles[i].position = impactPos;
-                particles[i].velocity = sf::Vector2f(
-                    cosf(angle) * speed,
-                    sinf(angle) * speed
-                );
-                
-                particles[i].baseSize = IMPACT_PARTICLE_SIZE_MIN + (rand() % (int)(IMPACT_PARTICLE_SIZE_MAX - IMPACT_PARTICLE_SIZE_MIN));
-                particles[i].size = particles[i].baseSize;
-                particles[i].maxLifetime = IMPACT_PARTICLE_LIFETIME_MIN + 
-                                         (rand() % 100) / 200.0f * 
-                                         (IMPACT_PARTICLE_LIFETIME_MAX - IMPACT_PARTICLE_LIFETIME_MIN);
-                particles[i].lifetime = particles[i].maxLifetime;
-                
-                // Color based on field type, but brighter
-                switch (fieldType) {
-                    case FieldType::SHOCK:
-                        particles[i].color = sf::Color(150 + rand() % 105, 200 + rand() % 55, 255, 255);
-                        break;
-                    case FieldType::PLASMA:
-                        particles[i].color = sf::Color(255, 150 + rand() % 105, 100 + rand() % 100, 255);
-                        break;
-                    case FieldType::VORTEX:
-                        particles[i].color = sf::Color(200 + rand() % 55, 100 + rand() % 100, 255, 255);
-                        break;
-                    default:
-                        particles[i].color = sf::Color(200 + rand() % 55, 200 + rand() % 55, 255, 255);
-                }
-                
+        // Random angle
+        float angle = (rand() % 360) * PI / 180.0f;
+        float speed = IMPACT_PARTICLE_SPEED_MIN + (rand() % (int)(IMPACT_PARTICLE_SPEED_MAX - IMPACT_PARTICLE_SPEED_MIN));
+        
+        desc.velocity = sf::Vector2f(
+            cosf(angle) * speed,
+            sinf(angle) * speed
+        );
+        
+        desc.size = IMPACT_PARTICLE_SIZE_MIN + (rand() % (int)(IMPACT_PARTICLE_SIZE_MAX - IMPACT_PARTICLE_SIZE_MIN));
+        desc.lifetime = IMPACT_PARTICLE_LIFETIME_MIN + 
+                        (rand() % 100) / 200.0f * 
+                        (IMPACT_PARTICLE_LIFETIME_MAX - IMPACT_PARTICLE_LIFETIME_MIN);
+        
+        // Color based on field type, but brighter
+        switch (fieldType) {
+            case FieldType::SHOCK:
+                desc.color = sf::Color(150 + rand() % 105, 200 + rand() % 55, 255, 255);
                 break;
-            }
+            case FieldType::PLASMA:
+                desc.color = sf::Color(255, 150 + rand() % 105, 100 + rand() % 100, 255);
+                break;
+            case FieldType::VORTEX:
+                desc.color = sf::Color(200 + rand() % 55, 100 + rand() % 100, 255, 255);
+                break;
+            default:
+                desc.color = sf::Color(200 + rand() % 55, 200 + rand() % 55, 255, 255);
         }
+        
+        // Stop early once the global budget is used up
+        if (!particleSystem.Emit(desc)) break;
     }
 }
 
 void ForceField::createAmbientParticle(const sf::Vector2f& center) {
-    // Find an inactive particle
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        if (!particles[i].active) {
-            // Random angle and distance from center
-            float angle = (rand() % 360) * PI / 180.0f;
-            float distance = radius * (0.2f + 0.8f * (rand() % 100) / 100.0f);
-            
-            particles[i].active = true;
-            particles[i].position = center + sf::Vector2f(
-                cosf(angle) * distance,
-                sinf(angle) * distance
-            );
-            
-            // Random type with weights based on field type
-            int typeRoll = rand() % 100;
-            if (typeRoll < PARTICLE_AMBIENT_CHANCE) { // Chance for ambient particles
-                particles[i].type = ParticleType::AMBIENT;
-                particles[i].velocity = sf::Vector2f(
-                    (rand() % (PARTICLE_VELOCITY_RANGE * 2) - PARTICLE_VELOCITY_RANGE) * PARTICLE_VELOCITY_MULTIPLIER,
-                    (rand() % (PARTICLE_VELOCITY_RANGE * 2) - PARTICLE_VELOCITY_RANGE) * PARTICLE_VELOCITY_MULTIPLIER
-                );
-                particles[i].baseSize = PARTICLE_AMBIENT_SIZE_MIN + (rand() % (int)(PARTICLE_AMBIENT_SIZE_MAX - PARTICLE_AMBIENT_SIZE_MIN));
-                particles[i].size = particles[i].baseSize;
-                particles[i].maxLifetime = PARTICLE_AMBIENT_LIFETIME_MIN + (rand() % 100) / 100.0f * 
-                                         (PARTICLE_AMBIENT_LIFETIME_MAX - PARTICLE_AMBIENT_LIFETIME_MIN);
-            } else { // Chance for orbiting particles
-                particles[i].type = ParticleType::ORBIT;
-                particles[i].orbitAngle = angle;
-                particles[i].orbitSpeed = (PARTICLE_ORBIT_SPEED_MIN + rand() % (int)(PARTICLE_ORBIT_SPEED_MAX - PARTICLE_ORBIT_SPEED_MIN)) * 
-                                         (rand() % 2 == 0 ? 1.0f : -1.0f);
-                particles[i].orbitDistance = distance;
-                particles[i].baseSize = PARTICLE_ORBIT_SIZE_MIN + (rand() % (int)(PARTICLE_ORBIT_SIZE_MAX - PARTICLE_ORBIT_SIZE_MIN));
-                particles[i].size = particles[i].baseSize;
-                particles[i].maxLifetime = PARTICLE_ORBIT_LIFETIME_MIN + (rand() % 200) / 100.0f * 
-                                         (PARTICLE_ORBIT_LIFETIME_MAX - PARTICLE_ORBIT_LIFETIME_MIN);
-            }
-            
-            particles[i].lifetime = particles[i].maxLifetime;
-            
-            // Color based on field type
-            switch (fieldType) {
-                case FieldType::SHOCK:
-                    particles[i].color = sf::Color(
-                        100 + rand() % PARTICLE_COLOR_VARIATION, 
-                        180 + rand() % (int)(PARTICLE_COLOR_VARIATION * 0.75f), 
-                        255, 
-                        PARTICLE_DEFAULT_ALPHA);
-                    break;
-                case FieldType::PLASMA:
-                    particles[i].color = sf::Color(
-                        255, 
-                        100 + rand() % PARTICLE_COLOR_VARIATION, 
-                        50 + rand() % PARTICLE_COLOR_VARIATION, 
-                        PARTICLE_DEFAULT_ALPHA);
-                    break;
-                case FieldType::VORTEX:
-                    particles[i].color = sf::Color(
-                        150 + rand() % PARTICLE_COLOR_VARIATION, 
-                        50 + rand() % PARTICLE_COLOR_VARIATION, 
-                        255, 
-                        PARTICLE_DEFAULT_ALPHA);
-                    break;
-                default:
-                    particles[i].color = sf::Color(
-                        150 + rand() % PARTICLE_COLOR_VARIATION, 
-                        150 + rand() % PARTICLE_COLOR_VARIATION, 
-                        255, 
-                        PARTICLE_DEFAULT_ALPHA);
-            }
-            
-            // Only create one particle per call
+    // Random angle and distance from center
+    float angle = (ParticleSystem::Rand() % 360) * PI / 180.0f;
+    float distance = radius * (0.2f + 0.8f * (ParticleSystem::Rand() % 100) / 100.0f);
+    
+    ParticleDesc desc;
+    desc.position = center + sf::Vector2f(
+        cosf(angle) * distance,
+        sinf(angle) * distance
+    );
+    
+    // Random type with weights based on field type
+    int typeRoll = ParticleSystem::Rand() % 100;
+    if (typeRoll < PARTICLE_AMBIENT_CHANCE) { // Chance for ambient particles
+        desc.velocity = sf::Vector2f(
+            (ParticleSystem::Rand() % (PARTICLE_VELOCITY_RANGE * 2) - PARTICLE_VELOCITY_RANGE) * PARTICLE_VELOCITY_MULTIPLIER,
+            (ParticleSystem::Rand() % (PARTICLE_VELOCITY_RANGE * 2) - PARTICLE_VELOCITY_RANGE) * PARTICLE_VELOCITY_MULTIPLIER
+        );
+        desc.size = PARTICLE_AMBIENT_SIZE_MIN + (ParticleSystem::Rand() % (int)(PARTICLE_AMBIENT_SIZE_MAX - PARTICLE_AMBIENT_SIZE_MIN));
+        desc.lifetime = PARTICLE_AMBIENT_LIFETIME_MIN + (ParticleSystem::Rand() % 100) / 100.0f * 
+                        (PARTICLE_AMBIENT_LIFETIME_MAX - PARTICLE_AMBIENT_LIFETIME_MIN);
+    } else { // Chance for orbiting particles
+        // Orbit particles leave tangentially around the field instead of tracking the player
+        float orbitSpeed = (PARTICLE_ORBIT_SPEED_MIN + ParticleSystem::Rand() % (int)(PARTICLE_ORBIT_SPEED_MAX - PARTICLE_ORBIT_SPEED_MIN)) * 
+                           (ParticleSystem::Rand() % 2 == 0 ? 1.0f : -1.0f);
+        desc.velocity = sf::Vector2f(-sinf(angle) * orbitSpeed, cosf(angle) * orbitSpeed);
+        desc.size = PARTICLE_ORBIT_SIZE_MIN + (ParticleSystem::Rand() % (int)(PARTICLE_ORBIT_SIZE_MAX - PARTICLE_ORBIT_SIZE_MIN));
+        desc.lifetime = PARTICLE_ORBIT_LIFETIME_MIN + (ParticleSystem::Rand() % 200) / 100.0f * 
+                        (PARTICLE_ORBIT_LIFETIME_MAX - PARTICLE_ORBIT_LIFETIME_MIN);
+    }
+    
+    // Color based on field type
+    switch (fieldType) {
+        case FieldType::SHOCK:
+            desc.color = sf::Color(
+                100 + ParticleSystem::Rand() % PARTICLE_COLOR_VARIATION, 
+                180 + ParticleSystem::Rand() % (int)(PARTICLE_COLOR_VARIATION * 0.75f), 
+                255, 
+                PARTICLE_DEFAULT_ALPHA);
             break;
-        }
+        case FieldType::PLASMA:
+            desc.color = sf::Color(
+                255, 
+                100 + ParticleSystem::Rand() % PARTICLE_COLOR_VARIATION, 
+                50 + ParticleSystem::Rand() % PARTICLE_COLOR_VARIATION, 
+                PARTICLE_DEFAULT_ALPHA);
+            break;
+        case FieldType::VORTEX:
+            desc.color = sf::Color(
+                150 + ParticleSystem::Rand() % PARTICLE_COLOR_VARIATION, 
+                50 + ParticleSystem::Rand() % PARTICLE_COLOR_VARIATION, 
+                255, 
+                PARTICLE_DEFAULT_ALPHA);
+            break;
+        default:
+            desc.color = sf::Color(
+                150 + ParticleSystem::Rand() % PARTICLE_COLOR_VARIATION, 
+                150 + ParticleSystem::Rand() % PARTICLE_COLOR_VARIATION, 
+                255, 
+                PARTICLE_DEFAULT_ALPHA);
     }
+    
+    ParticleSystem::Get().Emit(desc);
 }
 
-void ForceField::renderPowerIndicator(sf::RenderWindow& window, const sf::Vector2f& playerCenter) {
+void ForceField::renderPowerIndicator(const sf::Vector2f& playerCenter) {
     // Only show indicator when charged or at higher power levels
     if (powerLevel <= POWER_MIN_LEVEL && chargeLevel < POWER_INDICATOR_MIN) return;
     
     // Power level indicator as orbiting diamonds
     for (int i = 0; i < powerLevel; i++) {
-        sf::CircleShape powerMarker(POWER_MARKER_RADIUS, POWER_MARKER_SIDES); // Diamond shape
-        powerMarker.setOrigin(POWER_MARKER_RADIUS, POWER_MARKER_RADIUS);
-        
         // Position in orbit around player
         float markerAngle = fieldRotation * 0.5f + (i * 360.0f / powerLevel);
         float markerDist = radius * POWER_MARKER_DISTANCE_FACTOR;
@@ -1157,8 +937,6 @@ void ForceField::renderPowerIndicator(sf::RenderWindow& window, const sf::Vector
             sinf(markerAngle * PI / 180.0f) * markerDist
         );
         
-        powerMarker.setPosition(markerPos);
-        
         // Color based on field type
         sf::Color markerColor;
         switch (fieldType) {
@@ -1174,22 +952,18 @@ void ForceField::renderPowerIndicator(sf::RenderWindow& window, const sf::Vector
             default:
                 markerColor = sf::Color(150, 220, 255, POWER_MARKER_ALPHA);
         }
-        powerMarker.setFillColor(markerColor);
         
         // Pulsing size
         float pulseFactor = POWER_MARKER_PULSE_MIN + POWER_MARKER_PULSE_MAX * 
                            std::sin(fieldPulsePhase * POWER_MARKER_PULSE_FREQUENCY + i * 0.5f);
-        powerMarker.setScale(pulseFactor, pulseFactor);
         
-        window.draw(powerMarker);
+        batchCircle(markerPos, POWER_MARKER_RADIUS * pulseFactor, markerColor, unitPowerMarker);
     }
     
     // Charge level indicator
     if (chargeLevel > CHARGE_DISPLAY_THRESHOLD) {
-        sf::RectangleShape chargeBar;
         float chargeWidth = CHARGE_BAR_WIDTH * chargeLevel;
-        chargeBar.setSize(sf::Vector2f(chargeWidth, CHARGE_BAR_HEIGHT));
-        chargeBar.setPosition(playerCenter.x - CHARGE_BAR_WIDTH/2, playerCenter.y - radius * CHARGE_BAR_DISTANCE_FACTOR);
+        sf::Vector2f chargeBarPos(playerCenter.x - CHARGE_BAR_WIDTH/2, playerCenter.y - radius * CHARGE_BAR_DISTANCE_FACTOR);
         
         // Color based on charge level and field type
         sf::Color chargeColor;
@@ -1206,18 +980,89 @@ void ForceField::renderPowerIndicator(sf::RenderWindow& window, const sf::Vector
             default:
                 chargeColor = sf::Color(100 + static_cast<int>(155 * chargeLevel), 200, 255, POWER_MARKER_ALPHA);
         }
-        chargeBar.setFillColor(chargeColor);
         
         // Pulsing opacity for high charge
         if (chargeLevel > CHARGE_HIGH_THRESHOLD) {
             float pulseAlpha = CHARGE_PULSE_ALPHA_MIN + CHARGE_PULSE_ALPHA_MAX * 
                               std::sin(fieldPulsePhase * CHARGE_PULSE_FREQUENCY);
             chargeColor.a = static_cast<sf::Uint8>(pulseAlpha);
-            chargeBar.setFillColor(chargeColor);
         }
         
-        window.draw(chargeBar);
+        batchQuad(chargeBarPos, sf::Vector2f(chargeWidth, CHARGE_BAR_HEIGHT), chargeColor);
+    }
+}
+
+std::vector<sf::Vector2f> ForceField::buildUnitCircle(int segments) {
+    // Same point layout as sf::CircleShape (first point at the top), with the
+    // first point repeated at the end so segments can be walked without a modulo
+    std::vector<sf::Vector2f> points(segments + 1);
+    for (int i = 0; i <= segments; i++) {
+        float angle = i * 2.0f * PI / segments - PI / 2.0f;
+        points[i] = sf::Vector2f(std::cos(angle), std::sin(angle));
     }
+    return points;
+}
+
+void ForceField::batchCircle(const sf::Vector2f& center, float circleRadius, const sf::Color& color, 
+                             const std::vector<sf::Vector2f>& unit) {
+    if (circleRadius <= 0.0f || color.a == 0) return;
+    
+    for (size_t i = 0; i + 1 < unit.size(); i++) {
+        fieldBatch.append(sf::Vertex(center, color));
+        fieldBatch.append(sf::Vertex(center + unit[i] * circleRadius, color));
+        fieldBatch.append(sf::Vertex(center + unit[i + 1] * circleRadius, color));
+    }
+}
+
+void ForceField::batchRing(const sf::Vector2f& center, float innerRadius, float thickness, const sf::Color& color, 
+                           const std::vector<sf::Vector2f>& unit) {
+    if (thickness <= 0.0f || color.a == 0) return;
+    
+    // Outline grows outward from the radius, like sf::Shape::setOutlineThickness
+    float outerRadius = innerRadius + thickness;
+    for (size_t i = 0; i + 1 < unit.size(); i++) {
+        sf::Vector2f innerA = center + unit[i] * innerRadius;
+        sf::Vector2f innerB = center + unit[i + 1] * innerRadius;
+        sf::Vector2f outerA = center + unit[i] * outerRadius;
+        sf::Vector2f outerB = center + unit[i + 1] * outerRadius;
+        
+        fieldBatch.append(sf::Vertex(innerA, color));
+        fieldBatch.append(sf::Vertex(outerA, color));
+        fieldBatch.append(sf::Vertex(outerB, color));
+        fieldBatch.append(sf::Vertex(innerA, color));
+        fieldBatch.append(sf::Vertex(outerB, color));
+        fieldBatch.append(sf::Vertex(innerB, color));
+    }
+}
+
+void ForceField::batchLine(const sf::Vector2f& start, const sf::Vector2f& end, 
+                           const sf::Color& startColor, const sf::Color& endColor, float width) {
+    sf::Vector2f direction = end - start;
+    float length = std::hypot(direction.x, direction.y);
+    if (length < 0.001f) return;
+    
+    // Expand the line into a thin quad so it can share the triangle batch
+    sf::Vector2f offset(-direction.y / length * width * 0.5f, direction.x / length * width * 0.5f);
+    
+    fieldBatch.append(sf::Vertex(start + offset, startColor));
+    fieldBatch.append(sf::Vertex(end + offset, endColor));
+    fieldBatch.append(sf::Vertex(end - offset, endColor));
+    fieldBatch.append(sf::Vertex(start + offset, startColor));
+    fieldBatch.append(sf::Vertex(end - offset, endColor));
+    fieldBatch.append(sf::Vertex(start - offset, startColor));
+}
+
+void ForceField::batchQuad(const sf::Vector2f& topLeft, const sf::Vector2f& size, const sf::Color& color) {
+    sf::Vector2f topRight(topLeft.x + size.x, topLeft.y);
+    sf::Vector2f bottomRight(topLeft.x + size.x, topLeft.y + size.y);
+    sf::Vector2f bottomLeft(topLeft.x, topLeft.y + size.y);
+    
+    fieldBatch.append(sf::Vertex(topLeft, color));
+    fieldBatch.append(sf::Vertex(topRight, color));
+    fieldBatch.append(sf::Vertex(bottomRight, color));
+    fieldBatch.append(sf::Vertex(topLeft, color));
+    fieldBatch.append(sf::Vertex(bottomRight, color));
+    fieldBatch.append(sf::Vertex(bottomLeft, color));
 }
 
 void ForceField::updateFieldColor() {
@@ -8,6 +8,8 @@
 #include <vector>
 #include <array>
 #include "../../utils/config/ForceFieldConfig.h"
+#include "LightningTemplates.h"
+#include "../../render/RenderSnapshot.h"
 
 // Forward declarations
 class Player;
@@ -23,31 +25,6 @@ enum class FieldType {
     VORTEX     // Purple field (faster cooldown and wider area)
 };
 
-// Particle types for visual effects
-enum class ParticleType {
-    AMBIENT,   // Ambient particles that drift around
-    IMPACT,    // Impact particles created during zaps
-    ORBIT      // Particles that orbit the field
-};
-
-// Particle structure for visual effects
-struct Particle {
-    bool active;               // Whether particle is currently active
-    ParticleType type;         // Type of particle
-    sf::Vector2f position;     // Current position
-    sf::Vector2f velocity;     // Current velocity (for non-orbiting particles)
-    sf::Color color;           // Particle color
-    float size;                // Current size
-    float baseSize;            // Base/starting size
-    float lifetime;            // Remaining lifetime in seconds
-    float maxLifetime;         // Maximum lifetime in seconds
-    
-    // For orbiting particles
-    float orbitAngle;          // Current angle in degrees
-    float orbitSpeed;          // Orbit speed in degrees per second
-    float orbitDistance;       // Distance from center point
-};
-
 class ForceField {
 public:
     // Callback type for zap events
@@ -57,9 +34,10 @@ public:
     ForceField(Player* player, float radius = DEFAULT_RADIUS);
     ~ForceField() = default;
     
-    // Core functionality
-    void Update(float dt, PlayerManager& playerManager, EnemyManager& enemyManager);
-    void Render(sf::RenderWindow& window);
+    // Core functionality; SimulationTick runs UpdateField as a job, then UpdateZapping
+    void UpdateField(float dt);   // Visuals only; safe on a worker thread with particles captured
+    void UpdateZapping(float dt, PlayerManager& playerManager, EnemyManager& enemyManager);   // Main thread
+    void Render(RenderSnapshot& frame);
     
     // Enhanced zap functionality
     void FindAndZapEnemy(PlayerManager& playerManager, EnemyManager& enemyManager);
@@ -68,20 +46,15 @@ public:
                              int primaryTargetId, const sf::Vector2f& primaryTargetPos,
                              const std::vector<std::pair<int, sf::Vector2f>>& enemiesInRange);
     void createChainLightningEffect(const sf::Vector2f& start, const sf::Vector2f& end);
-    void createLightningBranch(const sf::Vector2f& branchStart, const sf::Vector2f& mainDirection, 
-                             float mainDistance, int currentSegment, int totalSegments,
-                             const sf::Color& baseColor, const sf::Color& brightColor);
     
-    // Advanced visual effects
-    void renderZapEffects(sf::RenderWindow& window);
-    void renderPowerIndicator(sf::RenderWindow& window, const sf::Vector2f& playerCenter);
+    // Advanced visual effects (appended to the per-frame vertex batch)
+    void renderZapEffects();
+    void renderPowerIndicator(const sf::Vector2f& playerCenter);
     void updateFieldColor();
     bool HasZapCallback() const { return zapCallback != nullptr; }
     
-    // Particle system
-    void initializeParticles();
-    void updateParticles(float dt, const sf::Vector2f& playerCenter);
-    void renderParticles(sf::RenderWindow& window);
+    // Particle emission (particles live in the shared ParticleSystem)
+    void updateParticles(const sf::Vector2f& playerCenter);
     void createAmbientParticle(const sf::Vector2f& center);
     void createImpactParticles(const sf::Vector2f& impactPos);
     
@@ -107,6 +80,7 @@ public:
     void SetDamage(float newDamage) { zapDamage = newDamage; }
     
     Player* GetPlayer() const { return player; }
+    void SetPlayer(Player* owner) { player = owner; }
     
     // Field type control
     FieldType GetFieldType() const { return fieldType; }
@@ -143,6 +117,34 @@ public:
     void SetZapCallback(ZapCallback callback) { zapCallback = callback; }
         
 private:
+    // A lightning template placed between two points
+    struct BoltInstance {
+        const LightningTemplate* shape = nullptr;
+        sf::Vector2f start;
+        sf::Vector2f end;
+        bool mirrored = false;
+    };
+    
+    // Lightning helpers
+    void getZapColors(sf::Color& baseColor, sf::Color& brightColor) const;
+    void getChainColors(sf::Color& baseColor, sf::Color& brightColor) const;
+    void rebuildLightning();
+    
+    // Batched geometry helpers - all visuals are tessellated into fieldBatch
+    static std::vector<sf::Vector2f> buildUnitCircle(int segments);
+    void batchCircle(const sf::Vector2f& center, float circleRadius, const sf::Color& color, 
+                     const std::vector<sf::Vector2f>& unit);
+    void batchRing(const sf::Vector2f& center, float innerRadius, float thickness, const sf::Color& color, 
+                   const std::vector<sf::Vector2f>& unit);
+    void batchLine(const sf::Vector2f& start, const sf::Vector2f& end, 
+                   const sf::Color& startColor, const sf::Color& endColor, float width);
+    void batchQuad(const sf::Vector2f& topLeft, const sf::Vector2f& size, const sf::Color& color);
+    
+    // Precomputed unit circles shared by every force field
+    static const std::vector<sf::Vector2f> unitCircle;         // Field, rings, orbs and glows
+    static const std::vector<sf::Vector2f> unitSparkleCircle; // Low-poly circle for sparkles
+    static const std::vector<sf::Vector2f> unitPowerMarker;    // Diamond for power markers
+    
     Player* player;                       // The player this force field belongs to
     sf::CircleShape fieldShape;           // Visual representation of the force field
     std::array<sf::CircleShape, NUM_FIELD_RINGS> fieldRings; // Decorative rings around the field
@@ -153,9 +155,9 @@ private:
     
     sf::VertexArray zapEffect;            // Visual representation of the zap lightning
     sf::VertexArray chainEffect;          // Visual representation of chain lightning
-    
-    // Particle system
-    std::array<Particle, MAX_PARTICLES> particles;
+    BoltInstance zapBolt;                 // Template behind zapEffect
+    std::vector<BoltInstance> chainBolts; // Templates behind chainEffect
+    sf::VertexArray fieldBatch;           // Triangles for everything drawn this frame
     
     float radius;                         // Radius of the force field
     float zapTimer;                       // Current cooldown timer
@@ -0,0 +1,194 @@
+#include "LightningTemplates.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+const LightningTemplates& LightningTemplates::Get() {
+    static LightningTemplates instance;
+    return instance;
+}
+
+LightningTemplates::LightningTemplates() {
+    bolts.resize(MAX_POWER_LEVEL);
+    chains.resize(MAX_POWER_LEVEL);
+    
+    for (int level = 1; level <= MAX_POWER_LEVEL; level++) {
+        bolts[level - 1].resize(ZAP_TEMPLATE_VARIANTS);
+        chains[level - 1].resize(ZAP_TEMPLATE_VARIANTS);
+        
+        for (int variant = 0; variant < ZAP_TEMPLATE_VARIANTS; variant++) {
+            GenerateBolt(level, bolts[level - 1][variant]);
+            GenerateChain(level, chains[level - 1][variant]);
+        }
+    }
+}
+
+int LightningTemplates::ClampPower(int powerLevel) {
+    return std::max(1, std::min(MAX_POWER_LEVEL, powerLevel));
+}
+
+const LightningTemplate& LightningTemplates::PickBolt(int powerLevel) const {
+    return bolts[ClampPower(powerLevel) - 1][rand() % ZAP_TEMPLATE_VARIANTS];
+}
+
+const LightningTemplate& LightningTemplates::PickChain(int powerLevel) const {
+    return chains[ClampPower(powerLevel) - 1][rand() % ZAP_TEMPLATE_VARIANTS];
+}
+
+void LightningTemplates::Instantiate(const LightningTemplate& bolt, const sf::Vector2f& start, const sf::Vector2f& end,
+                                     const sf::Color& baseColor, const sf::Color& brightColor,
+                                     bool mirrored, float amplitudeScale, sf::VertexArray& out) {
+    sf::Vector2f direction = end - start;
+    float distance = std::hypot(direction.x, direction.y);
+    
+    if (distance < 0.001f) return; // Prevent division by zero
+    
+    // Local frame: alongAxis points at the target, acrossAxis is its perpendicular
+    sf::Vector2f alongAxis = direction / distance;
+    sf::Vector2f acrossAxis(-alongAxis.y, alongAxis.x);
+    if (mirrored) {
+        acrossAxis = -acrossAxis;
+    }
+    
+    for (const LightningVertex& v : bolt.vertices) {
+        float along = v.relAlong * distance + v.pxAlong;
+        float across = (v.relAcross * distance + v.pxAcross) * amplitudeScale;
+        
+        sf::Color color = v.bright ? brightColor : baseColor;
+        color.a = static_cast<sf::Uint8>(color.a * v.alpha);
+        
+        out.append(sf::Vertex(start + alongAxis * along + acrossAxis * across, color));
+    }
+}
+
+void LightningTemplates::GenerateBolt(int powerLevel, LightningTemplate& out) {
+    // Number of line segments for the zap - more at higher power levels
+    const int segments = ZAP_BASE_SEGMENTS + powerLevel * ZAP_SEGMENTS_PER_POWER;
+    const float thickness = ZAP_THICKNESS_BASE * (1.0f + ZAP_THICKNESS_POWER_FACTOR * powerLevel);
+    
+    LightningVertex current = { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, false };
+    for (int i = 0; i < segments; i++) {
+        // Next position along the line with a random zig-zag offset
+        LightningVertex next = { (i + 1.0f) / segments, 0.0f, 0.0f, 0.0f, 1.0f, true };
+        if (i < segments - 1) {
+            next.pxAcross = (rand() % (ZAP_OFFSET_MAX - ZAP_OFFSET_MIN + 1) + ZAP_OFFSET_MIN) * 
+                            (1.0f + powerLevel * ZAP_OFFSET_POWER_FACTOR) / 2.0f;
+        }
+        
+        // Fade out toward the target
+        float alpha = 1.0f - static_cast<float>(i) / segments;
+        LightningVertex a = current;
+        LightningVertex b = next;
+        a.alpha = alpha;
+        a.bright = false;
+        b.alpha = alpha;
+        b.bright = true;
+        
+        // Main line plus two parallel lines for thickness
+        for (float offset : { 0.0f, thickness, -thickness }) {
+            LightningVertex lineStart = a;
+            LightningVertex lineEnd = b;
+            lineStart.pxAcross += offset;
+            lineEnd.pxAcross += offset;
+            out.vertices.push_back(lineStart);
+            out.vertices.push_back(lineEnd);
+        }
+        
+        // Add branches based on power level
+        int branchChance = ZAP_BRANCH_CHANCE_BASE + powerLevel * ZAP_BRANCH_CHANCE_PER_POWER;
+        if (i > 0 && i < segments - 2 && rand() % 100 < branchChance) {
+            GenerateBranch(powerLevel, current, i, segments, out);
+        }
+        
+        current = next;
+    }
+}
+
+void LightningTemplates::GenerateBranch(int powerLevel, const LightningVertex& branchStart, int currentSegment,
+                                        int totalSegments, LightningTemplate& out) {
+    // Branches leave perpendicular to the bolt, on either side, with a random tilt.
+    // Their length is relative to the bolt length, their jitter is in pixels.
+    float side = (rand() % 2 == 0) ? 1.0f : -1.0f;
+    float angleAdjust = (rand() % (ZAP_BRANCH_ANGLE_MAX - ZAP_BRANCH_ANGLE_MIN + 1) + ZAP_BRANCH_ANGLE_MIN) * PI / 180.0f;
+    float branchLen = (ZAP_BRANCH_LENGTH_FACTOR + (rand() % 100) / 500.0f) * (1.0f + ZAP_BRANCH_LENGTH_VARIATION * powerLevel);
+    
+    // Unit direction in (along, across) after rotating the perpendicular
+    float dirAlong = -side * std::sin(angleAdjust);
+    float dirAcross = side * std::cos(angleAdjust);
+    
+    const float randomScale = 1.0f + ZAP_BRANCH_LENGTH_VARIATION * powerLevel;
+    const float alphaMultiplier = 1.0f - static_cast<float>(currentSegment) / totalSegments;
+    int branchSegments = ZAP_BRANCH_MIN_SEGMENTS + rand() % (1 + powerLevel);
+    
+    LightningVertex branchPos = branchStart;
+    for (int j = 0; j < branchSegments; j++) {
+        float bt = (j + 1.0f) / branchSegments;
+        LightningVertex nextBranchPos = branchStart;
+        nextBranchPos.relAlong += dirAlong * branchLen * bt;
+        nextBranchPos.relAcross += dirAcross * branchLen * bt;
+        nextBranchPos.pxAlong += (rand() % ZAP_BRANCH_RANDOMNESS - ZAP_BRANCH_RANDOMNESS / 2) * randomScale;
+        nextBranchPos.pxAcross += (rand() % ZAP_BRANCH_RANDOMNESS - ZAP_BRANCH_RANDOMNESS / 2) * randomScale;
+        
+        // Alpha fade, clamped so deep branches don't wrap around
+        float startAlpha = std::max(0.0f, 200.0f * alphaMultiplier - j * 40.0f) / 255.0f;
+        float endAlpha = std::max(0.0f, 150.0f * alphaMultiplier - j * 40.0f) / 255.0f;
+        
+        LightningVertex a = branchPos;
+        LightningVertex b = nextBranchPos;
+        a.alpha = startAlpha;
+        a.bright = false;
+        b.alpha = endAlpha;
+        b.bright = true;
+        out.vertices.push_back(a);
+        out.vertices.push_back(b);
+        
+        // Chance for sub-branches at higher power levels
+        if (powerLevel >= ZAP_SUB_BRANCH_POWER_MIN && j < branchSegments - 1 && rand() % 100 < ZAP_SUB_BRANCH_CHANCE) {
+            float subSide = (rand() % 2 == 0) ? 1.0f : -1.0f;
+            float subLen = branchLen * ZAP_SUB_BRANCH_LENGTH;
+            
+            LightningVertex subStart = branchPos;
+            subStart.alpha = startAlpha * 0.7f;
+            subStart.bright = false;
+            
+            LightningVertex subEnd = branchPos;
+            subEnd.relAlong += dirAcross * subSide * subLen;
+            subEnd.relAcross -= dirAlong * subSide * subLen;
+            subEnd.pxAlong += (rand() % 30 - 15);
+            subEnd.pxAcross += (rand() % 30 - 15);
+            subEnd.alpha = 0.0f;
+            subEnd.bright = true;
+            
+            out.vertices.push_back(subStart);
+            out.vertices.push_back(subEnd);
+        }
+        
+        branchPos = nextBranchPos;
+    }
+}
+
+void LightningTemplates::GenerateChain(int powerLevel, LightningTemplate& out) {
+    // Chain lightning uses fewer segments than the primary bolt and no branches
+    const int segments = CHAIN_ZAP_BASE_SEGMENTS + powerLevel;
+    
+    LightningVertex current = { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, false };
+    for (int i = 0; i < segments; i++) {
+        LightningVertex next = { (i + 1.0f) / segments, 0.0f, 0.0f, 0.0f, 1.0f, true };
+        if (i < segments - 1) {
+            next.pxAcross = (rand() % (CHAIN_OFFSET_MAX - CHAIN_OFFSET_MIN + 1) + CHAIN_OFFSET_MIN) * 
+                            (1.0f + powerLevel * CHAIN_OFFSET_POWER_FACTOR) / 2.0f;
+        }
+        
+        float alpha = 1.0f - static_cast<float>(i) / segments;
+        LightningVertex a = current;
+        LightningVertex b = next;
+        a.alpha = alpha;
+        a.bright = false;
+        b.alpha = alpha;
+        b.bright = true;
+        out.vertices.push_back(a);
+        out.vertices.push_back(b);
+        
+        current = next;
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef LIGHTNING_TEMPLATES_H
+#define LIGHTNING_TEMPLATES_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "../../utils/config/ForceFieldConfig.h"
+
+// One vertex of a bolt template in the bolt's local frame. The frame runs from
+// the start point (along = 0) to the end point (along = 1); "across" is the
+// perpendicular. Relative parts scale with the bolt length, pixel parts don't,
+// so zig-zag amplitude and thickness look the same on short and long zaps.
+struct LightningVertex {
+    float relAlong;
+    float relAcross;
+    float pxAlong;
+    float pxAcross;
+    float alpha;     // 0..1, multiplied with the colour's alpha
+    bool bright;     // Use the bright colour instead of the base colour
+};
+
+// A pre-generated bolt stored as a line list (pairs of vertices)
+struct LightningTemplate {
+    std::vector<LightningVertex> vertices;
+};
+
+// Bank of normalised bolt and chain templates generated once at startup. A zap
+// picks a template for its power level and maps it onto the start/end segment,
+// so no jagged geometry is generated while fighting.
+class LightningTemplates {
+public:
+    static const LightningTemplates& Get();
+    
+    const LightningTemplate& PickBolt(int powerLevel) const;
+    const LightningTemplate& PickChain(int powerLevel) const;
+    
+    // Affine-map a template onto start->end and append it to a sf::Lines array.
+    // mirrored flips the bolt across its axis; amplitudeScale stretches the zig-zag.
+    static void Instantiate(const LightningTemplate& bolt, const sf::Vector2f& start, const sf::Vector2f& end,
+                            const sf::Color& baseColor, const sf::Color& brightColor,
+                            bool mirrored, float amplitudeScale, sf::VertexArray& out);
+    
+private:
+    LightningTemplates();
+    
+    static int ClampPower(int powerLevel);
+    static void GenerateBolt(int powerLevel, LightningTemplate& out);
+    static void GenerateBranch(int powerLevel, const LightningVertex& branchStart, int currentSegment,
+                               int totalSegments, LightningTemplate& out);
+    static void GenerateChain(int powerLevel, LightningTemplate& out);
+    
+    // Indexed by [powerLevel - 1][variant]
+    std::vector<std::vector<LightningTemplate>> bolts;
+    std::vector<std::vector<LightningTemplate>> chains;
+};
+
+#endif // LIGHTNING_TEMPLATES_H
@@ -9,6 +9,7 @@ Player::Player()
     shape.setSize(sf::Vector2f(PLAYER_WIDTH, PLAYER_HEIGHT));
     shape.setFillColor(PLAYER_DEFAULT_COLOR);
     shape.setPosition(PLAYER_DEFAULT_START_X, PLAYER_DEFAULT_START_Y);
+    previousPosition = shape.getPosition();
 }
 
 Player::Player(const sf::Vector2f& startPosition, const sf::Color& color)
@@ -17,10 +18,12 @@ Player::Player(const sf::Vector2f& startPosition, const sf::Color& color)
     shape.setSize(sf::Vector2f(PLAYER_WIDTH, PLAYER_HEIGHT));
     shape.setFillColor(color);
     shape.setPosition(startPosition);
+    previousPosition = startPosition;
 }
 
 Player::Player(Player&& other) noexcept
     : shape(std::move(other.shape)),
+      previousPosition(other.previousPosition),
       movementSpeed(other.movementSpeed),
       moveSpeedMultiplier(other.moveSpeedMultiplier),
       shootCooldown(other.shootCooldown),
@@ -30,12 +33,18 @@ Player::Player(Player&& other) noexcept
       isDead(other.isDead),
       respawnPosition(other.respawnPosition),
       forceField(std::move(other.forceField)),
-      forceFieldEnabled(other.forceFieldEnabled) {
+      forceFieldEnabled(other.forceFieldEnabled),
+      lastAttackerIndex(other.lastAttackerIndex) {
+    // The field keeps a back-pointer to its owner
+    if (forceField) {
+        forceField->SetPlayer(this);
+    }
 }
 
 Player& Player::operator=(Player&& other) noexcept {
     if (this != &other) {
         shape = std::move(other.shape);
+        previousPosition = other.previousPosition;
         movementSpeed = other.movementSpeed;
         moveSpeedMultiplier = other.moveSpeedMultiplier;
         shootCooldown = other.shootCooldown;
@@ -46,6 +55,10 @@ Player& Player::operator=(Player&& other) noexcept {
         respawnPosition = other.respawnPosition;
         forceField = std::move(other.forceField);
         forceFieldEnabled = other.forceFieldEnabled;
+        lastAttackerIndex = other.lastAttackerIndex;
+        if (forceField) {
+            forceField->SetPlayer(this);
+        }
     }
     return *this;
 }
@@ -57,26 +70,40 @@ void Player::Update(float dt) {
 }
 
 void Player::Update(float dt, const InputManager& inputManager) {
+    Update(dt, SampleMovementInput(inputManager));
+}
+
+void Player::Update(float dt, uint8_t movementInput) {
     // First run the base update to handle cooldowns
     Update(dt);
     
-    // Then handle input-based movement
-    sf::Vector2f movement(0.f, 0.f);
-    
     // Skip movement if player is dead
     if (isDead) return;
     
+    shape.move(MovementDelta(movementInput, GetEffectiveSpeed(), dt));
+}
+
+uint8_t Player::SampleMovementInput(const InputManager& inputManager) {
     // Use the input manager to check for key presses using the configured bindings
+    uint8_t input = 0;
     if (sf::Keyboard::isKeyPressed(inputManager.GetKeyBinding(GameAction::MoveUp)))
-        movement.y -= movementSpeed * moveSpeedMultiplier * dt;
+        input |= MOVE_INPUT_UP;
     if (sf::Keyboard::isKeyPressed(inputManager.GetKeyBinding(GameAction::MoveDown)))
-        movement.y += movementSpeed * moveSpeedMultiplier * dt;
+        input |= MOVE_INPUT_DOWN;
     if (sf::Keyboard::isKeyPressed(inputManager.GetKeyBinding(GameAction::MoveLeft)))
-        movement.x -= movementSpeed * moveSpeedMultiplier * dt;
+        input |= MOVE_INPUT_LEFT;
     if (sf::Keyboard::isKeyPressed(inputManager.GetKeyBinding(GameAction::MoveRight)))
-        movement.x += movementSpeed * moveSpeedMultiplier * dt;
-    
-    shape.move(movement);
+        input |= MOVE_INPUT_RIGHT;
+    return input;
+}
+
+sf::Vector2f Player::MovementDelta(uint8_t movementInput, float speed, float dt) {
+    sf::Vector2f movement(0.f, 0.f);
+    if (movementInput & MOVE_INPUT_UP) movement.y -= speed * dt;
+    if (movementInput & MOVE_INPUT_DOWN) movement.y += speed * dt;
+    if (movementInput & MOVE_INPUT_LEFT) movement.x -= speed * dt;
+    if (movementInput & MOVE_INPUT_RIGHT) movement.x += speed * dt;
+    return movement;
 }
 
 Player::BulletParams Player::Shoot(const sf::Vector2f& mouseWorldPos) {
@@ -162,6 +189,10 @@ const sf::RectangleShape& Player::GetShape() const {
     return shape;
 }
 
+sf::Vector2f Player::GetInterpolatedPosition(float alpha) const {
+    return previousPosition + (shape.getPosition() - previousPosition) * alpha;
+}
+
 float Player::GetShootCooldown() const {
     return shootCooldown;
 }
@@ -175,17 +206,17 @@ float Player::GetSpeed() const {
 }
 
 void Player::TakeDamage(int amount) {
-    // Call the overloaded version with empty attacker ID
-    TakeDamage(amount, "");
+    // Call the overloaded version with no attacker
+    TakeDamage(amount, PLAYER_INVALID_INDEX);
 }
 
-void Player::TakeDamage(int amount, const std::string& attackerID) {
+void Player::TakeDamage(int amount, int attackerIndex) {
     // Skip if already dead
     if (isDead) return;
     
-    // Store the attacker ID for death callback
-    if (!attackerID.empty()) {
-        lastAttackerID = attackerID;
+    // Store the attacker for death callback
+    if (attackerIndex != PLAYER_INVALID_INDEX) {
+        lastAttackerIndex = attackerIndex;
     }
     
     int oldHealth = health;
@@ -205,9 +236,9 @@ void Player::TakeDamage(int amount, const std::string& attackerID) {
             respawnPosition = shape.getPosition();
         }
         
-        // Call death callback if set, passing the lastAttackerID
+        // Call death callback if set, passing the last attacker
         if (onDeath) {
-            onDeath(playerID, shape.getPosition(), lastAttackerID);
+            onDeath(playerID, shape.getPosition(), lastAttackerIndex);
         }
     }
 }
@@ -224,8 +255,9 @@ bool Player::IsDead() const {
 void Player::Respawn() {
     health = PLAYER_HEALTH;
     isDead = false;
-    // Move player to their respawn position
+    // Move player to their respawn position (snap, don't interpolate across the map)
     shape.setPosition(respawnPosition);
+    previousPosition = respawnPosition;
     
     // Call respawn callback if set
     if (onRespawn) {
@@ -20,8 +20,16 @@ public:
         bool success = false; // Flag to indicate if shot was successful
     };
     
+    // Movement input, sampled once per tick so the same input can be replayed
+    enum MovementInput : uint8_t {
+        MOVE_INPUT_UP = 1,
+        MOVE_INPUT_DOWN = 2,
+        MOVE_INPUT_LEFT = 4,
+        MOVE_INPUT_RIGHT = 8
+    };
+    
     // Event callback types
-    using DeathCallback = std::function<void(const std::string&, const sf::Vector2f&, const std::string&)>;
+    using DeathCallback = std::function<void(const std::string&, const sf::Vector2f&, int)>; // Killer is a PlayerRegistry index
     using RespawnCallback = std::function<void(const std::string&, const sf::Vector2f&)>;
     using DamageCallback = std::function<void(const std::string&, int, int)>;
     
@@ -38,12 +46,18 @@ public:
     // Update methods
     void Update(float dt); // Base update for cooldowns and respawn timer
     void Update(float dt, const InputManager& inputManager); // Full update with input handling
+    void Update(float dt, uint8_t movementInput);            // Full update with pre-sampled input
+    
+    // Deterministic movement: the host and the predicting client run the same step
+    static uint8_t SampleMovementInput(const InputManager& inputManager);
+    static sf::Vector2f MovementDelta(uint8_t movementInput, float speed, float dt);
+    float GetEffectiveSpeed() const { return movementSpeed * moveSpeedMultiplier; }
     
     // Combat methods
     BulletParams Shoot(const sf::Vector2f& mouseWorldPos);
     BulletParams AttemptShoot(const sf::Vector2f& mouseWorldPos);
     void TakeDamage(int amount);
-    void TakeDamage(int amount, const std::string& attackerID);
+    void TakeDamage(int amount, int attackerIndex);
     bool IsDead() const;
     void Die(const sf::Vector2f& deathPosition);
     void Respawn();
@@ -57,6 +71,11 @@ public:
     void SetRespawnPosition(const sf::Vector2f& position);
     sf::Vector2f GetRespawnPosition() const;
     
+    // Fixed-timestep interpolation
+    void SavePreviousPosition() { previousPosition = shape.getPosition(); }
+    sf::Vector2f GetPreviousPosition() const { return previousPosition; }
+    sf::Vector2f GetInterpolatedPosition(float alpha) const;
+    
     // Shape access
     sf::RectangleShape& GetShape();
     const sf::RectangleShape& GetShape() const;
@@ -107,6 +126,7 @@ public:
 private:
     // Visual representation
     sf::RectangleShape shape;
+    sf::Vector2f previousPosition;   // Position at the start of the current tick
     
     // Movement properties
     float movementSpeed;
@@ -136,7 +156,7 @@ private:
     
     // Player identification
     std::string playerID = "";
-    std::string lastAttackerID = "";
+    int lastAttackerIndex = PLAYER_INVALID_INDEX;
     
     // Event callbacks
     DeathCallback onDeath;
@@ -1,55 +1,45 @@
 #include "PlayerManager.h"
-#include "../../core/Game.h"
+#include "../../core/SimulationContext.h"
+#include "../../core/Logger.h"
 #include "../../network/messages/MessageHandler.h"
 #include "../../network/messages/PlayerMessageHandler.h"
 #include "../../network/messages/EnemyMessageHandler.h"
 #include "../../network/messages/StateMessageHandler.h"
 #include "../../network/messages/SystemMessageHandler.h"
 #include "ForceField.h"
-#include "../../network/NetworkManager.h"
+#include "../../network/SessionContext.h"
 
 #include <iostream>
 #include <algorithm>
 
-PlayerManager::PlayerManager(Game* game, const std::string& localID)
-    : game(game), localPlayerID(localID), lastFrameTime(std::chrono::steady_clock::now()) {
+PlayerManager::PlayerManager(SimulationContext* context, const std::string& localID)
+    : context(context), localPlayerID(localID) {
 }
 
 PlayerManager::~PlayerManager() {
     // Clean up if needed
 }
 
-void PlayerManager::Update(Game* game) {
-    auto now = std::chrono::steady_clock::now();
-    float dt = std::chrono::duration<float>(now - lastFrameTime).count();
-    lastFrameTime = now;
-
-    Update(dt, game);
-}
-
-void PlayerManager::Update() {
-    // Legacy method for backward compatibility
-    Update(game);
-}
-
-void PlayerManager::Update(float dt, Game* game) {
-    UpdatePlayers(dt, game);
+void PlayerManager::Update(float dt) {
+    UpdatePlayers(dt);
     UpdateBullets(dt);
     CheckBulletCollisions();
 }
 
-void PlayerManager::UpdatePlayers(float dt, Game* game) {
+void PlayerManager::UpdatePlayers(float dt) {
     for (auto& pair : players) {
         std::string playerID = pair.first;
         RemotePlayer& rp = pair.second;
+        rp.player.SavePreviousPosition();
 
         // Let the player update itself (handles cooldowns and respawn timer)
         rp.player.Update(dt);
         
         // Update player position based on whether it's local or remote
         if (playerID == localPlayerID) {
-            // For local player, use the InputManager for movement
-            rp.player.Update(dt, game->GetInputManager());
+            // For local player, sample input once so the network layer can record the same command
+            localMovementInput = context->SampleLocalMovement();
+            rp.player.Update(dt, localMovementInput);
             sf::Vector2f playerPos = rp.player.GetPosition();
             rp.nameText.setPosition(playerPos.x, playerPos.y - 20.f);
         } else {
@@ -58,25 +48,30 @@ void PlayerManager::UpdatePlayers(float dt, Game* game) {
         }
         
         // Update player name display
-        UpdatePlayerNameDisplay(playerID, rp, game);
+        UpdatePlayerNameDisplay(playerID, rp);
     }
 }
 
 void PlayerManager::UpdateRemotePlayerPosition(float dt, const std::string& playerID, RemotePlayer& rp) {
-    auto now = std::chrono::steady_clock::now();
-    float elapsed = std::chrono::duration<float>(now - rp.lastUpdateTime).count();
-    float t = elapsed / rp.interpDuration;
-    if (t > 1.0f) t = 1.0f;
-    sf::Vector2f pos = rp.previousPosition + (rp.targetPosition - rp.previousPosition) * t;
+    // Clients draw remote players from the host's timestamped snapshots
+    sf::Vector2f pos;
+    if (rp.snapshots.Sample(SnapshotClock::Get().RenderTime(), pos) == SnapshotBuffer::Result::Empty) {
+        // No snapshots (the host's view of its clients): blend towards the latest report
+        auto now = std::chrono::steady_clock::now();
+        float elapsed = std::chrono::duration<float>(now - rp.lastUpdateTime).count();
+        float t = elapsed / rp.interpDuration;
+        if (t > 1.0f) t = 1.0f;
+        pos = rp.previousPosition + (rp.targetPosition - rp.previousPosition) * t;
+    }
     rp.player.SetPosition(pos);
     
     // Update player name position to follow the player
     rp.nameText.setPosition(pos.x, pos.y - 20.f);
 }
 
-void PlayerManager::UpdatePlayerNameDisplay(const std::string& playerID, RemotePlayer& rp, Game* game) {
+void PlayerManager::UpdatePlayerNameDisplay(const std::string& playerID, RemotePlayer& rp) {
     // Only show ready status in Lobby state
-    if (game->GetCurrentState() == GameState::Lobby) {
+    if (context->GetCurrentState() == GameState::Lobby) {
         std::string status = rp.isReady ? " ✓" : " X";
         rp.nameText.setString(rp.baseName + status);
     } else {
@@ -85,18 +80,17 @@ void PlayerManager::UpdatePlayerNameDisplay(const std::string& playerID, RemoteP
 }
 
 void PlayerManager::UpdateBullets(float dt) {
-    std::vector<size_t> bulletsToRemove;
+    bullets.Update(dt);
     
-    for (size_t i = 0; i < bullets.size(); i++) {
-        bullets[i].Update(dt);
-        
-        // Mark expired bullets or those far away from all players
-        if (bullets[i].IsExpired()) {
-            bulletsToRemove.push_back(i);
+    // Walk backwards so swap-and-pop removal never skips a bullet
+    for (size_t i = bullets.Size(); i-- > 0;) {
+        // Remove expired bullets or those far away from all players
+        if (bullets.IsExpired(i)) {
+            bullets.Remove(i);
         } else {
             // Also remove bullets that are far away from any player
             bool tooFarFromAllPlayers = true;
-            sf::Vector2f bulletPos = bullets[i].GetPosition();
+            sf::Vector2f bulletPos = bullets.GetPosition(i);
             
             for (const auto& pair : players) {
                 if (pair.second.player.IsDead()) continue;
@@ -113,13 +107,10 @@ void PlayerManager::UpdateBullets(float dt) {
             }
             
             if (tooFarFromAllPlayers) {
-                bulletsToRemove.push_back(i);
+                bullets.Remove(i);
             }
         }
     }
-    
-    // Remove expired bullets safely (from back to front)
-    RemoveBullets(bulletsToRemove);
 }
 
 void PlayerManager::AddOrUpdatePlayer(const std::string& id, const RemotePlayer& player) {
@@ -130,7 +121,8 @@ void PlayerManager::AddOrUpdatePlayer(const std::string& id, const RemotePlayer&
     
     auto now = std::chrono::steady_clock::now();
     
-    if (players.find(id) == players.end()) {
+    auto it = players.find(id);
+    if (it == players.end()) {
         // New player - create using constructor, not copy
         RemotePlayer newPlayer;
         newPlayer.playerID = id;
@@ -146,20 +138,18 @@ void PlayerManager::AddOrUpdatePlayer(const std::string& id, const RemotePlayer&
         newPlayer.kills = player.kills;
         newPlayer.money = player.money;
         
-        // Initialize player callbacks
-        InitializePlayerCallbacks(newPlayer, id);
-        
-        // Insert the new player
-        players[id] = std::move(newPlayer);
+        // Insert the new player (callbacks are bound once it has a slot)
+        InsertPlayer(id, std::move(newPlayer));
     } else if (id != localPlayerID) {
         // Update existing remote player - update fields individually, don't copy the Player object
-        players[id].previousPosition = players[id].player.GetPosition();
-        players[id].targetPosition = player.player.GetPosition();
-        players[id].lastUpdateTime = now;
-        players[id].player.SetPosition(player.player.GetPosition());
-        players[id].cubeColor = player.cubeColor;
-        players[id].isHost = player.isHost;
-        players[id].nameText = player.nameText;
+        RemotePlayer& existing = it->second;
+        existing.previousPosition = existing.player.GetPosition();
+        existing.targetPosition = player.player.GetPosition();
+        existing.lastUpdateTime = now;
+        existing.player.SetPosition(player.player.GetPosition());
+        existing.cubeColor = player.cubeColor;
+        existing.isHost = player.isHost;
+        existing.nameText = player.nameText;
         // Don't override stats when updating position
     }
 }
@@ -172,27 +162,26 @@ void PlayerManager::AddOrUpdatePlayer(const std::string& id, RemotePlayer&& play
     
     auto now = std::chrono::steady_clock::now();
     
-    if (players.find(id) == players.end()) {
-        // New player - move it directly into the map
+    auto it = players.find(id);
+    if (it == players.end()) {
+        // New player - move it directly into the registry
         player.previousPosition = player.player.GetPosition();
         player.targetPosition = player.player.GetPosition();
         player.lastUpdateTime = now;
         
-        // Initialize player callbacks
-        InitializePlayerCallbacks(player, id);
-        
-        // Move the player into the map
-        players[id] = std::move(player);
+        // Move the player into its slot (callbacks are bound once it has one)
+        InsertPlayer(id, std::move(player));
     } else if (id != localPlayerID) {
         // Update existing remote player
         // We can't move the whole player since it exists, so update fields
-        players[id].previousPosition = players[id].player.GetPosition();
-        players[id].targetPosition = player.player.GetPosition();
-        players[id].lastUpdateTime = now;
-        players[id].player.SetPosition(player.player.GetPosition());
-        players[id].cubeColor = player.cubeColor;
-        players[id].isHost = player.isHost;
-        players[id].nameText = player.nameText;
+        RemotePlayer& existing = it->second;
+        existing.previousPosition = existing.player.GetPosition();
+        existing.targetPosition = player.player.GetPosition();
+        existing.lastUpdateTime = now;
+        existing.player.SetPosition(player.player.GetPosition());
+        existing.cubeColor = player.cubeColor;
+        existing.isHost = player.isHost;
+        existing.nameText = player.nameText;
         // Don't override stats when updating position
     }
 }
@@ -201,7 +190,7 @@ void PlayerManager::AddLocalPlayer(const std::string& id, const std::string& nam
     RemotePlayer rp;
     // Create a new Player directly, don't copy
     rp.player = Player(position, color);
-    rp.nameText.setFont(game->GetFont());
+    rp.nameText.setFont(context->GetFont());
     rp.nameText.setString(name);
     rp.baseName = name;
     rp.nameText.setCharacterSize(PLAYER_NAME_FONT_SIZE);
@@ -215,12 +204,68 @@ void PlayerManager::AddLocalPlayer(const std::string& id, const std::string& nam
     rp.cubeColor = color;
     rp.playerID = id;
     
-    // Initialize player callbacks
-    InitializePlayerCallbacks(rp, id);
-    
-    // Move to the map (don't copy)
-    players[id] = std::move(rp);
+    // Replace any earlier entry, then move into the registry (don't copy)
     localPlayerID = id;
+    players.erase(id);
+    InsertPlayer(id, std::move(rp));
+}
+
+int PlayerManager::InsertPlayer(const std::string& id, RemotePlayer&& player) {
+    int index = players.Add(id, std::move(player));
+    if (index == PLAYER_INVALID_INDEX) {
+        std::cout << "[PM] Could not register player " << id << "\n";
+        return index;
+    }
+    
+    BindPlayer(index);
+    return index;
+}
+
+void PlayerManager::BindPlayer(int index) {
+    RemotePlayer* rp = players.At(index);
+    if (!rp) return;
+    
+    // Player's move operations don't carry callbacks, so bind them on the stored player
+    const std::string& storedID = players.GetID(index);
+    InitializePlayerCallbacks(*rp, storedID);
+    if (rp->player.GetForceField()) {
+        rp->player.SetForceFieldZapCallback([this, index](int enemyId, float damage, bool killed) {
+            HandleForceFieldZap(index, enemyId, damage, killed);
+        });
+    }
+    if (storedID == localPlayerID) {
+        localPlayerIndex = index;
+    }
+}
+
+void PlayerManager::RelocatePlayer(int from, int to) {
+    if (!players.Move(from, to)) return;
+    
+    bullets.ReassignShooter(static_cast<uint8_t>(from), static_cast<uint8_t>(to));
+    if (localPlayerIndex == from) {
+        localPlayerIndex = to;
+    }
+    BindPlayer(to);
+}
+
+void PlayerManager::AssignSlot(const std::string& id, int slot) {
+    int current = players.IndexOf(id);
+    if (current == PLAYER_INVALID_INDEX || slot < 0 || slot >= PlayerRegistry::Capacity() || current == slot) {
+        return;
+    }
+    
+    // Whoever holds the slot locally moves aside; its own assignment will follow
+    if (players.At(slot)) {
+        int spare = players.FreeIndex();
+        if (spare == PLAYER_INVALID_INDEX) {
+            std::cout << "[PM] No spare slot to honour host slot " << slot << " for " << id << "\n";
+            return;
+        }
+        RelocatePlayer(slot, spare);
+    }
+    
+    RelocatePlayer(current, slot);
+    std::cout << "[PM] Player " << id << " now in slot " << slot << "\n";
 }
 
 void PlayerManager::InitializePlayerCallbacks(RemotePlayer& rp, const std::string& playerID) {
@@ -228,8 +273,8 @@ void PlayerManager::InitializePlayerCallbacks(RemotePlayer& rp, const std::strin
     rp.player.SetPlayerID(playerID);
     
     // Set up death callback
-    rp.player.SetDeathCallback([this](const std::string& id, const sf::Vector2f& pos, const std::string& killerID) {
-        HandlePlayerDeath(id, pos, killerID);
+    rp.player.SetDeathCallback([this](const std::string& id, const sf::Vector2f& pos, int killerIndex) {
+        HandlePlayerDeath(id, pos, killerIndex);
     });
     
     // Set up respawn callback
@@ -244,12 +289,13 @@ void PlayerManager::InitializePlayerCallbacks(RemotePlayer& rp, const std::strin
 }
 
 void PlayerManager::SetReadyStatus(const std::string& id, bool ready) {
-    if (players.find(id) != players.end()) {
-        players[id].isReady = ready;        
+    auto it = players.find(id);
+    if (it != players.end()) {
+        it->second.isReady = ready;        
         // Only update the visible name with ready status if in Lobby state
-        if (game->GetCurrentState() == GameState::Lobby) {
+        if (context->GetCurrentState() == GameState::Lobby) {
             std::string status = ready ? " ✓" : " X";
-            players[id].nameText.setString(players[id].baseName + status);
+            it->second.nameText.setString(it->second.baseName + status);
         }
     }
 }
@@ -264,34 +310,29 @@ bool PlayerManager::AreAllPlayersReady() const {
 }
 
 void PlayerManager::AddBullet(const std::string& shooterID, const sf::Vector2f& position, const sf::Vector2f& direction, float velocity) {
+    if (shooterID.empty()) {
+        return;
+    }
+    
+    AddBullet(players.IndexOf(shooterID), position, direction, velocity);
+}
+
+void PlayerManager::AddBullet(int shooterIndex, const sf::Vector2f& position, const sf::Vector2f& direction, float velocity, uint8_t rewindTicks) {
     // Validate input parameters
     if (direction.x == 0.f && direction.y == 0.f) {
         return;
     }
     
-    if (shooterID.empty()) {
+    // Bullets are owned by a registered player
+    RemotePlayer* shooter = players.At(shooterIndex);
+    if (!shooter) {
         return;
     }
     
-    // Ensure we use the exact same string format for IDs
-    std::string normalizedID = shooterID;
-    try {
-        // Convert to uint64, then back to string to normalize format
-        uint64_t idNum = std::stoull(shooterID);
-        normalizedID = std::to_string(idNum);
-    } catch (const std::exception& e) {
-        std::cout << "[PM] Error normalizing shooter ID: " << e.what() << "\n";
-    }
+    // Apply bullet speed multiplier from the shooter
+    float adjustedVelocity = velocity * shooter->player.GetBulletSpeedMultiplier();
     
-    // Apply bullet speed multiplier from player if available
-    float adjustedVelocity = velocity;
-    auto it = players.find(normalizedID);
-    if (it != players.end()) {
-        adjustedVelocity *= it->second.player.GetBulletSpeedMultiplier();
-    }
-    
-    // Add the bullet with the normalized ID
-    bullets.emplace_back(position, direction, adjustedVelocity, normalizedID);
+    bullets.Spawn(static_cast<uint8_t>(shooterIndex), position, direction * adjustedVelocity, rewindTicks);
 }
 
 bool PlayerManager::PlayerShoot(const sf::Vector2f& mouseWorldPos) {
@@ -308,7 +349,7 @@ bool PlayerManager::PlayerShoot(const sf::Vector2f& mouseWorldPos) {
         float bulletSpeed = BULLET_SPEED * localPlayer.player.GetBulletSpeedMultiplier();
         
         // Add the bullet locally
-        AddBullet(localPlayerID, bulletParams.position, bulletParams.direction, bulletSpeed);
+        AddBullet(localPlayerIndex, bulletParams.position, bulletParams.direction, bulletSpeed);
         
         // Send the bullet creation to other players via network
         SendBulletMessageToNetwork(bulletParams.position, bulletParams.direction, bulletSpeed);
@@ -320,67 +361,54 @@ bool PlayerManager::PlayerShoot(const sf::Vector2f& mouseWorldPos) {
 }
 
 void PlayerManager::SendBulletMessageToNetwork(const sf::Vector2f& position, const sf::Vector2f& direction, float bulletSpeed) {
-    // Create the bullet message
+    // Create the bullet message; clients say what moment their screen showed so the host can rewind.
+    // Enemies are drawn dead-reckoned to the host's present, not interpolated a delay behind it.
+    uint64_t viewTime = 0;
+    if (SnapshotClock::Get().IsSynced()) {
+        viewTime = static_cast<uint64_t>(SnapshotClock::Get().HostTime() * 1000.0);
+    }
     std::string bulletMsg = PlayerMessageHandler::FormatBulletMessage(
-        localPlayerID, position, direction, bulletSpeed);
+        localPlayerIndex, position, direction, bulletSpeed, viewTime);
     
     // Check if we're the host by comparing with the lobby owner
-    CSteamID localSteamID = SteamUser()->GetSteamID();
-    CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
+    CSteamID hostID = SessionContext::Get().GetHostID();
     
-    if (localSteamID == hostID) {
+    if (SessionContext::Get().IsHost()) {
         // We are the host, broadcast to all clients
-        game->GetNetworkManager().BroadcastMessage(bulletMsg);
+        context->BroadcastMessage(bulletMsg);
     } else {
         // We are a client, send to host
-        game->GetNetworkManager().SendMessage(hostID, bulletMsg);
+        context->SendMessage(hostID, bulletMsg);
     }
 }
 
 RemotePlayer& PlayerManager::GetLocalPlayer() {
-    if (players.find(localPlayerID) == players.end()) {
+    RemotePlayer* local = players.At(localPlayerIndex);
+    if (!local) {
         std::cerr << "[ERROR] Local player not found!" << std::endl;
         // Create a temporary player to avoid crash
         static RemotePlayer defaultPlayer;
         return defaultPlayer;
     }
-    return players[localPlayerID];
+    return *local;
 }
 
 void PlayerManager::RemovePlayer(const std::string& id) {
-    players.erase(id);
+    int index = players.IndexOf(id);
+    if (index == localPlayerIndex) {
+        localPlayerIndex = PLAYER_INVALID_INDEX;
+    }
+    players.Remove(index);
 }
 
-std::unordered_map<std::string, RemotePlayer>& PlayerManager::GetPlayers() {
+PlayerRegistry& PlayerManager::GetPlayers() {
     return players;
 }
 
 void PlayerManager::IncrementPlayerKills(const std::string& playerID) {
-    // Normalize player ID for consistent comparison
-    std::string normalizedPlayerID;
-    try {
-        uint64_t idNum = std::stoull(playerID);
-        normalizedPlayerID = std::to_string(idNum);
-    } catch (const std::exception& e) {
-        std::cout << "[PM] Error normalizing player ID in IncrementPlayerKills: " << e.what() << "\n";
-        normalizedPlayerID = playerID;
-    }
-    
-    if (players.find(normalizedPlayerID) != players.end()) {
-        int oldKills = players[normalizedPlayerID].kills;
-        players[normalizedPlayerID].kills++;
-        
-        // Also reward the player with some money
-        players[normalizedPlayerID].money += ENEMY_KILL_REWARD;
-        
-        // Enhanced logging
-        std::cout << "[KILL TRACKING] Incremented kills for " << normalizedPlayerID 
-                  << " from " << oldKills << " to " << players[normalizedPlayerID].kills 
-                  << " - Player name: " << players[normalizedPlayerID].baseName 
-                  << " - Is local: " << (normalizedPlayerID == localPlayerID ? "YES" : "NO")
-                  << " - Is host: " << (players[normalizedPlayerID].isHost ? "YES" : "NO") << "\n";
-    } else {
-        std::cout << "[PM] Could not find player " << normalizedPlayerID << " to increment kills\n";
+    int index = players.IndexOf(playerID);
+    if (index == PLAYER_INVALID_INDEX) {
+        std::cout << "[PM] Could not find player " << playerID << " to increment kills\n";
         
         // Dump all player IDs for debugging
         std::cout << "[PM] Current players: ";
@@ -388,73 +416,98 @@ void PlayerManager::IncrementPlayerKills(const std::string& playerID) {
             std::cout << pair.first << " (" << pair.second.baseName << "), ";
         }
         std::cout << "\n";
+        return;
     }
+    
+    IncrementPlayerKills(index);
 }
 
-const std::vector<Bullet>& PlayerManager::GetAllBullets() const {
-    return bullets;
+void PlayerManager::IncrementPlayerKills(int playerIndex) {
+    RemotePlayer* killer = players.At(playerIndex);
+    if (!killer) {
+        std::cout << "[PM] No player in slot " << playerIndex << " to increment kills\n";
+        return;
+    }
+    
+    int oldKills = killer->kills;
+    killer->kills++;
+    
+    // Also reward the player with some money
+    killer->money += ENEMY_KILL_REWARD;
+    
+    LOG_DEBUG("KILL TRACKING", "Incremented kills for {} from {} to {} - Player name: {} - Is local: {} - Is host: {}",
+              players.GetID(playerIndex), oldKills, killer->kills, killer->baseName,
+              playerIndex == localPlayerIndex, killer->isHost);
 }
 
 void PlayerManager::CheckBulletCollisions() {
-    for (auto bulletIt = bullets.begin(); bulletIt != bullets.end();) {
-        bool bulletHit = false;
+    if (bullets.Empty()) return;
+    
+    // Living players are the targets; each one owns its own bullets so they can't shoot themselves
+    pvpStage.Clear();
+    pvpTargets.clear();
+    for (int index = 0; index < PlayerRegistry::Capacity(); index++) {
+        RemotePlayer* remotePlayer = players.At(index);
+        if (!remotePlayer || remotePlayer->player.IsDead()) continue;
         
-        for (auto& playerPair : players) {
-            std::string playerID = playerPair.first;
-            RemotePlayer& remotePlayer = playerPair.second;
-            
-            // Skip dead players
-            if (remotePlayer.player.IsDead()) continue;
-            
-            // Check if bullet belongs to this player (can't shoot yourself)
-            if (bulletIt->BelongsToPlayer(playerID)) continue;
-            
-            // Use the Player's collision detection method
-            if (remotePlayer.player.CheckBulletCollision(bulletIt->GetPosition(), BULLET_RADIUS)) {
-                // Apply damage to player, passing shooter ID for kill credit
-                remotePlayer.player.TakeDamage(BULLET_DAMAGE, bulletIt->GetShooterID());
-                bulletHit = true;
-                break;
-            }
-        }
+        // Same approximate circle as Player::CheckBulletCollision
+        sf::FloatRect bounds = remotePlayer->player.GetShape().getGlobalBounds();
+        sf::Vector2f center(bounds.left + bounds.width / 2.0f, bounds.top + bounds.height / 2.0f);
+        float radius = std::min(bounds.width, bounds.height) / 2.0f;
         
-        if (bulletHit) {
-            bulletIt = bullets.erase(bulletIt);
-        } else {
-            ++bulletIt;
-        }
+        pvpStage.AddTarget(static_cast<int>(pvpTargets.size()), center, radius, static_cast<uint8_t>(index));
+        pvpTargets.push_back(remotePlayer);
     }
+    pvpStage.Build();
+    
+    pvpHits.clear();
+    pvpStage.SweepBullets(bullets, BULLET_RADIUS, pvpHits);
+    if (pvpHits.empty()) return;
+    
+    pvpRemovals.clear();
+    for (const BulletHit& hit : pvpHits) {
+        RemotePlayer* target = pvpTargets[hit.targetId];
+        
+        // An earlier hit in this batch may already have killed them
+        if (target->player.IsDead()) continue;
+        
+        // Apply damage to player, passing the shooter's index for kill credit
+        target->player.TakeDamage(BULLET_DAMAGE, bullets.GetShooter(hit.bulletIndex));
+        pvpRemovals.push_back(hit.bulletIndex);
+    }
+    
+    RemoveBullets(pvpRemovals);
 }
 
-void PlayerManager::HandlePlayerDeath(const std::string& playerID, const sf::Vector2f& position, const std::string& killerID) {
+void PlayerManager::HandlePlayerDeath(const std::string& playerID, const sf::Vector2f& position, int killerIndex) {
+    const std::string& killerID = players.GetID(killerIndex);
     std::cout << "[PlayerManager] Player " << playerID << " died at position (" 
               << position.x << "," << position.y 
               << "), killed by " << killerID << std::endl;
     
     // If this is the local player, notify the network
     if (playerID == localPlayerID) {
-        BroadcastPlayerDeath(playerID, position, killerID);
+        BroadcastPlayerDeath(localPlayerIndex, killerIndex);
     }
     
     // If a killer was specified, increment their kill count
-    if (!killerID.empty()) {
-        IncrementPlayerKills(killerID);
+    if (killerIndex != PLAYER_INVALID_INDEX) {
+        IncrementPlayerKills(killerIndex);
     }
 }
 
-void PlayerManager::BroadcastPlayerDeath(const std::string& playerID, const sf::Vector2f& position, const std::string& killerID) {
+void PlayerManager::BroadcastPlayerDeath(int playerIndex, int killerIndex) {
     // Check if we're the host by comparing with the lobby owner
-    CSteamID localSteamID = SteamUser()->GetSteamID();
-    CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
+    CSteamID hostID = SessionContext::Get().GetHostID();
     
-    std::string deathMsg = PlayerMessageHandler::FormatPlayerDeathMessage(playerID, killerID);
+    std::string deathMsg = PlayerMessageHandler::FormatPlayerDeathMessage(playerIndex, killerIndex);
     
-    if (localSteamID == hostID) {
+    if (SessionContext::Get().IsHost()) {
         // We are the host, broadcast to all clients
-        game->GetNetworkManager().BroadcastMessage(deathMsg);
+        context->BroadcastMessage(deathMsg);
     } else {
         // We are a client, send to host
-        game->GetNetworkManager().SendMessage(hostID, deathMsg);
+        context->SendMessage(hostID, deathMsg);
     }
 }
 
@@ -464,23 +517,22 @@ void PlayerManager::HandlePlayerRespawn(const std::string& playerID, const sf::V
     
     // If this is the local player, notify the network
     if (playerID == localPlayerID) {
-        BroadcastPlayerRespawn(playerID, position);
+        BroadcastPlayerRespawn(localPlayerIndex, position);
     }
 }
 
-void PlayerManager::BroadcastPlayerRespawn(const std::string& playerID, const sf::Vector2f& position) {
+void PlayerManager::BroadcastPlayerRespawn(int playerIndex, const sf::Vector2f& position) {
     // Check if we're the host by comparing with the lobby owner
-    CSteamID localSteamID = SteamUser()->GetSteamID();
-    CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
+    CSteamID hostID = SessionContext::Get().GetHostID();
     
-    std::string respawnMsg = PlayerMessageHandler::FormatPlayerRespawnMessage(playerID, position);
+    std::string respawnMsg = PlayerMessageHandler::FormatPlayerRespawnMessage(playerIndex, position);
     
-    if (localSteamID == hostID) {
+    if (SessionContext::Get().IsHost()) {
         // We are the host, broadcast to all clients
-        game->GetNetworkManager().BroadcastMessage(respawnMsg);
+        context->BroadcastMessage(respawnMsg);
     } else {
         // We are a client, send to host
-        game->GetNetworkManager().SendMessage(hostID, respawnMsg);
+        context->SendMessage(hostID, respawnMsg);
     }
 }
 
@@ -490,85 +542,82 @@ void PlayerManager::HandlePlayerDamage(const std::string& playerID, int amount,
 }
 
 void PlayerManager::HandleKill(const std::string& killerID, int enemyId) {
-    // Normalize player ID to ensure consistent string representation
-    std::string normalizedKillerID;
-    try {
-        uint64_t idNum = std::stoull(killerID);
-        normalizedKillerID = std::to_string(idNum);
-    } catch (const std::exception& e) {
-        std::cout << "[KILL] Error normalizing killer ID: " << e.what() << "\n";
-        normalizedKillerID = killerID;
+    int index = players.IndexOf(killerID);
+    if (index == PLAYER_INVALID_INDEX) {
+        LOG_WARNING("KILL", "Unknown killer {} for enemy {}", killerID, enemyId);
+        return;
     }
     
-    std::cout << "[PM::HandleKill] Player " << normalizedKillerID << " got kill for enemy " << enemyId << "\n";
+    HandleKill(index, enemyId);
+}
+
+void PlayerManager::HandleKill(int killerIndex, int enemyId) {
+    RemotePlayer* killer = players.At(killerIndex);
+    if (!killer) {
+        return;
+    }
+    const std::string& killerID = players.GetID(killerIndex);
+    
+    LOG_DEBUG("PM::HandleKill", "Player {} got kill for enemy {}", killerID, enemyId);
     
     // Check if we're the host
-    CSteamID localSteamID = SteamUser()->GetSteamID();
-    CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
-    bool isHost = (localSteamID == hostID);
+    CSteamID hostID = SessionContext::Get().GetHostID();
+    bool isHost = SessionContext::Get().IsHost();
     
     if (isHost) {
         // Host logic - authoritative source of kill tracking
-        if (players.find(normalizedKillerID) != players.end()) {
-            // Increment kill counter
-            players[normalizedKillerID].kills++;
-            
-            // Award money for kill
-            players[normalizedKillerID].money += ENEMY_KILL_REWARD;
-            
-            // Broadcast kill information to all clients
-            std::string killMsg = PlayerMessageHandler::FormatKillMessage(normalizedKillerID, enemyId);
-            game->GetNetworkManager().BroadcastMessage(killMsg);
-            
-            std::cout << "[HOST] Player " << normalizedKillerID << " awarded kill for enemy " << enemyId << "\n";
-        }
+        // Increment kill counter
+        killer->kills++;
+        
+        // Award money for kill
+        killer->money += ENEMY_KILL_REWARD;
+        
+        // Broadcast kill information to all clients
+        std::string killMsg = PlayerMessageHandler::FormatKillMessage(killerIndex, enemyId);
+        context->BroadcastMessage(killMsg);
+        
+        LOG_DEBUG("HOST", "Player {} awarded kill for enemy {}", killerID, enemyId);
     } else {
         // Client logic - send kill message to host for validation
         // Note: Clients don't increment their own kills or award money here
         // They wait for the host to broadcast the kill message back
-        std::string killMsg = PlayerMessageHandler::FormatKillMessage(normalizedKillerID, enemyId);
-        game->GetNetworkManager().SendMessage(hostID, killMsg);
+        std::string killMsg = PlayerMessageHandler::FormatKillMessage(killerIndex, enemyId);
+        context->SendMessage(hostID, killMsg);
         
-        std::cout << "[CLIENT] Sent kill claim to host for player " << normalizedKillerID 
-                  << " and enemy " << enemyId << "\n";
+        LOG_DEBUG("CLIENT", "Sent kill claim to host for player {} and enemy {}", killerID, enemyId);
     }
 }
 
-void PlayerManager::RemoveBullets(const std::vector<size_t>& indicesToRemove) {
+void PlayerManager::RemoveBullets(std::vector<size_t>& indicesToRemove) {
     if (indicesToRemove.empty()) {
         return;
     }
     
-    // Create a sorted copy of indices (sorted in descending order)
-    std::vector<size_t> sortedIndices = indicesToRemove;
-    std::sort(sortedIndices.begin(), sortedIndices.end(), std::greater<size_t>());
+    // Sort in place (descending) so each swap-and-pop only moves bullets we keep
+    std::sort(indicesToRemove.begin(), indicesToRemove.end(), std::greater<size_t>());
+    indicesToRemove.erase(std::unique(indicesToRemove.begin(), indicesToRemove.end()), indicesToRemove.end());
     
-    // Remove bullets from back to front to avoid invalidating indices
-    for (size_t index : sortedIndices) {
-        if (index < bullets.size()) {
-            bullets.erase(bullets.begin() + index);
-        }
+    for (size_t index : indicesToRemove) {
+        bullets.Remove(index);
     }
 }
 
 void PlayerManager::InitializeForceFields() {
     std::cout << "[PlayerManager] Initializing force fields for " << players.size() << " players" << std::endl;
     
-    for (auto& pair : players) {
-        std::string playerID = pair.first;
-        RemotePlayer& rp = pair.second;
+    for (auto it = players.begin(); it != players.end(); ++it) {
+        RemotePlayer& rp = it->second;
+        int playerIndex = players.IndexOf(it);
         
         // Initialize force field if not already done
         if (!rp.player.HasForceField()) {
             std::cout << "[PlayerManager] Creating force field for player " << rp.baseName << std::endl;
             rp.player.InitializeForceField();
             
-            // Set up callback for zap events
-            // Use lambda to capture playerID for the callback
-            std::string capturedID = playerID; // Make a copy for the lambda capture
-            rp.player.SetForceFieldZapCallback([this, capturedID](int enemyId, float damage, bool killed) {
+            // Set up callback for zap events, keyed by the player's registry index
+            rp.player.SetForceFieldZapCallback([this, playerIndex](int enemyId, float damage, bool killed) {
                 // Handle zap event
-                HandleForceFieldZap(capturedID, enemyId, damage, killed);
+                HandleForceFieldZap(playerIndex, enemyId, damage, killed);
             });
             
             std::cout << "[PlayerManager] Force field initialized for player " << rp.baseName << std::endl;
@@ -578,34 +627,33 @@ void PlayerManager::InitializeForceFields() {
     }
 }
 
-void PlayerManager::HandleForceFieldZap(const std::string& playerID, int enemyId, float damage, bool killed) {
+void PlayerManager::HandleForceFieldZap(int playerIndex, int enemyId, float damage, bool killed) {
     // Only update rewards for hits, not kills (as those are handled by HandleKill)
     if (!killed) {
         // Reward for hits (not kills)
-        auto it = players.find(playerID);
-        if (it != players.end()) {
-            it->second.money += FIELD_ZAP_HIT_REWARD; // Use constant for reward
+        RemotePlayer* zapper = players.At(playerIndex);
+        if (zapper) {
+            zapper->money += FIELD_ZAP_HIT_REWARD; // Use constant for reward
         }
     } else {
         // If the enemy was killed, use the centralized kill handling
-        HandleKill(playerID, enemyId);
+        HandleKill(playerIndex, enemyId);
     }
     
     // If this is the local player, send a network message
-    if (playerID == localPlayerID) {
+    if (playerIndex == localPlayerIndex) {
         // Format and send force field zap message
-        std::string zapMsg = PlayerMessageHandler::FormatForceFieldZapMessage(playerID, enemyId, damage);
+        std::string zapMsg = PlayerMessageHandler::FormatForceFieldZapMessage(playerIndex, enemyId, damage);
         
         // Check if we're the host
-        CSteamID localSteamID = SteamUser()->GetSteamID();
-        CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
+        CSteamID hostID = SessionContext::Get().GetHostID();
         
-        if (localSteamID == hostID) {
+        if (SessionContext::Get().IsHost()) {
             // We are the host, broadcast to all clients
-            game->GetNetworkManager().BroadcastMessage(zapMsg);
+            context->BroadcastMessage(zapMsg);
         } else {
             // We are a client, send to host
-            game->GetNetworkManager().SendMessage(hostID, zapMsg);
+            context->SendMessage(hostID, zapMsg);
         }
     }
 }
\ No newline at end of file
@@ -10,12 +10,14 @@
 #include <SFML/Graphics.hpp>
 #include "../../network/messages/MessageHandler.h"
 #include "Player.h"
-#include "Bullet.h"
+#include "BulletPool.h"
+#include "PlayerRegistry.h"
+#include "../../core/CollisionStage.h"
 #include "../../utils/SteamHelpers.h"
 #include "../../utils/config/PlayerConfig.h"
 #include "../../utils/config/BulletConfig.h"
 
-class Game;
+class SimulationContext;
 class EnemyManager;
 
 // Forward declarations
@@ -25,13 +27,11 @@ class ClientNetwork;
 
 class PlayerManager {
 public:
-    PlayerManager(Game* game, const std::string& localPlayerID);
+    PlayerManager(SimulationContext* context, const std::string& localPlayerID);
     ~PlayerManager();
 
-    // Main update methods
-    void Update(float dt, Game* game);    // Primary update method with game reference
-    void Update(Game* game);             // Secondary method that calls primary with default dt
-    void Update();                      // Legacy update method for backward compatibility
+    // Main update method, called once per fixed simulation tick
+    void Update(float dt);
 
     // Player management
     void AddLocalPlayer(const std::string& id, const std::string& name, 
@@ -39,8 +39,11 @@ public:
     void AddOrUpdatePlayer(const std::string& playerID, const RemotePlayer& player);
     void AddOrUpdatePlayer(const std::string& playerID, RemotePlayer&& player);
     void RemovePlayer(const std::string& id);
+    void AssignSlot(const std::string& id, int slot);   // Adopt the host's slot for this player
     RemotePlayer& GetLocalPlayer();
-    std::unordered_map<std::string, RemotePlayer>& GetPlayers();
+    int GetLocalPlayerIndex() const { return localPlayerIndex; }
+    uint8_t GetLocalMovementInput() const { return localMovementInput; }   // Input applied this tick
+    PlayerRegistry& GetPlayers();
     
     // Player actions and status
     bool PlayerShoot(const sf::Vector2f& mouseWorldPos);
@@ -48,44 +51,58 @@ public:
     bool AreAllPlayersReady() const;
     
     // Event handlers (called by Player callbacks)
-    void HandlePlayerDeath(const std::string& playerID, const sf::Vector2f& position, const std::string& killerID);
+    void HandlePlayerDeath(const std::string& playerID, const sf::Vector2f& position, int killerIndex);
     void HandlePlayerRespawn(const std::string& playerID, const sf::Vector2f& position);
     void HandlePlayerDamage(const std::string& playerID, int amount, int actualDamage);
     
-    // Tracking statistics
+    // Tracking statistics (string overloads resolve the index once at the network edge)
+    void IncrementPlayerKills(int playerIndex);
     void IncrementPlayerKills(const std::string& playerID);
+    void HandleKill(int killerIndex, int enemyId);
     void HandleKill(const std::string& killerID, int enemyId);
     
     // Force field management
     void InitializeForceFields();
-    void HandleForceFieldZap(const std::string& playerID, int enemyId, float damage, bool killed);
+    void HandleForceFieldZap(int playerIndex, int enemyId, float damage, bool killed);
     
     // Bullet management
+    void AddBullet(int shooterIndex, const sf::Vector2f& position, 
+                   const sf::Vector2f& direction, float velocity, uint8_t rewindTicks = 0);
     void AddBullet(const std::string& playerID, const sf::Vector2f& position, 
                    const sf::Vector2f& direction, float velocity);
-    const std::vector<Bullet>& GetAllBullets() const;
-    void RemoveBullets(const std::vector<size_t>& indicesToRemove);
+    const BulletPool& GetAllBullets() const { return bullets; }
+    void RemoveBullets(std::vector<size_t>& indicesToRemove);
     void CheckBulletCollisions();
     
     // Network-related methods
     void SendBulletMessageToNetwork(const sf::Vector2f& position, const sf::Vector2f& direction, float bulletSpeed);
-    void BroadcastPlayerDeath(const std::string& playerID, const sf::Vector2f& position, const std::string& killerID);
-    void BroadcastPlayerRespawn(const std::string& playerID, const sf::Vector2f& position);
+    void BroadcastPlayerDeath(int playerIndex, int killerIndex);
+    void BroadcastPlayerRespawn(int playerIndex, const sf::Vector2f& position);
     
 private:
     // Helper methods for organization
-    void UpdatePlayers(float dt, Game* game);
+    void UpdatePlayers(float dt);
     void UpdateRemotePlayerPosition(float dt, const std::string& playerID, RemotePlayer& rp);
-    void UpdatePlayerNameDisplay(const std::string& playerID, RemotePlayer& rp, Game* game);
+    void UpdatePlayerNameDisplay(const std::string& playerID, RemotePlayer& rp);
     void UpdateBullets(float dt);
     void InitializePlayerCallbacks(RemotePlayer& rp, const std::string& playerID);
+    int InsertPlayer(const std::string& playerID, RemotePlayer&& player);
+    void BindPlayer(int index);
+    void RelocatePlayer(int from, int to);
 
     // Private member variables
-    Game* game;                      // Reference to main game object
+    SimulationContext* context;      // Game, or the headless runner
     std::string localPlayerID;       // ID of the local player
-    std::unordered_map<std::string, RemotePlayer> players; // All players in the game
-    std::vector<Bullet> bullets;     // All active bullets
-    std::chrono::steady_clock::time_point lastFrameTime; // Time of the last frame update
+    int localPlayerIndex = PLAYER_INVALID_INDEX; // Registry index of the local player
+    uint8_t localMovementInput = 0;  // Movement input sampled for the local player this tick
+    PlayerRegistry players;          // All players in the game, by dense index
+    BulletPool bullets;              // All active bullets
+    
+    // PvP bullet collision, reused every tick
+    CollisionStage pvpStage;
+    std::vector<RemotePlayer*> pvpTargets;
+    std::vector<BulletHit> pvpHits;
+    std::vector<size_t> pvpRemovals;
     
     // Settings cache for quick reference
     float bulletDamage = BULLET_DAMAGE;
@@ -0,0 +1,184 @@
+#include "PlayerRegistry.h"
+#include <iostream>
+
+namespace {
+    const std::string EMPTY_PLAYER_ID;
+}
+
+PlayerRegistry::PlayerRegistry()
+    : activeCount(0) {
+    // Sized once; slots are recycled, never reallocated
+    slots.resize(PLAYER_REGISTRY_CAPACITY);
+}
+
+bool PlayerRegistry::ParseSteamID(const std::string& id, uint64_t& out) {
+    if (id.empty()) return false;
+    uint64_t value = 0;
+    for (char c : id) {
+        if (c < '0' || c > '9') return false;
+        value = value * 10 + static_cast<uint64_t>(c - '0');
+    }
+    out = value;
+    return true;
+}
+
+int PlayerRegistry::FindFreeSlot() const {
+    int reusable = PLAYER_INVALID_INDEX;
+    for (int i = 0; i < static_cast<int>(slots.size()); i++) {
+        if (slots[i].active) continue;
+        if (!slots[i].used) return i;
+        if (reusable == PLAYER_INVALID_INDEX) reusable = i;
+    }
+    return reusable;
+}
+
+int PlayerRegistry::Add(const std::string& id, RemotePlayer&& player, int index) {
+    if (IndexOf(id) != PLAYER_INVALID_INDEX) {
+        return PLAYER_INVALID_INDEX;
+    }
+
+    if (index == PLAYER_INVALID_INDEX) {
+        index = FindFreeSlot();
+    }
+    if (index < 0 || index >= static_cast<int>(slots.size()) || slots[index].active) {
+        std::cout << "[REGISTRY] No free player slot for " << id << "\n";
+        return PLAYER_INVALID_INDEX;
+    }
+
+    // Numeric IDs are stored in canonical form so every lookup agrees on the key
+    Slot& slot = slots[index];
+    uint64_t steamID = 0;
+    if (ParseSteamID(id, steamID)) {
+        slot.entry.first = std::to_string(steamID);
+    } else {
+        slot.entry.first = id;
+    }
+    slot.steamID = steamID;
+    slot.entry.second = std::move(player);
+    slot.entry.second.playerID = slot.entry.first;
+    slot.active = true;
+    slot.used = true;
+    activeCount++;
+    return index;
+}
+
+void PlayerRegistry::Remove(int index) {
+    if (index < 0 || index >= static_cast<int>(slots.size()) || !slots[index].active) return;
+
+    Slot& slot = slots[index];
+    slot.active = false;
+    slot.steamID = 0;
+    slot.entry.first.clear();
+    slot.entry.second = RemotePlayer();
+    activeCount--;
+}
+
+bool PlayerRegistry::Move(int from, int to) {
+    if (from == to) return true;
+    if (from < 0 || from >= static_cast<int>(slots.size()) || !slots[from].active) return false;
+    if (to < 0 || to >= static_cast<int>(slots.size()) || slots[to].active) return false;
+    
+    Slot& source = slots[from];
+    Slot& target = slots[to];
+    target.entry.first = std::move(source.entry.first);
+    target.entry.second = std::move(source.entry.second);
+    target.entry.second.playerID = target.entry.first;
+    target.steamID = source.steamID;
+    target.active = true;
+    target.used = true;
+    
+    source.active = false;
+    source.steamID = 0;
+    source.entry.first.clear();
+    source.entry.second = RemotePlayer();
+    return true;
+}
+
+int PlayerRegistry::IndexOf(const std::string& id) const {
+    uint64_t steamID = 0;
+    if (ParseSteamID(id, steamID)) {
+        return IndexOf(steamID);
+    }
+
+    for (int i = 0; i < static_cast<int>(slots.size()); i++) {
+        if (slots[i].active && slots[i].entry.first == id) return i;
+    }
+    return PLAYER_INVALID_INDEX;
+}
+
+int PlayerRegistry::IndexOf(uint64_t steamID) const {
+    for (int i = 0; i < static_cast<int>(slots.size()); i++) {
+        if (slots[i].active && slots[i].steamID == steamID) return i;
+    }
+    return PLAYER_INVALID_INDEX;
+}
+
+int PlayerRegistry::IndexOf(const_iterator it) const {
+    if (it.slot == nullptr || it.slot == it.last) return PLAYER_INVALID_INDEX;
+    return static_cast<int>(it.slot - slots.data());
+}
+
+RemotePlayer* PlayerRegistry::At(int index) {
+    if (index < 0 || index >= static_cast<int>(slots.size()) || !slots[index].active) return nullptr;
+    return &slots[index].entry.second;
+}
+
+const RemotePlayer* PlayerRegistry::At(int index) const {
+    if (index < 0 || index >= static_cast<int>(slots.size()) || !slots[index].active) return nullptr;
+    return &slots[index].entry.second;
+}
+
+const std::string& PlayerRegistry::GetID(int index) const {
+    if (index < 0 || index >= static_cast<int>(slots.size()) || !slots[index].active) return EMPTY_PLAYER_ID;
+    return slots[index].entry.first;
+}
+
+uint64_t PlayerRegistry::GetSteamID(int index) const {
+    if (index < 0 || index >= static_cast<int>(slots.size()) || !slots[index].active) return 0;
+    return slots[index].steamID;
+}
+
+PlayerRegistry::iterator PlayerRegistry::find(const std::string& id) {
+    int index = IndexOf(id);
+    if (index == PLAYER_INVALID_INDEX) return end();
+    return iterator(slots.data() + index, slots.data() + slots.size());
+}
+
+PlayerRegistry::const_iterator PlayerRegistry::find(const std::string& id) const {
+    int index = IndexOf(id);
+    if (index == PLAYER_INVALID_INDEX) return end();
+    return const_iterator(slots.data() + index, slots.data() + slots.size());
+}
+
+RemotePlayer& PlayerRegistry::operator[](const std::string& id) {
+    int index = IndexOf(id);
+    if (index == PLAYER_INVALID_INDEX) {
+        index = Add(id, RemotePlayer());
+    }
+    if (index == PLAYER_INVALID_INDEX) {
+        overflow = RemotePlayer();
+        return overflow;
+    }
+    return slots[index].entry.second;
+}
+
+size_t PlayerRegistry::erase(const std::string& id) {
+    int index = IndexOf(id);
+    if (index == PLAYER_INVALID_INDEX) return 0;
+    Remove(index);
+    return 1;
+}
+
+PlayerRegistry::iterator PlayerRegistry::erase(iterator it) {
+    int index = IndexOf(it);
+    if (index == PLAYER_INVALID_INDEX) return end();
+    Remove(index);
+    return iterator(slots.data() + index + 1, slots.data() + slots.size());
+}
+
+void PlayerRegistry::clear() {
+    for (int i = 0; i < static_cast<int>(slots.size()); i++) {
+        Remove(i);
+        slots[i].used = false;
+    }
+}
@@ -0,0 +1,122 @@
+#ifndef PLAYER_REGISTRY_H
+#define PLAYER_REGISTRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../../utils/SteamHelpers.h"
+#include "../../utils/config/PlayerConfig.h"
+
+// Every player in the session, stored contiguously in fixed slots.
+//
+// A Steam ID gets a small dense index when it joins and keeps it until it leaves.
+// The host's indices are the session slots used on the wire; clients adopt them
+// from the connection handshake. Bullets, kills, damage and force fields carry the
+// index, so the hot paths never parse or rebuild ID strings; the string form is only
+// read at the UI, logging and handshake edges. The slot array is sized once, so a
+// RemotePlayer only changes address through an explicit Move.
+//
+// The find/operator[]/erase/iteration interface matches the unordered_map this
+// replaced, yielding (id, RemotePlayer) pairs in index order.
+class PlayerRegistry {
+public:
+    using Entry = std::pair<std::string, RemotePlayer>;
+
+private:
+    struct Slot {
+        Entry entry;
+        uint64_t steamID = 0;
+        bool active = false;
+        bool used = false;   // Has held a player this session
+    };
+
+public:
+    template <bool Const>
+    class Iterator {
+    public:
+        using SlotPtr = typename std::conditional<Const, const Slot*, Slot*>::type;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<Const, const Entry*, Entry*>::type;
+        using reference = typename std::conditional<Const, const Entry&, Entry&>::type;
+
+        Iterator() : slot(nullptr), last(nullptr) {}
+        Iterator(SlotPtr slot, SlotPtr last) : slot(slot), last(last) { SkipInactive(); }
+        operator Iterator<true>() const { return Iterator<true>(slot, last); }
+
+        reference operator*() const { return slot->entry; }
+        pointer operator->() const { return &slot->entry; }
+        Iterator& operator++() { ++slot; SkipInactive(); return *this; }
+        Iterator operator++(int) { Iterator old = *this; ++(*this); return old; }
+        bool operator==(const Iterator& other) const { return slot == other.slot; }
+        bool operator!=(const Iterator& other) const { return slot != other.slot; }
+
+    private:
+        friend class PlayerRegistry;
+        void SkipInactive() { while (slot != last && !slot->active) ++slot; }
+
+        SlotPtr slot;
+        SlotPtr last;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    PlayerRegistry();
+
+    // Adds a player and returns its index, or PLAYER_INVALID_INDEX when the ID is
+    // already present or no slot is free. A specific index can be requested (the
+    // host assigns them); otherwise never-used slots are handed out before freed ones
+    // so late messages about a departed player can't land on a newcomer.
+    int Add(const std::string& id, RemotePlayer&& player, int index = PLAYER_INVALID_INDEX);
+    void Remove(int index);
+    
+    // Moves a player into a free slot (used when the host's slot assignment arrives).
+    // The player object changes address, so anything bound to it must be rebound.
+    bool Move(int from, int to);
+    int FreeIndex() const { return FindFreeSlot(); }
+
+    // Index lookups - no allocation, PLAYER_INVALID_INDEX when absent
+    int IndexOf(const std::string& id) const;
+    int IndexOf(uint64_t steamID) const;
+    int IndexOf(const_iterator it) const;
+
+    // Index access - nullptr / empty string when the slot is free
+    RemotePlayer* At(int index);
+    const RemotePlayer* At(int index) const;
+    const std::string& GetID(int index) const;
+    uint64_t GetSteamID(int index) const;
+    static int Capacity() { return PLAYER_REGISTRY_CAPACITY; }
+
+    // Map-style interface
+    iterator begin() { return iterator(slots.data(), slots.data() + slots.size()); }
+    iterator end() { return iterator(slots.data() + slots.size(), slots.data() + slots.size()); }
+    const_iterator begin() const { return const_iterator(slots.data(), slots.data() + slots.size()); }
+    const_iterator end() const { return const_iterator(slots.data() + slots.size(), slots.data() + slots.size()); }
+    iterator find(const std::string& id);
+    const_iterator find(const std::string& id) const;
+    size_t count(const std::string& id) const { return IndexOf(id) != PLAYER_INVALID_INDEX ? 1 : 0; }
+    RemotePlayer& operator[](const std::string& id);
+    size_t erase(const std::string& id);
+    iterator erase(iterator it);
+    size_t size() const { return activeCount; }
+    bool empty() const { return activeCount == 0; }
+    void clear();
+
+    // Parses a decimal Steam ID without building temporaries
+    static bool ParseSteamID(const std::string& id, uint64_t& out);
+
+private:
+    int FindFreeSlot() const;
+
+    std::vector<Slot> slots;
+    size_t activeCount;
+    RemotePlayer overflow;   // Handed out by operator[] when every slot is taken
+};
+
+#endif // PLAYER_REGISTRY_H
@@ -0,0 +1,280 @@
+#include "HeadlessSimulation.h"
+#include "../network/SessionContext.h"
+#include "../entities/player/LightningTemplates.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+    // Scripted players get ids in the individual Steam account range, like real ones
+    const uint64 FIRST_PLAYER_ID = 76561198000000000ULL;
+
+    const char* SUBSYSTEM_NAMES[] = { "script", "players", "network", "enemies", "fields", "collisions", "waves", "total" };
+}
+
+float SubsystemStats::GetMean() const {
+    if (tickMs.empty()) return 0.0f;
+    double total = 0.0;
+    for (float ms : tickMs) total += ms;
+    return static_cast<float>(total / tickMs.size());
+}
+
+float SubsystemStats::GetPercentile(float percentile) const {
+    if (tickMs.empty()) return 0.0f;
+    std::vector<float> sorted = tickMs;
+    size_t index = static_cast<size_t>(std::clamp(percentile, 0.0f, 1.0f) * (sorted.size() - 1));
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted[index];
+}
+
+float SubsystemStats::GetMax() const {
+    if (tickMs.empty()) return 0.0f;
+    return *std::max_element(tickMs.begin(), tickMs.end());
+}
+
+HeadlessSimulation::HeadlessSimulation(const ScenarioConfig& config)
+    : config(config),
+      jobSystem(config.workerThreads),
+      rng(config.seed)
+{
+    this->config.players = std::clamp(config.players, 1, PlayerRegistry::Capacity());
+
+    stats.resize(SubsystemCount);
+    for (int i = 0; i < SubsystemCount; i++) {
+        stats[i].name = SUBSYSTEM_NAMES[i];
+        stats[i].tickMs.reserve(config.ticks);
+    }
+
+    // We are the host of a session nobody else is in
+    SessionContext::Get().StartLocal(CSteamID(FIRST_PLAYER_ID));
+    ParticleSystem::Get().Clear();
+
+    playerManager = std::make_unique<PlayerManager>(this, SessionContext::Get().GetLocalIDString());
+    enemyManager = std::make_unique<EnemyManager>(this, playerManager.get());
+    tick = std::make_unique<SimulationTick>(this, playerManager.get(), enemyManager.get());
+    LightningTemplates::Get();   // As PlayingState does, so the first zap isn't measured building them
+    AddPlayers();
+    playerManager->InitializeForceFields();
+
+    std::cout << "[HEADLESS] " << scripted.size() << " players, waves of " << config.waveSize
+              << ", " << config.ticks << " ticks at " << SIMULATION_TICK_RATE << " Hz\n";
+}
+
+HeadlessSimulation::~HeadlessSimulation() {
+    // Enemies hold on to the player manager, so they go first
+    tick.reset();
+    enemyManager.reset();
+    playerManager.reset();
+    ParticleSystem::Get().Clear();
+    SessionContext::Get().Clear();
+}
+
+void HeadlessSimulation::AddPlayers() {
+    int count = config.players;
+    for (int i = 0; i < count; i++) {
+        std::string id = std::to_string(FIRST_PLAYER_ID + i);
+
+        // Start on a line through the origin so the first wave spawns around all of them
+        sf::Vector2f position((i - (count - 1) * 0.5f) * HEADLESS_SPAWN_SPACING, 0.0f);
+
+        RemotePlayer rp;
+        rp.playerID = id;
+        rp.isHost = (i == 0);
+        rp.player = Player(position, PLAYER_DEFAULT_COLOR);
+        rp.player.SetRespawnPosition(position);
+        rp.nameText.setFont(font);
+        rp.nameText.setString("Bot " + std::to_string(i));
+        rp.baseName = "Bot " + std::to_string(i);
+        rp.cubeColor = PLAYER_DEFAULT_COLOR;
+        rp.previousPosition = position;
+        rp.targetPosition = position;
+        playerManager->AddOrUpdatePlayer(id, std::move(rp));
+
+        ScriptedPlayer bot;
+        bot.index = playerManager->GetPlayers().IndexOf(id);
+        scripted.push_back(bot);
+    }
+}
+
+void HeadlessSimulation::Warmup() {
+    measuring = false;
+    for (int i = 0; i < config.warmupTicks; i++) {
+        Step();
+    }
+}
+
+void HeadlessSimulation::Measure() {
+    measuring = true;
+    for (int i = 0; i < config.ticks; i++) {
+        Step();
+    }
+    measuring = false;
+}
+
+void HeadlessSimulation::Step() {
+    float dt = fixedTimestep;
+    std::chrono::steady_clock::time_point tickStart = std::chrono::steady_clock::now();
+    uint64_t tickAllocations = allocationCounter ? allocationCounter() : 0;
+
+    BeginSubsystem();
+    ScriptPlayers(dt);
+    EndSubsystem(Script);
+
+    BeginSubsystem();
+    playerManager->Update(dt);
+    EndSubsystem(Players);
+
+    BeginSubsystem();
+    BroadcastPlayerSnapshot(dt);
+    EndSubsystem(Network);
+
+    BeginSubsystem();
+    enemyManager->Update(dt);
+    EndSubsystem(Enemies);
+
+    BeginSubsystem();
+    UpdateWaves();
+    EndSubsystem(Waves);
+
+    BeginSubsystem();
+    tick->UpdateFields(dt);
+    EndSubsystem(Fields);
+
+    BeginSubsystem();
+    tick->ResolveBulletHits();
+    EndSubsystem(Collisions);
+
+    peakEnemies = std::max(peakEnemies, enemyManager->GetEnemyCount());
+
+    if (measuring) {
+        stats[Total].tickMs.push_back(std::chrono::duration<float, std::milli>(
+            std::chrono::steady_clock::now() - tickStart).count());
+        if (allocationCounter) {
+            stats[Total].allocations += allocationCounter() - tickAllocations;
+        }
+    }
+}
+
+void HeadlessSimulation::BeginSubsystem() {
+    if (!measuring) return;
+    subsystemAllocations = allocationCounter ? allocationCounter() : 0;
+    subsystemStart = std::chrono::steady_clock::now();
+}
+
+void HeadlessSimulation::EndSubsystem(Subsystem subsystem) {
+    if (!measuring) return;
+    stats[subsystem].tickMs.push_back(std::chrono::duration<float, std::milli>(
+        std::chrono::steady_clock::now() - subsystemStart).count());
+    if (allocationCounter) {
+        stats[subsystem].allocations += allocationCounter() - subsystemAllocations;
+    }
+}
+
+void HeadlessSimulation::ScriptPlayers(float dt) {
+    // Eight directions and standing still
+    static const uint8_t DIRECTIONS[] = {
+        0,
+        Player::MOVE_INPUT_UP, Player::MOVE_INPUT_DOWN, Player::MOVE_INPUT_LEFT, Player::MOVE_INPUT_RIGHT,
+        Player::MOVE_INPUT_UP | Player::MOVE_INPUT_LEFT, Player::MOVE_INPUT_UP | Player::MOVE_INPUT_RIGHT,
+        Player::MOVE_INPUT_DOWN | Player::MOVE_INPUT_LEFT, Player::MOVE_INPUT_DOWN | Player::MOVE_INPUT_RIGHT
+    };
+    std::uniform_int_distribution<int> pickDirection(0, 8);
+
+    for (size_t i = 0; i < scripted.size(); i++) {
+        ScriptedPlayer& bot = scripted[i];
+        RemotePlayer* rp = playerManager->GetPlayers().At(bot.index);
+        if (!rp) continue;
+
+        // Nobody clicks respawn here, so do what the client would once the timer runs out
+        if (rp->player.IsDead()) {
+            bot.deadTimer += dt;
+            if (bot.deadTimer >= RESPAWN_TIME) {
+                bot.deadTimer = 0.0f;
+                rp->player.Respawn();
+                rp->previousPosition = rp->player.GetPosition();
+                rp->targetPosition = rp->player.GetPosition();
+            }
+            continue;
+        }
+
+        bot.turnTimer -= dt;
+        if (bot.turnTimer <= 0.0f) {
+            bot.movement = DIRECTIONS[pickDirection(rng)];
+            bot.turnTimer = HEADLESS_TURN_INTERVAL;
+        }
+
+        // The local player moves inside PlayerManager from SampleLocalMovement(). Others are
+        // moved here and pinned with a zero-length blend, as if their input had just arrived.
+        if (i > 0) {
+            sf::Vector2f position = rp->player.GetPosition() +
+                Player::MovementDelta(bot.movement, rp->player.GetEffectiveSpeed(), dt);
+            rp->player.SetPosition(position);
+            rp->previousPosition = position;
+            rp->targetPosition = position;
+        }
+
+        sf::Vector2f target;
+        if (!FindNearestEnemy(rp->player.GetPosition(), target)) continue;
+
+        if (i == 0) {
+            playerManager->PlayerShoot(target);
+        } else {
+            Player::BulletParams shot = rp->player.AttemptShoot(target);
+            if (shot.success) {
+                playerManager->AddBullet(bot.index, shot.position, shot.direction, BULLET_SPEED);
+            }
+        }
+    }
+}
+
+bool HeadlessSimulation::FindNearestEnemy(const sf::Vector2f& from, sf::Vector2f& outPosition) const {
+    float bestDistSq = -1.0f;
+    for (const auto& pair : enemyManager->GetEnemies()) {
+        const Enemy& enemy = *pair.second;
+        if (enemy.IsDead()) continue;
+        sf::Vector2f delta = enemy.GetPosition() - from;
+        float distSq = delta.x * delta.x + delta.y * delta.y;
+        if (bestDistSq < 0.0f || distSq < bestDistSq) {
+            bestDistSq = distSq;
+            outPosition = enemy.GetPosition();
+        }
+    }
+    return bestDistSq >= 0.0f;
+}
+
+void HeadlessSimulation::UpdateWaves() {
+    // Back to back: no cooldown between waves, every wave the requested size
+    if (enemyManager->IsWaveComplete()) {
+        enemyManager->StartNewWave(config.waveSize);
+    }
+}
+
+void HeadlessSimulation::BroadcastPlayerSnapshot(float dt) {
+    // HostNetwork::Update's snapshot timer, on simulation time
+    snapshotTimer += dt;
+    if (snapshotTimer < PlayerSnapshotWriter::INTERVAL) return;
+    std::string msg = snapshotWriter.Write(*playerManager, snapshotTimer);
+    snapshotTimer = 0.0f;
+    if (!msg.empty()) BroadcastMessage(msg);
+}
+
+uint8_t HeadlessSimulation::SampleLocalMovement() {
+    return scripted.empty() ? 0 : scripted[0].movement;
+}
+
+bool HeadlessSimulation::SendMessage(CSteamID /*target*/, const std::string& msg) {
+    if (measuring) {
+        messagesSent++;
+        bytesSent += msg.size() + 1;   // SendP2P sends the terminator too
+    }
+    return true;
+}
+
+bool HeadlessSimulation::BroadcastMessage(const std::string& msg) {
+    // Nobody is listening; count what one peer would have been sent
+    if (measuring) {
+        messagesSent++;
+        bytesSent += msg.size() + 1;
+    }
+    return true;
+}
@@ -0,0 +1,123 @@
+#ifndef HEADLESS_SIMULATION_H
+#define HEADLESS_SIMULATION_H
+
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "../core/SimulationContext.h"
+#include "../core/JobSystem.h"
+#include "../core/ParticleSystem.h"
+#include "../core/SimulationTick.h"
+#include "../entities/player/PlayerManager.h"
+#include "../entities/enemies/EnemyManager.h"
+#include "../network/PlayerSnapshotWriter.h"
+#include "../utils/config/Config.h"
+
+// What a scenario runs: how many scripted players, how big each wave is, for how long
+struct ScenarioConfig {
+    int players = HEADLESS_DEFAULT_PLAYERS;
+    int waveSize = HEADLESS_DEFAULT_WAVE_SIZE;
+    int ticks = HEADLESS_DEFAULT_TICKS;
+    int warmupTicks = HEADLESS_WARMUP_TICKS;
+    int workerThreads = JOB_WORKER_THREADS;
+    unsigned int seed = 1;
+};
+
+// Per-tick cost of one part of the simulation
+struct SubsystemStats {
+    std::string name;
+    std::vector<float> tickMs;       // One sample per measured tick
+    uint64_t allocations = 0;        // Over the measured ticks, when an allocation counter is set
+
+    float GetMean() const;
+    float GetPercentile(float percentile) const;
+    float GetMax() const;
+};
+
+// Runs the host's side of a match with no window, no renderer and no Steam client.
+//
+// Scripted players wander and shoot at the nearest enemy while waves of the requested
+// size spawn back to back, ticking the same PlayerManager, EnemyManager and SimulationTick
+// that PlayingState runs. Outgoing messages, including the host's player snapshots, are
+// counted and dropped.
+class HeadlessSimulation : public SimulationContext {
+public:
+    explicit HeadlessSimulation(const ScenarioConfig& config);
+    ~HeadlessSimulation();
+
+    // Runs the warmup ticks unmeasured, then the measured ones
+    void Warmup();
+    void Measure();
+    void Step();
+
+    // Called before and after each subsystem to attribute allocations; optional
+    void SetAllocationCounter(uint64_t (*counter)()) { allocationCounter = counter; }
+
+    const ScenarioConfig& GetConfig() const { return config; }
+    const std::vector<SubsystemStats>& GetStats() const { return stats; }
+    int GetWavesStarted() const { return enemyManager->GetCurrentWave(); }
+    size_t GetEnemyCount() const { return enemyManager->GetEnemyCount(); }
+    size_t GetPeakEnemyCount() const { return peakEnemies; }
+    uint64_t GetMessagesSent() const { return messagesSent; }
+    uint64_t GetBytesSent() const { return bytesSent; }
+
+    // SimulationContext
+    GameState GetCurrentState() const override { return GameState::Playing; }
+    float GetFixedTimestep() const override { return fixedTimestep; }
+    JobSystem& GetJobSystem() override { return jobSystem; }
+    sf::Font& GetFont() override { return font; }
+    uint8_t SampleLocalMovement() override;
+    bool SendMessage(CSteamID target, const std::string& msg) override;
+    bool BroadcastMessage(const std::string& msg) override;
+
+private:
+    enum Subsystem { Script, Players, Network, Enemies, Fields, Collisions, Waves, Total, SubsystemCount };
+
+    struct ScriptedPlayer {
+        int index = PLAYER_INVALID_INDEX;
+        uint8_t movement = 0;
+        float turnTimer = 0.0f;
+        float deadTimer = 0.0f;
+    };
+
+    void AddPlayers();
+    void ScriptPlayers(float dt);
+    void BroadcastPlayerSnapshot(float dt);
+    void UpdateWaves();
+    bool FindNearestEnemy(const sf::Vector2f& from, sf::Vector2f& outPosition) const;
+
+    void BeginSubsystem();
+    void EndSubsystem(Subsystem subsystem);
+
+    ScenarioConfig config;
+    float fixedTimestep = 1.0f / SIMULATION_TICK_RATE;
+    JobSystem jobSystem;
+    sf::Font font;                   // Never loaded; name tags are set but never drawn
+    std::mt19937 rng;
+
+    std::unique_ptr<PlayerManager> playerManager;
+    std::unique_ptr<EnemyManager> enemyManager;
+    std::vector<ScriptedPlayer> scripted;   // scripted[0] is the local (host) player
+
+    std::unique_ptr<SimulationTick> tick;   // Same fields and bullet hits as PlayingState
+
+    // The player snapshot the host broadcasts; enemy messages go out from EnemyManager
+    PlayerSnapshotWriter snapshotWriter;
+    float snapshotTimer = 0.0f;
+
+    // Measurement
+    bool measuring = false;
+    std::vector<SubsystemStats> stats;
+    uint64_t (*allocationCounter)() = nullptr;
+    std::chrono::steady_clock::time_point subsystemStart;
+    uint64_t subsystemAllocations = 0;
+    size_t peakEnemies = 0;
+    uint64_t messagesSent = 0;
+    uint64_t bytesSent = 0;
+};
+
+#endif // HEADLESS_SIMULATION_H
@@ -0,0 +1,202 @@
+// Headless scenario benchmark: runs HeadlessSimulation and writes the results as JSON.
+//
+//   ScenarioRunner [--players N] [--wave-size N] [--ticks N] [--warmup N]
+//                  [--threads N] [--seed N] [--out FILE] [--trace FILE]
+//
+// --out - writes the JSON to stdout and silences the game's own logging for the run.
+// --trace records the measured ticks as a Chrome trace, like the game's F4 recording.
+#include "HeadlessSimulation.h"
+#include "../core/TraceRecorder.h"
+#include "../core/Logger.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// Every heap allocation in this process goes through here, so the runner can count them
+namespace {
+    std::atomic<uint64_t> allocationCount{0};
+    std::atomic<uint64_t> allocatedBytes{0};
+
+    uint64_t GetAllocationCount() {
+        return allocationCount.load(std::memory_order_relaxed);
+    }
+}
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* block = std::malloc(size ? size : 1)) return block;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept {
+    std::free(block);
+}
+
+void operator delete(void* block, std::size_t) noexcept {
+    std::free(block);
+}
+
+namespace {
+    uint64_t GetPeakResidentBytes() {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return counters.PeakWorkingSetSize;
+        }
+        return 0;
+#else
+        rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+        return static_cast<uint64_t>(usage.ru_maxrss);          // Bytes on macOS
+#else
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;   // Kilobytes on Linux
+#endif
+#endif
+    }
+
+    bool ParseArguments(int argc, char** argv, ScenarioConfig& config, std::string& outPath, std::string& tracePath) {
+        for (int i = 1; i < argc; i++) {
+            const char* arg = argv[i];
+            if (i + 1 >= argc) {
+                std::cerr << "[HEADLESS] Missing value for " << arg << "\n";
+                return false;
+            }
+            const char* value = argv[++i];
+
+            if (std::strcmp(arg, "--players") == 0) config.players = std::atoi(value);
+            else if (std::strcmp(arg, "--wave-size") == 0) config.waveSize = std::atoi(value);
+            else if (std::strcmp(arg, "--ticks") == 0) config.ticks = std::atoi(value);
+            else if (std::strcmp(arg, "--warmup") == 0) config.warmupTicks = std::atoi(value);
+            else if (std::strcmp(arg, "--threads") == 0) config.workerThreads = std::atoi(value);
+            else if (std::strcmp(arg, "--seed") == 0) config.seed = static_cast<unsigned int>(std::strtoul(value, nullptr, 10));
+            else if (std::strcmp(arg, "--out") == 0) outPath = value;
+            else if (std::strcmp(arg, "--trace") == 0) tracePath = value;
+            else {
+                std::cerr << "[HEADLESS] Unknown option " << arg << "\n";
+                return false;
+            }
+        }
+
+        if (config.players < 1 || config.waveSize < 1 || config.ticks < 1 || config.warmupTicks < 0) {
+            std::cerr << "[HEADLESS] Players, wave size and ticks must be positive\n";
+            return false;
+        }
+        return true;
+    }
+
+    void WriteResults(std::ostream& out, const HeadlessSimulation& sim, unsigned threadCount,
+                      uint64_t allocations, uint64_t bytes) {
+        const ScenarioConfig& config = sim.GetConfig();
+        out << std::fixed << std::setprecision(4);
+
+        out << "{\n";
+        out << "  \"scenario\": {\n";
+        out << "    \"players\": " << config.players << ",\n";
+        out << "    \"wave_size\": " << config.waveSize << ",\n";
+        out << "    \"ticks\": " << config.ticks << ",\n";
+        out << "    \"warmup_ticks\": " << config.warmupTicks << ",\n";
+        out << "    \"tick_rate\": " << SIMULATION_TICK_RATE << ",\n";
+        out << "    \"threads\": " << threadCount << ",\n";
+        out << "    \"seed\": " << config.seed << "\n";
+        out << "  },\n";
+
+        out << "  \"subsystems\": {\n";
+        const std::vector<SubsystemStats>& stats = sim.GetStats();
+        for (size_t i = 0; i < stats.size(); i++) {
+            const SubsystemStats& s = stats[i];
+            out << "    \"" << s.name << "\": { "
+                << "\"mean_ms\": " << s.GetMean() << ", "
+                << "\"p50_ms\": " << s.GetPercentile(0.5f) << ", "
+                << "\"p99_ms\": " << s.GetPercentile(0.99f) << ", "
+                << "\"max_ms\": " << s.GetMax() << ", "
+                << "\"allocations\": " << s.allocations << ", "
+                << "\"allocations_per_tick\": " << static_cast<double>(s.allocations) / config.ticks
+                << " }" << (i + 1 < stats.size() ? "," : "") << "\n";
+        }
+        out << "  },\n";
+
+        out << "  \"memory\": {\n";
+        out << "    \"peak_resident_bytes\": " << GetPeakResidentBytes() << ",\n";
+        out << "    \"allocations\": " << allocations << ",\n";
+        out << "    \"allocated_bytes\": " << bytes << "\n";
+        out << "  },\n";
+
+        out << "  \"network\": {\n";
+        out << "    \"messages\": " << sim.GetMessagesSent() << ",\n";
+        out << "    \"bytes\": " << sim.GetBytesSent() << "\n";
+        out << "  },\n";
+
+        out << "  \"world\": {\n";
+        out << "    \"waves_started\": " << sim.GetWavesStarted() << ",\n";
+        out << "    \"peak_enemies\": " << sim.GetPeakEnemyCount() << ",\n";
+        out << "    \"final_enemies\": " << sim.GetEnemyCount() << "\n";
+        out << "  }\n";
+        out << "}\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    ScenarioConfig config;
+    std::string outPath = "scenario_results.json";
+    std::string tracePath;
+    if (!ParseArguments(argc, argv, config, outPath, tracePath)) {
+        return 1;
+    }
+
+    bool toStdout = (outPath == "-");
+    std::streambuf* logBuffer = std::cout.rdbuf();
+    if (toStdout) std::cout.rdbuf(nullptr);
+
+    std::ostringstream results;
+    {
+        HeadlessSimulation sim(config);
+        sim.SetAllocationCounter(GetAllocationCount);
+
+        sim.Warmup();
+
+        // Whole-run totals cover the measured ticks only, like the per-subsystem ones
+        uint64_t allocationsBefore = allocationCount.load();
+        uint64_t bytesBefore = allocatedBytes.load();
+        TraceRecorder::Get().SetThreadName("Simulation");
+        if (!tracePath.empty()) TraceRecorder::Get().Start(tracePath);
+        sim.Measure();
+        TraceRecorder::Get().Stop();
+        WriteResults(results, sim, sim.GetJobSystem().GetThreadCount(),
+                     allocationCount.load() - allocationsBefore, allocatedBytes.load() - bytesBefore);
+    }
+
+    // Whatever the run logged is still queued; print it while stdout is still silenced
+    Logger::Get().Flush();
+    std::cout.rdbuf(logBuffer);
+
+    if (toStdout) {
+        std::cout << results.str();
+        return 0;
+    }
+
+    std::ofstream file(outPath);
+    if (!file) {
+        std::cerr << "[HEADLESS] Could not write " << outPath << "\n";
+        return 1;
+    }
+    file << results.str();
+    std::cout << "[HEADLESS] Results written to " << outPath << "\n";
+    return 0;
+}
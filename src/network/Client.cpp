@@ -8,14 +8,20 @@
 #include "messages/SystemMessageHandler.h"
 #include "../states/PlayingState.h"
 #include "../utils/config/Config.h"
+#include "SessionContext.h"
+#include "../core/FlightRecorder.h"
+#include "../core/Logger.h"
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 
 ClientNetwork::ClientNetwork(Game* game, PlayerManager* manager)
     : game(game), 
       playerManager(manager), 
-      lastSendTime(std::chrono::steady_clock::now()) {
+      lastSendTime(std::chrono::steady_clock::now()),
+      lastPredictionReport(std::chrono::steady_clock::now()) {
     
-    hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
+    hostID = SessionContext::Get().GetHostID();
     m_lastValidationTime = std::chrono::steady_clock::now();
     m_lastStateRequestTime = std::chrono::steady_clock::now();
     m_validationRequestTimer = 0.5f;
@@ -25,7 +31,10 @@ ClientNetwork::ClientNetwork(Game* game, PlayerManager* manager)
     std::cout << "[CLIENT] Initialized, host ID: " << hostID.ConvertToUint64() << "\n";
 }
 
-ClientNetwork::~ClientNetwork() {}
+ClientNetwork::~ClientNetwork() {
+    // The round trip belonged to this session's host
+    FlightRecorder::Get().SetRoundTrip(-1.f);
+}
 
 void ClientNetwork::ProcessMessage(const std::string& msg, CSteamID sender) {
     // Special handling for chunked messages
@@ -81,34 +90,18 @@ void ClientNetwork::ProcessMessage(const std::string& msg, CSteamID sender) {
 }
 
 void ClientNetwork::ProcessForceFieldUpdateMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-    // Get the player ID from the message
-    std::string playerID = parsed.steamID;
-    
-    // Normalize player ID for consistent comparison
-    std::string normalizedPlayerID;
-    try {
-        uint64_t idNum = std::stoull(playerID);
-        normalizedPlayerID = std::to_string(idNum);
-    } catch (const std::exception& e) {
-        std::cout << "[CLIENT] Error normalizing player ID in ProcessForceFieldUpdateMessage: " << e.what() << "\n";
-        normalizedPlayerID = playerID;
-    }
-    
-    // Get the local player ID
-    std::string localPlayerID = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
+    auto& players = playerManager->GetPlayers();
+    int playerIndex = parsed.playerSlot;
     
     // Ignore updates for the local player (we already have the latest)
-    if (normalizedPlayerID == localPlayerID) {
+    if (playerIndex != PLAYER_INVALID_INDEX && playerIndex == playerManager->GetLocalPlayerIndex()) {
         std::cout << "[CLIENT] Ignoring force field update for local player\n";
         return;
     }
     
-    // Look up the player in the players map
-    auto& players = playerManager->GetPlayers();
-    auto it = players.find(normalizedPlayerID);
-    
-    if (it != players.end()) {
-        RemotePlayer& rp = it->second;
+    RemotePlayer* player = players.At(playerIndex);
+    if (player) {
+        RemotePlayer& rp = *player;
         
         // Make sure the player has a force field
         if (!rp.player.HasForceField()) {
@@ -126,7 +119,7 @@ void ClientNetwork::ProcessForceFieldUpdateMessage(Game& game, ClientNetwork& cl
             forceField->SetPowerLevel(parsed.ffPowerLevel);
             forceField->SetFieldType(static_cast<FieldType>(parsed.ffType));
             
-            std::cout << "[CLIENT] Updated force field for player " << normalizedPlayerID 
+            std::cout << "[CLIENT] Updated force field for player " << players.GetID(playerIndex) 
                       << " - Radius: " << parsed.ffRadius
                       << ", Damage: " << parsed.ffDamage
                       << ", Type: " << parsed.ffType << "\n";
@@ -142,39 +135,27 @@ void ClientNetwork::ProcessChatMessage(Game& game, ClientNetwork& client, const
 }
 
 void ClientNetwork::ProcessKillMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-    std::string killerID = parsed.steamID;
+    int killerIndex = parsed.playerSlot;
     int enemyId = parsed.enemyId;
     
-    std::cout << "[CLIENT] Received kill message from host - Player ID: " << killerID 
-              << ", Enemy ID: " << enemyId << "\n";
-    
-    // Normalize killer ID
-    std::string normalizedKillerID;
-    try {
-        uint64_t killerIdNum = std::stoull(killerID);
-        normalizedKillerID = std::to_string(killerIdNum);
-    } catch (const std::exception& e) {
-        std::cout << "[CLIENT] Error normalizing killer ID: " << e.what() << "\n";
-        normalizedKillerID = killerID;
-    }
+    LOG_DEBUG("CLIENT", "Received kill message from host - Player slot: {}, Enemy ID: {}", killerIndex, enemyId);
     
     // Update kill count based on host's authoritative message
     auto& players = playerManager->GetPlayers();
-    auto it = players.find(normalizedKillerID);
-    if (it != players.end()) {
-        it->second.kills++;
-        it->second.money += ENEMY_KILL_REWARD; // Award money for the kill
+    RemotePlayer* killer = players.At(killerIndex);
+    if (killer) {
+        killer->kills++;
+        killer->money += ENEMY_KILL_REWARD; // Award money for the kill
         
-        std::cout << "[CLIENT] Player " << normalizedKillerID << " awarded kill by host for enemy " 
-                  << enemyId << " - New kill count: " << it->second.kills << "\n";
+        LOG_DEBUG("CLIENT", "Player {} awarded kill by host for enemy {} - New kill count: {}",
+                  players.GetID(killerIndex), enemyId, killer->kills);
         
         // If it's the local player, make sure we process any effects
-        std::string localID = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
-        if (normalizedKillerID == localID) {
-            std::cout << "[CLIENT] Local player received kill confirmation from host\n";
+        if (killerIndex == playerManager->GetLocalPlayerIndex()) {
+            LOG_DEBUG("CLIENT", "Local player received kill confirmation from host");
         }
     } else {
-        std::cout << "[CLIENT] WARNING: Kill message for unknown player ID: " << normalizedKillerID << "\n";
+        LOG_WARNING("CLIENT", "Kill message for unknown player slot: {}", killerIndex);
     }
     
     // Make sure the enemy is removed locally too
@@ -202,83 +183,196 @@ void ClientNetwork::ProcessConnectionMessage(Game& game, ClientNetwork& client,
     rp.nameText.setCharacterSize(PLAYER_NAME_FONT_SIZE);
     rp.nameText.setFillColor(PLAYER_NAME_COLOR);
     
-    // Move into the players map
+    // Move into the registry, then adopt the slot the host assigned
     playerManager->AddOrUpdatePlayer(parsed.steamID, std::move(rp));
+    if (parsed.playerSlot != PLAYER_INVALID_INDEX) {
+        playerManager->AssignSlot(parsed.steamID, parsed.playerSlot);
+    }
     playerManager->SetReadyStatus(parsed.steamID, parsed.isReady);
+    
+    // The host replays our commands at its tick length, so run at its rate for the session.
+    // Commands still pending were recorded at the old rate and can't be replayed.
+    if (parsed.isHost && parsed.tickRate > 0 && parsed.tickRate != game.GetTickRate()) {
+        std::cout << "[CLIENT] Host runs at " << parsed.tickRate << " Hz, adopting it for this session\n";
+        game.SetTickRate(parsed.tickRate);
+        pendingInputs.clear();
+    }
 }
 
 void ClientNetwork::ProcessReadyStatusMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-    playerManager->SetReadyStatus(parsed.steamID, parsed.isReady);
+    auto& players = playerManager->GetPlayers();
+    if (players.At(parsed.playerSlot)) {
+        playerManager->SetReadyStatus(players.GetID(parsed.playerSlot), parsed.isReady);
+    }
 }
 
 void ClientNetwork::ProcessMovementMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-    std::string localSteamIDStr = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
-    if (parsed.steamID != localSteamIDStr) {
-        auto& playersMap = playerManager->GetPlayers();
-        auto existingPlayer = playersMap.find(parsed.steamID);
-        if (existingPlayer != playersMap.end()) {
-            // Update existing player's position
-            existingPlayer->second.previousPosition = existingPlayer->second.player.GetPosition();
-            existingPlayer->second.targetPosition = parsed.position;
-            existingPlayer->second.lastUpdateTime = std::chrono::steady_clock::now();
-        } else {
-            // Create a new player
-            RemotePlayer rp;
-            rp.playerID = parsed.steamID;
-            rp.player = Player(parsed.position, PLAYER_DEFAULT_COLOR);
-            rp.nameText.setFont(game.GetFont());
-            rp.nameText.setCharacterSize(PLAYER_NAME_FONT_SIZE);
-            rp.nameText.setFillColor(PLAYER_NAME_COLOR);
-            CSteamID id = CSteamID(std::stoull(parsed.steamID));
-            const char* name = SteamFriends()->GetFriendPersonaName(id);
-            std::string steamName = name ? name : "Unknown Player";
-            rp.nameText.setString(steamName);
-            rp.baseName = steamName;
-            // Add to the player manager using move semantics
-            playerManager->AddOrUpdatePlayer(parsed.steamID, std::move(rp));
-        }
+    // Players are created by the connection handshake; unknown slots wait for it
+    if (parsed.playerSlot == playerManager->GetLocalPlayerIndex()) return;
+    RemotePlayer* player = playerManager->GetPlayers().At(parsed.playerSlot);
+    if (player) {
+        // Update existing player's position
+        player->previousPosition = player->player.GetPosition();
+        player->targetPosition = parsed.position;
+        player->lastUpdateTime = std::chrono::steady_clock::now();
     }
 }
 
 void ClientNetwork::ProcessBulletMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-    std::string localSteamIDStr = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
-    std::string normalizedShooterID, normalizedLocalID;
-    try {
-        uint64_t shooterNum = std::stoull(parsed.steamID);
-        normalizedShooterID = std::to_string(shooterNum);
-        uint64_t localNum = std::stoull(localSteamIDStr);
-        normalizedLocalID = std::to_string(localNum);
-    } catch (const std::exception& e) {
-        std::cout << "[CLIENT] Error normalizing IDs: " << e.what() << "\n";
-        normalizedShooterID = parsed.steamID;
-        normalizedLocalID = localSteamIDStr;
-    }
-    
-    if (normalizedShooterID == normalizedLocalID) {
+    int shooterIndex = parsed.playerSlot;
+    
+    if (shooterIndex != PLAYER_INVALID_INDEX && shooterIndex == playerManager->GetLocalPlayerIndex()) {
         std::cout << "[CLIENT] Ignoring own bullet that was bounced back from server\n";
         return;
     }
     
     if (parsed.direction.x != 0.f || parsed.direction.y != 0.f) {
-        playerManager->AddBullet(normalizedShooterID, parsed.position, parsed.direction, parsed.velocity);
+        playerManager->AddBullet(shooterIndex, parsed.position, parsed.direction, parsed.velocity);
     } else {
         std::cout << "[CLIENT] Received bullet with invalid direction\n";
     }
 }
 
-void ClientNetwork::SendMovementUpdate(const sf::Vector2f& position) {
-    std::string msg = PlayerMessageHandler::FormatMovementMessage(std::to_string(SteamUser()->GetSteamID().ConvertToUint64()), position);
+void ClientNetwork::ProcessPlayerSnapshotMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+    auto& players = playerManager->GetPlayers();
+    auto now = std::chrono::steady_clock::now();
+    int localIndex = playerManager->GetLocalPlayerIndex();
+    
+    double snapshotTime = static_cast<double>(parsed.snapshotTime) / 1000.0;
+    if (parsed.snapshotTime != 0) {
+        SnapshotClock::Get().Observe(parsed.snapshotTime);
+    }
+    
+    for (const PlayerSnapshotEntry& entry : parsed.playerSnapshot) {
+        // The local player moves itself and is only reconciled; unknown slots wait for the handshake
+        if (entry.slot == localIndex) {
+            ReconcileLocalPlayer(entry);
+            continue;
+        }
+        RemotePlayer* rp = players.At(entry.slot);
+        if (!rp) continue;
+        
+        rp->previousPosition = rp->player.GetPosition();
+        rp->targetPosition = entry.position;
+        rp->velocity = entry.velocity;
+        rp->lastUpdateTime = now;
+        if (parsed.snapshotTime != 0) {
+            rp->snapshots.Push(snapshotTime, entry.position, entry.velocity);
+        }
+        
+        // Death and respawn stay event-driven; the snapshot only corrects health drift
+        if (entry.alive && !rp->player.IsDead() && entry.health > 0) {
+            rp->player.SetHealth(static_cast<float>(entry.health));
+        }
+    }
+}
+
+void ClientNetwork::RecordLocalInput() {
+    // Called once per tick, after PlayerManager applied this tick's input
+    uint8_t input = playerManager->GetLocalMovementInput();
+    Player& player = playerManager->GetLocalPlayer().player;
+    if (input == 0 || player.IsDead()) return;
+    
+    PendingInput command;
+    command.sequence = nextInputSequence++;
+    command.input = input;
+    command.speed = player.GetEffectiveSpeed();
+    command.dt = game->GetFixedTimestep();
+    command.positionBefore = player.GetPreviousPosition();
+    command.recordedAt = std::chrono::steady_clock::now();
+    pendingInputs.push_back(command);
+    
+    // A long outage: drop the oldest, the host adopts the next base position instead
+    if (pendingInputs.size() > MAX_PENDING_INPUTS) {
+        pendingInputs.pop_front();
+    }
+}
+
+void ClientNetwork::SendInputCommands() {
+    // Every unacknowledged command goes out again, so a lost batch costs nothing but latency
+    sf::Vector2f basePosition = playerManager->GetLocalPlayer().player.GetPosition();
+    uint32_t firstSequence = nextInputSequence;
+    
+    inputBatch.clear();
+    if (!pendingInputs.empty()) {
+        basePosition = pendingInputs.front().positionBefore;
+        firstSequence = pendingInputs.front().sequence;
+        for (const PendingInput& command : pendingInputs) {
+            inputBatch.push_back(command.input);
+        }
+    }
+    
+    std::string msg = PlayerMessageHandler::FormatPlayerInputMessage(firstSequence, basePosition, inputBatch,
+                                                                     game->GetTickRate());
     game->GetNetworkManager().SendMessage(hostID, msg);
 }
 
+void ClientNetwork::ReconcileLocalPlayer(const PlayerSnapshotEntry& entry) {
+    // Only a newly acknowledged command says anything about our prediction; older or
+    // repeated acks would pull us back to where the host last saw us
+    if (entry.ack <= lastAckedInput) return;
+    lastAckedInput = entry.ack;
+    while (!pendingInputs.empty() && pendingInputs.front().sequence <= entry.ack) {
+        // Recorded to acknowledged: wire time both ways plus send batching and the host's tick
+        if (pendingInputs.front().sequence == entry.ack) {
+            FlightRecorder::Get().SetRoundTrip(std::chrono::duration<float, std::milli>(
+                std::chrono::steady_clock::now() - pendingInputs.front().recordedAt).count());
+        }
+        pendingInputs.pop_front();
+    }
+    
+    Player& player = playerManager->GetLocalPlayer().player;
+    if (player.IsDead() || !entry.alive) return;
+    
+    // Host result plus the commands still in flight is where we should be now
+    sf::Vector2f predicted = entry.position;
+    for (const PendingInput& command : pendingInputs) {
+        predicted += Player::MovementDelta(command.input, command.speed, command.dt);
+    }
+    
+    sf::Vector2f error = predicted - player.GetPosition();
+    float magnitude = std::sqrt(error.x * error.x + error.y * error.y);
+    RecordPredictionError(magnitude);
+    if (magnitude > CORRECTION_EPSILON) {
+        player.SetPosition(predicted);
+    }
+}
+
+void ClientNetwork::RecordPredictionError(float error) {
+    predictionAcks++;
+    if (error > CORRECTION_EPSILON) {
+        predictionCorrections++;
+        predictionErrorSum += error;
+        predictionErrorMax = std::max(predictionErrorMax, error);
+    }
+}
+
+void ClientNetwork::ReportPrediction() {
+    auto now = std::chrono::steady_clock::now();
+    if (std::chrono::duration<float>(now - lastPredictionReport).count() < PREDICTION_REPORT_INTERVAL) return;
+    lastPredictionReport = now;
+    if (predictionAcks == 0) return;
+    
+    float meanCorrection = predictionCorrections > 0 ? predictionErrorSum / predictionCorrections : 0.f;
+    std::cout << "[PREDICTION] acks: " << predictionAcks 
+              << ", corrections: " << predictionCorrections 
+              << " (" << (100 * predictionCorrections / predictionAcks) << "%)"
+              << ", mean: " << meanCorrection << " px"
+              << ", max: " << predictionErrorMax << " px"
+              << ", unacked: " << pendingInputs.size() << "\n";
+    predictionAcks = 0;
+    predictionCorrections = 0;
+    predictionErrorSum = 0.f;
+    predictionErrorMax = 0.f;
+}
+
 void ClientNetwork::SendChatMessage(const std::string& message) {
-    std::string msg = SystemMessageHandler::FormatChatMessage(std::to_string(SteamUser()->GetSteamID().ConvertToUint64()), message);
+    std::string msg = SystemMessageHandler::FormatChatMessage(SessionContext::Get().GetLocalIDString(), message);
     game->GetNetworkManager().SendMessage(hostID, msg);
 }
 
 void ClientNetwork::SendConnectionMessage() {
-    CSteamID myID = SteamUser()->GetSteamID();
-    std::string steamIDStr = std::to_string(myID.ConvertToUint64());
+    std::string steamIDStr = SessionContext::Get().GetLocalIDString();
     std::string steamName = SteamFriends()->GetPersonaName();
     sf::Color color = PLAYER_DEFAULT_COLOR;
     std::string connectMsg = PlayerMessageHandler::FormatConnectionMessage(steamIDStr, steamName, color, false, false);
@@ -293,8 +387,7 @@ void ClientNetwork::SendConnectionMessage() {
 }
 
 void ClientNetwork::SendReadyStatus(bool isReady) {
-    std::string steamIDStr = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
-    std::string msg = StateMessageHandler::FormatReadyStatusMessage(steamIDStr, isReady);
+    std::string msg = StateMessageHandler::FormatReadyStatusMessage(playerManager->GetLocalPlayerIndex(), isReady);
     
     if (game->GetNetworkManager().SendMessage(hostID, msg)) {
         std::cout << "[CLIENT] Sent ready status: " << (isReady ? "true" : "false") << "\n";
@@ -338,12 +431,13 @@ void ClientNetwork::Update() {
     auto now = std::chrono::steady_clock::now();
     float elapsed = std::chrono::duration<float>(now - lastSendTime).count();
     
-    // Update movement sending
-    if (elapsed >= SEND_INTERVAL) {
-        auto& localPlayer = playerManager->GetLocalPlayer().player;
-        SendMovementUpdate(localPlayer.GetPosition());
+    // Idle ticks produce no commands, so nothing is sent while standing still but a heartbeat
+    RecordLocalInput();
+    if (elapsed >= SEND_INTERVAL && (!pendingInputs.empty() || elapsed >= HEARTBEAT_INTERVAL)) {
+        SendInputCommands();
         lastSendTime = now;
     }
+    ReportPrediction();
     
     // Handle pending connection message
     if (pendingConnectionMessage) {
@@ -399,43 +493,23 @@ void ClientNetwork::Update() {
 }
 
 void ClientNetwork::ProcessPlayerDeathMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-    std::string normalizedID = parsed.steamID;
-    try {
-        uint64_t idNum = std::stoull(parsed.steamID);
-        normalizedID = std::to_string(idNum);
-    } catch (const std::exception& e) {
-        std::cout << "[CLIENT] Error normalizing player ID in ProcessPlayerDeathMessage: " << e.what() << "\n";
-        normalizedID = parsed.steamID;
-    }
-    
     auto& players = playerManager->GetPlayers();
-    auto it = players.find(normalizedID);
-    if (it != players.end()) {
-        RemotePlayer& player = it->second;
+    int playerIndex = parsed.playerSlot;
+    RemotePlayer* victim = players.At(playerIndex);
+    if (victim) {
+        RemotePlayer& player = *victim;
         sf::Vector2f currentPos = player.player.GetPosition();
         player.player.SetRespawnPosition(currentPos);
         player.player.TakeDamage(player.player.GetHealth()); // Take full damage to ensure death
         player.respawnTimer = RESPAWN_TIME;
-        std::cout << "[CLIENT] Player " << normalizedID << " died\n";
+        std::cout << "[CLIENT] Player " << players.GetID(playerIndex) << " died\n";
     }
     
-    if (!parsed.killerID.empty()) {
-        std::string normalizedKillerID = parsed.killerID;
-        try {
-            uint64_t killerIdNum = std::stoull(parsed.killerID);
-            normalizedKillerID = std::to_string(killerIdNum);
-        } catch (const std::exception& e) {
-            normalizedKillerID = parsed.killerID;
-        }
-        
-        auto killerIt = players.find(normalizedKillerID);
-        if (killerIt != players.end()) {
-            playerManager->IncrementPlayerKills(normalizedKillerID);
-        }
+    if (players.At(parsed.killerSlot)) {
+        playerManager->IncrementPlayerKills(parsed.killerSlot);
     }
     
-    std::string localPlayerID = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
-    if (normalizedID == localPlayerID) {
+    if (playerIndex != PLAYER_INVALID_INDEX && playerIndex == playerManager->GetLocalPlayerIndex()) {
         std::cout << "[CLIENT] Local player died, will request validation after 1 second\n";
         m_validationRequestTimer = 1.0f;
     } else {
@@ -444,32 +518,26 @@ void ClientNetwork::ProcessPlayerDeathMessage(Game& game, ClientNetwork& client,
 }
 
 void ClientNetwork::ProcessPlayerRespawnMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-    std::string normalizedID = parsed.steamID;
-    try {
-        uint64_t idNum = std::stoull(parsed.steamID);
-        normalizedID = std::to_string(idNum);
-    } catch (const std::exception& e) {
-        std::cout << "[CLIENT] Error normalizing player ID in ProcessPlayerRespawnMessage: " << e.what() << "\n";
-    }
-    
-    std::string localSteamIDStr = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
     auto& players = playerManager->GetPlayers();
-    auto it = players.find(normalizedID);
+    RemotePlayer* respawned = players.At(parsed.playerSlot);
     
-    if (it != players.end()) {
-        RemotePlayer& player = it->second;
+    if (respawned) {
+        RemotePlayer& player = *respawned;
         int oldHealth = player.player.GetHealth();
         bool wasDead = player.player.IsDead();
         
         player.player.SetRespawnPosition(parsed.position);
         player.player.Respawn();
+        player.snapshots.Clear();   // Don't interpolate across the map from the death position
+        player.previousPosition = parsed.position;
+        player.targetPosition = parsed.position;
         
         if (player.player.GetHealth() < PLAYER_HEALTH) {
             std::cout << "[CLIENT] WARNING: Player health not fully restored after respawn, forcing to full health\n";
             player.player.TakeDamage(-PLAYER_HEALTH); // Heal to full health
         }
     } else {
-        std::cout << "[CLIENT] Could not find player " << normalizedID << " to respawn from network message\n";
+        std::cout << "[CLIENT] Could not find player in slot " << parsed.playerSlot << " to respawn from network message\n";
     }
 }
 
@@ -481,13 +549,9 @@ void ClientNetwork::ProcessStartGameMessage(Game& game, ClientNetwork& client, c
 }
 
 void ClientNetwork::ProcessPlayerDamageMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-    std::string localSteamIDStr = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
-    if (parsed.steamID == localSteamIDStr) {
-        auto& players = playerManager->GetPlayers();
-        auto it = players.find(localSteamIDStr);
-        if (it != players.end()) {
-            it->second.player.TakeDamage(parsed.damage);
-        }
+    int localIndex = playerManager->GetLocalPlayerIndex();
+    if (localIndex != PLAYER_INVALID_INDEX && parsed.playerSlot == localIndex) {
+        playerManager->GetLocalPlayer().player.TakeDamage(parsed.damage);
     }
 }
 
@@ -496,33 +560,14 @@ void ClientNetwork::ProcessUnknownMessage(Game& game, ClientNetwork& client, con
 }
 
 void ClientNetwork::ProcessForceFieldZapMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-    std::string zapperID = parsed.steamID;
     int enemyId = parsed.enemyId;
     float damage = parsed.damage;
     
-    // Normalize player ID for consistent comparison
-    std::string normalizedZapperID;
-    try {
-        uint64_t zapperIdNum = std::stoull(zapperID);
-        normalizedZapperID = std::to_string(zapperIdNum);
-    } catch (const std::exception& e) {
-        std::cout << "[CLIENT] Error normalizing zapper ID: " << e.what() << "\n";
-        normalizedZapperID = zapperID;
-    }
-    
-    // Get the local player ID
-    std::string localID = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
-    std::string normalizedLocalID;
-    try {
-        uint64_t localIdNum = std::stoull(localID);
-        normalizedLocalID = std::to_string(localIdNum);
-    } catch (const std::exception& e) {
-        std::cout << "[CLIENT] Error normalizing local ID: " << e.what() << "\n";
-        normalizedLocalID = localID;
-    }
+    auto& players = playerManager->GetPlayers();
+    int zapperIndex = parsed.playerSlot;
     
     // Don't process our own zap messages that are echoed back from host
-    if (normalizedZapperID == normalizedLocalID) {
+    if (zapperIndex != PLAYER_INVALID_INDEX && zapperIndex == playerManager->GetLocalPlayerIndex()) {
         return;
     }
     
@@ -538,10 +583,9 @@ void ClientNetwork::ProcessForceFieldZapMessage(Game& game, ClientNetwork& clien
             bool killed = enemyManager->InflictDamage(enemyId, damage);
             
             // Get the player who owns the force field
-            auto& players = playerManager->GetPlayers();
-            auto it = players.find(normalizedZapperID);
-            if (it != players.end()) {
-                RemotePlayer& rp = it->second;
+            RemotePlayer* zapper = players.At(zapperIndex);
+            if (zapper) {
+                RemotePlayer& rp = *zapper;
                 
                 // Make sure the player has a force field
                 if (!rp.player.HasForceField()) {
@@ -6,6 +6,8 @@
 #include <string>
 #include <unordered_map>
 #include <chrono>
+#include <deque>
+#include <vector>
 #include "messages/MessageHandler.h"
 #include "../entities/player/Player.h"
 #include "../utils/SteamHelpers.h"
@@ -29,7 +31,7 @@ public:
     CSteamID GetHostID() const { return hostID; }
     
     // Network communication methods
-    void SendMovementUpdate(const sf::Vector2f& position);
+    void SendInputCommands();
     void SendChatMessage(const std::string& message);
     void SendConnectionMessage();
     void SendReadyStatus(bool isReady);
@@ -52,8 +54,25 @@ public:
     void ProcessForceFieldZapMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed);
     void ProcessForceFieldUpdateMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed);
     void ProcessKillMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed);
+    void ProcessPlayerSnapshotMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed);
     
 private:
+    // Client-side prediction: the local player moves immediately, every movement tick is kept
+    // as a numbered command until the host acknowledges it, and host results are replayed
+    // forward through the commands it hasn't seen yet.
+    struct PendingInput {
+        uint32_t sequence;
+        uint8_t input;
+        float speed;
+        float dt;
+        sf::Vector2f positionBefore;
+        std::chrono::steady_clock::time_point recordedAt;   // For the input round trip
+    };
+    void RecordLocalInput();
+    void ReconcileLocalPlayer(const PlayerSnapshotEntry& entry);
+    void RecordPredictionError(float error);
+    void ReportPrediction();
+    
     // Core references
     Game* game;
     PlayerManager* playerManager;
@@ -69,6 +88,19 @@ private:
     
     // Timers and intervals
     std::chrono::steady_clock::time_point lastSendTime;
+    
+    // Prediction state
+    std::deque<PendingInput> pendingInputs;
+    std::vector<uint8_t> inputBatch;
+    uint32_t nextInputSequence = 1;
+    uint32_t lastAckedInput = 0;
+    
+    // Correction measurement, reported every PREDICTION_REPORT_INTERVAL
+    std::chrono::steady_clock::time_point lastPredictionReport;
+    int predictionAcks = 0;
+    int predictionCorrections = 0;
+    float predictionErrorSum = 0.f;
+    float predictionErrorMax = 0.f;
     std::chrono::steady_clock::time_point m_lastValidationTime;
     std::chrono::steady_clock::time_point m_lastStateRequestTime;
     float m_validationRequestTimer = -1.0f;
@@ -78,7 +110,11 @@ private:
     int m_consecutiveStateRequests = 0;
     
     // Constants
-    static constexpr float SEND_INTERVAL = 0.1f;
+    static constexpr float SEND_INTERVAL = 0.05f;      // Fastest rate for input batches
+    static constexpr float HEARTBEAT_INTERVAL = 1.0f;  // An empty batch is sent this often when idle
+    static constexpr size_t MAX_PENDING_INPUTS = 120;  // Unacknowledged commands kept (2 s at 60 Hz)
+    static constexpr float CORRECTION_EPSILON = 0.01f; // Prediction errors below this are left alone
+    static constexpr float PREDICTION_REPORT_INTERVAL = 5.0f;
     static constexpr float MIN_STATE_REQUEST_COOLDOWN = 2.0f;
     static constexpr float MAX_STATE_REQUEST_COOLDOWN = 30.0f;
     static constexpr int MAX_CONSECUTIVE_REQUESTS = 5;
@@ -8,6 +8,8 @@
 #include "messages/SystemMessageHandler.h"
 #include "../states/PlayingState.h"
 #include "../utils/config/Config.h"
+#include "../core/Logger.h"
+#include <algorithm>
 #include <iostream>
 
 HostNetwork::HostNetwork(Game* game, PlayerManager* manager)
@@ -95,34 +97,68 @@ void HostNetwork::ProcessConnectionMessage(Game& game, HostNetwork& host, const
 }
 
 void HostNetwork::ProcessMovementMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-    if (parsed.steamID.empty()) {
-        std::cout << "[HOST] Invalid movement message from " << sender.ConvertToUint64() << "\n";
+    // Movement is always about the sender; the handshake gave them a slot
+    int slot = SenderSlot(sender);
+    RemotePlayer* player = playerManager->GetPlayers().At(slot);
+    if (!player) {
+        std::cout << "[HOST] Movement from unregistered sender " << sender.ConvertToUint64() << "\n";
         return;
     }
     
-    // Look up the player
-    auto& playersMap = playerManager->GetPlayers();
-    auto playerIt = playersMap.find(parsed.steamID);
+    // Update existing player's position; clients see it in the next snapshot
+    player->previousPosition = player->player.GetPosition();
+    player->targetPosition = parsed.position;
+    player->lastUpdateTime = std::chrono::steady_clock::now();
+}
+
+void HostNetwork::ProcessPlayerInputMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+    int slot = SenderSlot(sender);
+    RemotePlayer* player = playerManager->GetPlayers().At(slot);
+    if (!player) {
+        std::cout << "[HOST] Input from unregistered sender " << sender.ConvertToUint64() << "\n";
+        return;
+    }
     
-    if (playerIt != playersMap.end()) {
-        // Update existing player's position
-        playerIt->second.previousPosition = playerIt->second.player.GetPosition();
-        playerIt->second.targetPosition = parsed.position;
-        playerIt->second.lastUpdateTime = std::chrono::steady_clock::now();
-    } else {
-        // Create a new player if needed
-        RemotePlayer rp;
-        rp.playerID = parsed.steamID;
-        rp.player = Player(parsed.position, PLAYER_DEFAULT_COLOR);
-        rp.nameText.setFont(game.GetFont());
-        rp.nameText.setCharacterSize(PLAYER_NAME_FONT_SIZE);
-        rp.nameText.setFillColor(PLAYER_NAME_COLOR);
-        playerManager->AddOrUpdatePlayer(parsed.steamID, std::move(rp));
+    // Clients resend every unacknowledged command, so most batches overlap what was already applied
+    // Commands are one client tick each; a client still on another rate would move at the wrong
+    // pace here, so drop its batches until it has adopted ours from the handshake
+    if (parsed.tickRate != 0 && parsed.tickRate != game.GetTickRate()) {
+        LOG_WARNING("HOST", "Dropping input at {} Hz from slot {}, host runs at {} Hz",
+                    parsed.tickRate, slot, game.GetTickRate());
+        return;
     }
     
-    // Broadcast the movement to all clients
-    std::string broadcastMsg = PlayerMessageHandler::FormatMovementMessage(parsed.steamID, parsed.position);
-    game.GetNetworkManager().BroadcastMessage(broadcastMsg);
+    uint32_t last = player->lastInputSequence;
+    uint32_t first = parsed.inputSequence;
+    uint32_t count = static_cast<uint32_t>(parsed.movementInputs.size());
+    if (count > 0 && first + count - 1 <= last) return;
+    
+    // The host simulates from its own result, at its own speed and tick length. Spawning and
+    // respawning set that result directly, so the client's base position only matters when
+    // commands were lost for good (the client trims its backlog), and even then the client
+    // can't have got further than the missing commands would have taken it.
+    float speed = player->player.GetEffectiveSpeed();
+    float dt = game.GetFixedTimestep();
+    sf::Vector2f authoritative = player->targetPosition;
+    if (first > last + 1) {
+        float reach = (first - last - 1) * speed * dt;
+        sf::Vector2f offset = parsed.position - authoritative;
+        offset.x = std::max(-reach, std::min(offset.x, reach));
+        offset.y = std::max(-reach, std::min(offset.y, reach));
+        authoritative += offset;
+    }
+    
+    for (uint32_t i = 0; i < count; ++i) {
+        if (first + i <= last) continue;
+        authoritative += Player::MovementDelta(parsed.movementInputs[i], speed, dt);
+    }
+    if (count > 0) {
+        player->lastInputSequence = first + count - 1;
+    }
+    
+    player->previousPosition = player->player.GetPosition();
+    player->targetPosition = authoritative;
+    player->lastUpdateTime = std::chrono::steady_clock::now();
 }
 
 void HostNetwork::ProcessChatMessageParsed(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
@@ -134,52 +170,43 @@ void HostNetwork::ProcessChatMessage(const std::string& message, CSteamID sender
     game->GetNetworkManager().BroadcastMessage(msg);
 }
 void HostNetwork::ProcessForceFieldUpdateMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-    // Get the player ID from the message
-    std::string playerID = parsed.steamID;
+    // Force field updates are always about the sender
+    auto& players = playerManager->GetPlayers();
+    int playerIndex = SenderSlot(sender);
+    const std::string& playerID = players.GetID(playerIndex);
     
-    // Normalize player ID for consistent comparison
-    std::string normalizedPlayerID;
-    try {
-        uint64_t idNum = std::stoull(playerID);
-        normalizedPlayerID = std::to_string(idNum);
-    } catch (const std::exception& e) {
-        std::cout << "[HOST] Error normalizing player ID in ProcessForceFieldUpdateMessage: " << e.what() << "\n";
-        normalizedPlayerID = playerID;
+    RemotePlayer* player = players.At(playerIndex);
+    if (!player) {
+        std::cout << "[HOST] Force field update from unregistered sender " << sender.ConvertToUint64() << "\n";
+        return;
     }
+    RemotePlayer& rp = *player;
     
-    // Look up the player in the players map
-    auto& players = playerManager->GetPlayers();
-    auto it = players.find(normalizedPlayerID);
+    // Make sure the player has a force field
+    if (!rp.player.HasForceField()) {
+        rp.player.InitializeForceField();
+    }
     
-    if (it != players.end()) {
-        RemotePlayer& rp = it->second;
+    ForceField* forceField = rp.player.GetForceField();
+    if (forceField) {
+        // Update the force field parameters
+        forceField->SetRadius(parsed.ffRadius);
+        forceField->SetDamage(parsed.ffDamage);
+        forceField->SetCooldown(parsed.ffCooldown);
+        forceField->SetChainLightningTargets(parsed.ffChainTargets);
+        forceField->SetChainLightningEnabled(parsed.ffChainEnabled);
+        forceField->SetPowerLevel(parsed.ffPowerLevel);
+        forceField->SetFieldType(static_cast<FieldType>(parsed.ffType));
         
-        // Make sure the player has a force field
-        if (!rp.player.HasForceField()) {
-            rp.player.InitializeForceField();
-        }
-        
-        ForceField* forceField = rp.player.GetForceField();
-        if (forceField) {
-            // Update the force field parameters
-            forceField->SetRadius(parsed.ffRadius);
-            forceField->SetDamage(parsed.ffDamage);
-            forceField->SetCooldown(parsed.ffCooldown);
-            forceField->SetChainLightningTargets(parsed.ffChainTargets);
-            forceField->SetChainLightningEnabled(parsed.ffChainEnabled);
-            forceField->SetPowerLevel(parsed.ffPowerLevel);
-            forceField->SetFieldType(static_cast<FieldType>(parsed.ffType));
-            
-            std::cout << "[HOST] Updated force field for player " << normalizedPlayerID 
-                      << " - Radius: " << parsed.ffRadius
-                      << ", Damage: " << parsed.ffDamage
-                      << ", Type: " << parsed.ffType << "\n";
-        }
+        std::cout << "[HOST] Updated force field for player " << playerID 
+                  << " - Radius: " << parsed.ffRadius
+                  << ", Damage: " << parsed.ffDamage
+                  << ", Type: " << parsed.ffType << "\n";
     }
     
     // Broadcast the force field update to all clients
     std::string updateMsg = PlayerMessageHandler::FormatForceFieldUpdateMessage(
-        normalizedPlayerID,
+        playerIndex,
         parsed.ffRadius,
         parsed.ffDamage,
         parsed.ffCooldown,
@@ -193,18 +220,11 @@ void HostNetwork::ProcessForceFieldUpdateMessage(Game& game, HostNetwork& host,
 }
 
 void HostNetwork::ProcessKillMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-    std::string killerID = parsed.steamID;
     int enemyId = parsed.enemyId;
     
-    // Normalize killer ID for consistent comparison
-    std::string normalizedKillerID;
-    try {
-        uint64_t killerIdNum = std::stoull(killerID);
-        normalizedKillerID = std::to_string(killerIdNum);
-    } catch (const std::exception& e) {
-        std::cout << "[HOST] Error normalizing killer ID: " << e.what() << "\n";
-        normalizedKillerID = killerID;
-    }
+    // Clients only claim kills for themselves
+    auto& players = playerManager->GetPlayers();
+    int killerIndex = SenderSlot(sender);
     
     // Validate the kill (check if the enemy exists and is alive)
     bool validKill = false;
@@ -214,111 +234,119 @@ void HostNetwork::ProcessKillMessage(Game& game, HostNetwork& host, const Parsed
         validKill = (enemy != nullptr);
     }
     
-    if (validKill) {
+    if (validKill && killerIndex != PLAYER_INVALID_INDEX) {
         // This is where the host acts as authority - increment kill count
-        playerManager->IncrementPlayerKills(normalizedKillerID);
+        playerManager->IncrementPlayerKills(killerIndex);
         
         // Broadcast the validated kill to all clients
-        std::string killMsg = PlayerMessageHandler::FormatKillMessage(normalizedKillerID, enemyId);
+        std::string killMsg = PlayerMessageHandler::FormatKillMessage(killerIndex, enemyId);
         game.GetNetworkManager().BroadcastMessage(killMsg);
         
-        std::cout << "[HOST] Validated and broadcast kill for player " << normalizedKillerID << "\n";
+        LOG_DEBUG("HOST", "Validated and broadcast kill for player {}", players.GetID(killerIndex));
     } else {
-        std::cout << "[HOST] Rejected invalid kill claim for player " << normalizedKillerID << "\n";
+        LOG_WARNING("HOST", "Rejected invalid kill claim from {}", sender.ConvertToUint64());
     }
 }
 void HostNetwork::ProcessReadyStatusMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-    std::string localSteamIDStr = std::to_string(game.GetLocalSteamID().ConvertToUint64());
-    if (localSteamIDStr != parsed.steamID) {
-        auto& players = playerManager->GetPlayers();
-        if (players.find(parsed.steamID) != players.end() && players[parsed.steamID].isReady != parsed.isReady) {
-            playerManager->SetReadyStatus(parsed.steamID, parsed.isReady);
-        }
+    auto& players = playerManager->GetPlayers();
+    int slot = SenderSlot(sender);
+    RemotePlayer* player = players.At(slot);
+    if (!player) {
+        return;
+    }
+    if (slot != playerManager->GetLocalPlayerIndex() && player->isReady != parsed.isReady) {
+        playerManager->SetReadyStatus(players.GetID(slot), parsed.isReady);
     }
-    std::string broadcastMsg = StateMessageHandler::FormatReadyStatusMessage(parsed.steamID, parsed.isReady);
+    std::string broadcastMsg = StateMessageHandler::FormatReadyStatusMessage(slot, parsed.isReady);
     game.GetNetworkManager().BroadcastMessage(broadcastMsg);
 }
 
 void HostNetwork::ProcessBulletMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-    std::string localSteamIDStr = std::to_string(game.GetLocalSteamID().ConvertToUint64());
-    std::string normalizedShooterID;
-    std::string normalizedLocalID;
-    try {
-        uint64_t shooterNum = std::stoull(parsed.steamID);
-        normalizedShooterID = std::to_string(shooterNum);
-        uint64_t localNum = std::stoull(localSteamIDStr);
-        normalizedLocalID = std::to_string(localNum);
-    } catch (const std::exception& e) {
-        std::cout << "[HOST] Error normalizing IDs: " << e.what() << "\n";
-        normalizedShooterID = parsed.steamID;
-        normalizedLocalID = localSteamIDStr;
+    int shooterIndex = SenderSlot(sender);
+    if (shooterIndex == PLAYER_INVALID_INDEX) {
+        std::cout << "[HOST] Bullet from unregistered sender " << sender.ConvertToUint64() << "\n";
+        return;
     }
     if (parsed.direction.x == 0.f && parsed.direction.y == 0.f) {
         std::cout << "[HOST] Received invalid bullet direction, ignoring\n";
         return;
     }
-    std::string broadcastMsg = PlayerMessageHandler::FormatBulletMessage(normalizedShooterID, parsed.position, parsed.direction, parsed.velocity);
+    std::string broadcastMsg = PlayerMessageHandler::FormatBulletMessage(shooterIndex, parsed.position, parsed.direction, parsed.velocity);
     bool sent = game.GetNetworkManager().BroadcastMessage(broadcastMsg);
     
-    if (normalizedShooterID == normalizedLocalID) {
+    if (shooterIndex == playerManager->GetLocalPlayerIndex()) {
         std::cout << "[HOST] Ignoring own bullet that was received as a message\n";
         return;
     }
-    playerManager->AddBullet(normalizedShooterID, parsed.position, parsed.direction, parsed.velocity);
+    
+    // Lag compensation: the shot is resolved against enemies as they were on the shooter's screen
+    uint8_t rewindTicks = 0;
+    PlayingState* state = GetPlayingState(&game);
+    if (parsed.viewTime != 0 && state && state->GetEnemyManager()) {
+        uint64_t now = SnapshotClock::HostNow();
+        float rewind = parsed.viewTime < now ? static_cast<float>(now - parsed.viewTime) / 1000.0f : 0.f;
+        rewind = std::min(rewind, BULLET_LAG_COMP_MAX_REWIND);
+        int ticks = static_cast<int>(std::lround(rewind / game.GetFixedTimestep()));
+        rewindTicks = static_cast<uint8_t>(std::min(ticks, state->GetEnemyManager()->GetMaxRewindTicks()));
+    }
+    playerManager->AddBullet(shooterIndex, parsed.position, parsed.direction, parsed.velocity, rewindTicks);
 }
 
 void HostNetwork::BroadcastFullPlayerList() {
+    // This is the slot table: one connection message per player, each carrying its slot
     auto& players = playerManager->GetPlayers();
-    for (const auto& pair : players) {
-        const RemotePlayer& rp = pair.second;
-        std::string msg = PlayerMessageHandler::FormatConnectionMessage(rp.playerID, rp.baseName, rp.cubeColor, rp.isReady, rp.isHost);
+    for (auto it = players.begin(); it != players.end(); ++it) {
+        const RemotePlayer& rp = it->second;
+        std::string msg = PlayerMessageHandler::FormatConnectionMessage(rp.playerID, rp.baseName, rp.cubeColor, rp.isReady, rp.isHost,
+                                                                        players.IndexOf(it), game->GetTickRate());
         game->GetNetworkManager().BroadcastMessage(msg);
     }
 }
 
-void HostNetwork::BroadcastPlayersList() {
-    auto& players = playerManager->GetPlayers();
-    for (auto& pair : players) {
-        std::string msg = PlayerMessageHandler::FormatMovementMessage(pair.first, pair.second.player.GetPosition());
-        game->GetNetworkManager().BroadcastMessage(msg);
-    }
+void HostNetwork::BroadcastPlayerSnapshot(float elapsed) {
+    // One message per interval carries every player, instead of one per player
+    std::string msg = snapshotWriter.Write(*playerManager, elapsed);
+    if (msg.empty()) return;
+    game->GetNetworkManager().BroadcastMessage(msg);
 }
 
 void HostNetwork::Update() {
     auto now = std::chrono::steady_clock::now();
     float elapsed = std::chrono::duration<float>(now - lastBroadcastTime).count();
-    if (elapsed >= BROADCAST_INTERVAL) {
-        BroadcastPlayersList();
+    if (elapsed >= PlayerSnapshotWriter::INTERVAL) {
+        BroadcastPlayerSnapshot(elapsed);
         lastBroadcastTime = now;
     }
 }
 
 void HostNetwork::ProcessPlayerDeathMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-    std::string playerID = parsed.steamID;
-    std::string killerID = parsed.killerID;
+    // Clients report their own deaths; the killer is referenced by slot
     auto& players = playerManager->GetPlayers();
-    if (players.find(playerID) != players.end()) {
-        RemotePlayer& player = players[playerID];
-        player.player.TakeDamage(player.player.GetHealth()); // Take full damage to ensure death
-        player.respawnTimer = RESPAWN_TIME;
+    int playerIndex = SenderSlot(sender);
+    int killerIndex = parsed.killerSlot;
+    RemotePlayer* player = players.At(playerIndex);
+    if (player) {
+        player->player.TakeDamage(player->player.GetHealth()); // Take full damage to ensure death
+        player->respawnTimer = RESPAWN_TIME;
     }
-    if (players.find(killerID) != players.end()) {
-        playerManager->IncrementPlayerKills(killerID);
+    if (players.At(killerIndex)) {
+        playerManager->IncrementPlayerKills(killerIndex);
     }
-    std::string deathMsg = PlayerMessageHandler::FormatPlayerDeathMessage(playerID, killerID);
+    std::string deathMsg = PlayerMessageHandler::FormatPlayerDeathMessage(playerIndex, killerIndex);
     game.GetNetworkManager().BroadcastMessage(deathMsg);
 }
 
 void HostNetwork::ProcessPlayerRespawnMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-    std::string playerID = parsed.steamID;
+    int playerIndex = SenderSlot(sender);
     sf::Vector2f respawnPos = parsed.position;
-    auto& players = playerManager->GetPlayers();
-    if (players.find(playerID) != players.end()) {
-        RemotePlayer& player = players[playerID];
-        player.player.SetRespawnPosition(respawnPos);
-        player.player.Respawn();
+    RemotePlayer* player = playerManager->GetPlayers().At(playerIndex);
+    if (player) {
+        player->player.SetRespawnPosition(respawnPos);
+        player->player.Respawn();
+        player->previousPosition = respawnPos;
+        player->targetPosition = respawnPos;
     }
-    std::string respawnMsg = PlayerMessageHandler::FormatPlayerRespawnMessage(playerID, respawnPos);
+    std::string respawnMsg = PlayerMessageHandler::FormatPlayerRespawnMessage(playerIndex, respawnPos);
     game.GetNetworkManager().BroadcastMessage(respawnMsg);
 }
 
@@ -330,7 +358,7 @@ void HostNetwork::ProcessStartGameMessage(Game& game, HostNetwork& host, const P
 }
 
 void HostNetwork::ProcessPlayerDamageMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-    std::cout << "[HOST] Received player damage message for player " << parsed.steamID << "\n";
+    std::cout << "[HOST] Received player damage message for slot " << parsed.playerSlot << "\n";
 }
 
 void HostNetwork::ProcessUnknownMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
@@ -338,30 +366,12 @@ void HostNetwork::ProcessUnknownMessage(Game& game, HostNetwork& host, const Par
 }
 
 void HostNetwork::ProcessForceFieldZapMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-    std::string zapperID = parsed.steamID;
     int enemyId = parsed.enemyId;
     float damage = parsed.damage;
     
-    // Normalize player ID for consistent comparison
-    std::string normalizedZapperID;
-    try {
-        uint64_t zapperIdNum = std::stoull(zapperID);
-        normalizedZapperID = std::to_string(zapperIdNum);
-    } catch (const std::exception& e) {
-        std::cout << "[HOST] Error normalizing zapper ID: " << e.what() << "\n";
-        normalizedZapperID = zapperID;
-    }
-    
-    // Get the local player ID
-    std::string localID = std::to_string(game.GetLocalSteamID().ConvertToUint64());
-    std::string normalizedLocalID;
-    try {
-        uint64_t localIdNum = std::stoull(localID);
-        normalizedLocalID = std::to_string(localIdNum);
-    } catch (const std::exception& e) {
-        std::cout << "[HOST] Error normalizing local ID: " << e.what() << "\n";
-        normalizedLocalID = localID;
-    }
+    // Zaps are always reported by the field's owner
+    auto& players = playerManager->GetPlayers();
+    int zapperIndex = SenderSlot(sender);
     
     // Get the playing state to access the enemy manager
     PlayingState* playingState = GetPlayingState(&game);
@@ -376,16 +386,15 @@ void HostNetwork::ProcessForceFieldZapMessage(Game& game, HostNetwork& host, con
             
             // If the enemy was killed, use centralized kill handling
             if (killed) {
-                playerManager->HandleKill(normalizedZapperID, enemyId);
+                playerManager->HandleKill(zapperIndex, enemyId);
             }
             
             // Apply visual effect if this isn't our own zap
-            if (normalizedZapperID != normalizedLocalID) {
+            if (zapperIndex != playerManager->GetLocalPlayerIndex()) {
                 // Get the player who owns the force field
-                auto& players = playerManager->GetPlayers();
-                auto it = players.find(normalizedZapperID);
-                if (it != players.end()) {
-                    RemotePlayer& rp = it->second;
+                RemotePlayer* zapper = players.At(zapperIndex);
+                if (zapper) {
+                    RemotePlayer& rp = *zapper;
                     
                     // Make sure the player has a force field
                     if (!rp.player.HasForceField()) {
@@ -405,7 +414,11 @@ void HostNetwork::ProcessForceFieldZapMessage(Game& game, HostNetwork& host, con
         }
         
         // Broadcast this zap to all clients (even if we don't find the enemy)
-        std::string zapMsg = PlayerMessageHandler::FormatForceFieldZapMessage(normalizedZapperID, enemyId, damage);
+        std::string zapMsg = PlayerMessageHandler::FormatForceFieldZapMessage(zapperIndex, enemyId, damage);
         game.GetNetworkManager().BroadcastMessage(zapMsg);
     }
-}
\ No newline at end of file
+}
+
+int HostNetwork::SenderSlot(CSteamID sender) const {
+    return playerManager->GetPlayers().IndexOf(static_cast<uint64_t>(sender.ConvertToUint64()));
+}
@@ -5,10 +5,12 @@
 #include <steam/steam_api.h>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "messages/MessageHandler.h"
 #include "../entities/player/Player.h"
 #include "../utils/SteamHelpers.h"
 #include "../entities/player/PlayerManager.h"
+#include "PlayerSnapshotWriter.h"
 
 class Game;
 class EnemyManager;
@@ -23,7 +25,7 @@ public:
     void ProcessMessage(const std::string& msg, CSteamID sender);
     std::unordered_map<std::string, RemotePlayer>& GetRemotePlayers() { return remotePlayers; }
     void BroadcastFullPlayerList();
-    void BroadcastPlayersList();
+    void BroadcastPlayerSnapshot(float elapsed);
     void ProcessChatMessage(const std::string& message, CSteamID sender);
     void Update();
 
@@ -41,12 +43,17 @@ public:
     void ProcessForceFieldZapMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender);
     void ProcessForceFieldUpdateMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender);
     void ProcessKillMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender);
+    void ProcessPlayerInputMessage(Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender);
 private:
+    // Messages from a client are about that client, so its slot comes from the transport
+    int SenderSlot(CSteamID sender) const;
+    
     Game* game;
     PlayerManager* playerManager;
     std::unordered_map<std::string, RemotePlayer> remotePlayers;
     std::chrono::steady_clock::time_point lastBroadcastTime;
-    static constexpr float BROADCAST_INTERVAL = 0.1f;
+    
+    PlayerSnapshotWriter snapshotWriter;
 };
 
 #endif // HOST_H
\ No newline at end of file
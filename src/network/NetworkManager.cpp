@@ -12,16 +12,23 @@
 #include "messages/StateMessageHandler.h"
 #include "messages/SystemMessageHandler.h"
 #include "../utils/config/Config.h"
+#include "SessionContext.h"
+#include "SnapshotBuffer.h"
+#include "../core/Profiler.h"
+#include "../core/TraceRecorder.h"
+#include "../core/FlightRecorder.h"
 
 NetworkManager::NetworkManager(Game* gameInstance)
     : game(gameInstance),
+      m_currentLobbyID(k_steamIDNil),
       m_cbLobbyCreated(this, &NetworkManager::OnLobbyCreated),
       m_cbGameLobbyJoinRequested(this, &NetworkManager::OnGameLobbyJoinRequested),
       m_cbLobbyEnter(this, &NetworkManager::OnLobbyEnter),
       m_cbP2PSessionRequest(this, &NetworkManager::OnP2PSessionRequest),
       m_cbP2PSessionConnectFail(this, &NetworkManager::OnP2PSessionConnectFail),
       m_cbLobbyMatchList(this, &NetworkManager::OnLobbyMatchList),
-      m_currentLobbyID(k_steamIDNil) {
+      m_cbLobbyChatUpdate(this, &NetworkManager::OnLobbyChatUpdate),
+      m_cbLobbyDataUpdate(this, &NetworkManager::OnLobbyDataUpdate) {
     if (!SteamAPI_Init()) {
         std::cerr << "[ERROR] Steam API initialization failed!" << std::endl;
         return;
@@ -40,7 +47,9 @@ NetworkManager::~NetworkManager() {
 }
 
 void NetworkManager::ReceiveMessages() {
+    PROFILE_SCOPE("NetworkManager::ReceiveMessages");
     if (!m_networking || !SteamUser()) return;
+    FlushDelayedMessages();
 
     uint32 msgSize;
     while (m_networking->IsP2PPacketAvailable(&msgSize)) {
@@ -53,8 +62,9 @@ void NetworkManager::ReceiveMessages() {
         if (m_networking->ReadP2PPacket(buffer, sizeof(buffer), &msgSize, &sender)) {
             buffer[msgSize] = '\0';
             std::string msg(buffer);
-            CSteamID myID = SteamUser()->GetSteamID();
-            if (sender == myID && msg.find("T|") != 0) { // Allow chat messages from self
+            TraceRecorder::Get().Message(false, msg, msgSize, sender.ConvertToUint64());
+            FlightRecorder::Get().CountMessage(false, msgSize);
+            if (sender == SessionContext::Get().GetLocalID() && msg.find("T|") != 0) { // Allow chat messages from self
                 std::cout << "[NETWORK] Ignoring unexpected self-message: " << msg << "\n";
                 continue;
             }
@@ -109,17 +119,41 @@ bool NetworkManager::SendMessage(CSteamID target, const std::string& msg) {
     return SendMessageDirect(target, msg);
 }
 bool NetworkManager::SendMessageDirect(CSteamID target, const std::string& msg) {
+    if (NET_SIM_LATENCY_MS <= 0 && NET_SIM_LOSS_PERCENT <= 0) {
+        return SendP2P(target, msg);
+    }
+    
+    // Test conditions: drop some state stream messages, hold everything else back
+    bool lossTolerant = msg.compare(0, 3, "IN|") == 0 || msg.compare(0, 3, "PS|") == 0;
+    if (lossTolerant && std::uniform_int_distribution<int>(0, 99)(m_simRng) < NET_SIM_LOSS_PERCENT) {
+        return true;
+    }
+    auto releaseTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(NET_SIM_LATENCY_MS);
+    m_delayedMessages.push_back({releaseTime, target, msg});
+    return true;
+}
+
+void NetworkManager::FlushDelayedMessages() {
+    auto now = std::chrono::steady_clock::now();
+    while (!m_delayedMessages.empty() && m_delayedMessages.front().releaseTime <= now) {
+        SendP2P(m_delayedMessages.front().target, m_delayedMessages.front().msg);
+        m_delayedMessages.pop_front();
+    }
+}
+
+bool NetworkManager::SendP2P(CSteamID target, const std::string& msg) {
     if (!m_networking || !SteamUser()) return false;
     uint32 msgSize = static_cast<uint32>(msg.size() + 1);
     bool success = m_networking->SendP2PPacket(target, msg.c_str(), msgSize, k_EP2PSendReliable);
+    TraceRecorder::Get().Message(true, msg, msgSize, target.ConvertToUint64());
+    FlightRecorder::Get().CountMessage(true, msgSize);
     if (!success) {
         std::cout << "[NETWORK] Failed to send message to " << target.ConvertToUint64() << "\n";
     }
     return success;
 }
 void NetworkManager::SendConnectionMessageOnJoin(CSteamID hostID) {
-    CSteamID myID = SteamUser()->GetSteamID();
-    std::string steamIDStr = std::to_string(myID.ConvertToUint64());
+    std::string steamIDStr = SessionContext::Get().GetLocalIDString();
     std::string steamName = SteamFriends()->GetPersonaName();
     sf::Color playerColor = PLAYER_DEFAULT_COLOR;
     std::string connectMsg = PlayerMessageHandler::FormatConnectionMessage(steamIDStr, steamName, playerColor, false, false);
@@ -137,7 +171,6 @@ void NetworkManager::SendConnectionMessageOnJoin(CSteamID hostID) {
 
 bool NetworkManager::BroadcastMessage(const std::string& msg) {
     bool success = true;
-    CSteamID myID = SteamUser()->GetSteamID();
     if (m_currentLobbyID == k_steamIDNil) {
         std::cout << "[NETWORK] No lobby to broadcast to\n";
         return false;
@@ -147,38 +180,29 @@ bool NetworkManager::BroadcastMessage(const std::string& msg) {
         std::string messageType = msg.substr(0, msg.find('|'));
         std::vector<std::string> chunks = SystemMessageHandler::ChunkMessage(msg.substr(msg.find('|') + 1), messageType);
                 
-        int numMembers = SteamMatchmaking()->GetNumLobbyMembers(m_currentLobbyID);
-        for (int i = 0; i < numMembers; ++i) {
-            CSteamID memberID = SteamMatchmaking()->GetLobbyMemberByIndex(m_currentLobbyID, i);
-            if (memberID != myID) {
-                for (const auto& chunk : chunks) {
-                    if (!SendMessage(memberID, chunk)) {
-                        std::cout << "[NETWORK] Failed to send chunk to " 
-                                  << memberID.ConvertToUint64() << "\n";
-                        success = false;
-                    }
+        for (const CSteamID& memberID : SessionContext::Get().GetPeers()) {
+            for (const auto& chunk : chunks) {
+                if (!SendMessage(memberID, chunk)) {
+                    std::cout << "[NETWORK] Failed to send chunk to " 
+                              << memberID.ConvertToUint64() << "\n";
+                    success = false;
                 }
             }
         }
         return success;
     }
     
-    int numMembers = SteamMatchmaking()->GetNumLobbyMembers(m_currentLobbyID);
-    for (int i = 0; i < numMembers; ++i) {
-        CSteamID memberID = SteamMatchmaking()->GetLobbyMemberByIndex(m_currentLobbyID, i);
-        if (memberID != myID) {
-            if (!SendMessage(memberID, msg)) {
-                std::cout << "[NETWORK] Failed to broadcast to " << memberID.ConvertToUint64() << "\n";
-                success = false;
-            }
+    for (const CSteamID& memberID : SessionContext::Get().GetPeers()) {
+        if (!SendMessage(memberID, msg)) {
+            std::cout << "[NETWORK] Failed to broadcast to " << memberID.ConvertToUint64() << "\n";
+            success = false;
         }
     }
     return success;
 }
 
 void NetworkManager::SendChatMessage(CSteamID target, const std::string& message) {
-    CSteamID myID = SteamUser()->GetSteamID();
-    std::string steamIDStr = std::to_string(myID.ConvertToUint64());
+    std::string steamIDStr = SessionContext::Get().GetLocalIDString();
     std::string formattedMsg = SystemMessageHandler::FormatChatMessage(steamIDStr, message);
     SendMessage(target, formattedMsg);
 }
@@ -222,10 +246,11 @@ void NetworkManager::OnLobbyCreated(LobbyCreated_t* pParam) {
     
     SteamMatchmaking()->SetLobbyData(m_currentLobbyID, "name", game->GetLobbyNameInput().c_str());
     SteamMatchmaking()->SetLobbyData(m_currentLobbyID, "game_id", GAME_ID);
-    CSteamID myID = SteamUser()->GetSteamID();
+    CSteamID myID = SessionContext::Get().GetLocalID();
     std::string hostStr = std::to_string(myID.ConvertToUint64());
     SteamMatchmaking()->SetLobbyData(m_currentLobbyID, "host_steam_id", hostStr.c_str());
     SteamMatchmaking()->SetLobbyJoinable(m_currentLobbyID, true);
+    RefreshSession();
     
     game->SetInLobby(true);
     
@@ -250,6 +275,13 @@ void NetworkManager::ResetLobbyState() {
     std::cout << "[NETWORK] Connected clients before reset: " << m_connectedClients.size() << std::endl;
     
     m_currentLobbyID = k_steamIDNil;
+    SessionContext::Get().Clear();
+    SnapshotClock::Get().Reset();   // The next host's clock has nothing to do with this one
+    // A client may have adopted the host's tick rate; go back to our own
+    int ownTickRate = game->GetSettingsManager()->GetSettings().tickRate;
+    if (game->GetTickRate() != ownTickRate) {
+        game->SetTickRate(ownTickRate);
+    }
     m_connectedClients.clear();
     isConnectedToHost = false;
     m_pendingConnectionMessage = false;
@@ -277,10 +309,14 @@ void NetworkManager::OnLobbyEnter(LobbyEnter_t* pParam) {
     m_currentLobbyID = CSteamID(pParam->m_ulSteamIDLobby);
     std::cout << "Joined lobby " << m_currentLobbyID.ConvertToUint64() << std::endl;
     
+    // Sync to this lobby's host from its first snapshot
+    SnapshotClock::Get().Reset();
+    
+    RefreshSession();
     game->SetInLobby(true);
     
-    CSteamID myID = SteamUser()->GetSteamID();
-    CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(m_currentLobbyID);
+    CSteamID myID = SessionContext::Get().GetLocalID();
+    CSteamID hostID = SessionContext::Get().GetHostID();
     
     if (game->GetCurrentState() != GameState::Lobby) {
         std::cout << "[NETWORK] Transitioning to Lobby state" << std::endl;
@@ -320,7 +356,7 @@ void NetworkManager::OnP2PSessionRequest(P2PSessionRequest_t* pParam) {
     if (m_networking && m_networking->AcceptP2PSessionWithUser(pParam->m_steamIDRemote)) {
         m_connectedClients[pParam->m_steamIDRemote] = true;
         std::cout << "[NETWORK] Accepted P2P session with " << pParam->m_steamIDRemote.ConvertToUint64() << "\n";
-        if (SteamUser()->GetSteamID() == SteamMatchmaking()->GetLobbyOwner(m_currentLobbyID)) {
+        if (SessionContext::Get().IsHost()) {
             std::string lobbyName = SteamMatchmaking()->GetLobbyData(m_currentLobbyID, "name");
             SendChatMessage(pParam->m_steamIDRemote, "Welcome to " + lobbyName);
         }
@@ -329,6 +365,31 @@ void NetworkManager::OnP2PSessionRequest(P2PSessionRequest_t* pParam) {
     }
 }
 
+void NetworkManager::RefreshSession() {
+    if (m_currentLobbyID == k_steamIDNil || !SteamMatchmaking()) {
+        SessionContext::Get().Clear();
+        return;
+    }
+
+    std::vector<CSteamID> members;
+    int memberCount = SteamMatchmaking()->GetNumLobbyMembers(m_currentLobbyID);
+    for (int i = 0; i < memberCount; i++) {
+        members.push_back(SteamMatchmaking()->GetLobbyMemberByIndex(m_currentLobbyID, i));
+    }
+    SessionContext::Get().SetLobby(m_currentLobbyID, SteamMatchmaking()->GetLobbyOwner(m_currentLobbyID), members);
+}
+
+void NetworkManager::OnLobbyChatUpdate(LobbyChatUpdate_t* pParam) {
+    // A member joined, left or dropped; owner changes come through here too when the host leaves
+    if (CSteamID(pParam->m_ulSteamIDLobby) != m_currentLobbyID) return;
+    RefreshSession();
+}
+
+void NetworkManager::OnLobbyDataUpdate(LobbyDataUpdate_t* pParam) {
+    if (CSteamID(pParam->m_ulSteamIDLobby) != m_currentLobbyID) return;
+    RefreshSession();
+}
+
 void NetworkManager::OnP2PSessionConnectFail(P2PSessionConnectFail_t* pParam) {
     std::cerr << "[ERROR] P2P session failed with " << pParam->m_steamIDRemote.ConvertToUint64() << ": " << pParam->m_eP2PSessionError << std::endl;
     m_connectedClients.erase(pParam->m_steamIDRemote);
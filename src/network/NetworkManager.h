@@ -6,6 +6,9 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <deque>
+#include <random>
+#include <chrono>
 #include "../utils/SteamHelpers.h"
 #include "../network/messages/MessageHandler.h"
 //#include "../network/messages/MessageDefinitions.h"
@@ -53,6 +56,18 @@ private:
     std::function<void(const std::string&, CSteamID)> messageHandler;
     CSteamID m_currentLobbyID;
     bool SendMessageDirect(CSteamID target, const std::string& msg);
+    bool SendP2P(CSteamID target, const std::string& msg);
+    void RefreshSession();   // Copies lobby owner and members into SessionContext
+    
+    // Simulated latency and loss (NET_SIM_LATENCY_MS / NET_SIM_LOSS_PERCENT)
+    struct DelayedMessage {
+        std::chrono::steady_clock::time_point releaseTime;
+        CSteamID target;
+        std::string msg;
+    };
+    void FlushDelayedMessages();
+    std::deque<DelayedMessage> m_delayedMessages;
+    std::mt19937 m_simRng{12345};
     // STEAM_CALLBACKs
     STEAM_CALLBACK(NetworkManager, OnLobbyCreated, LobbyCreated_t, m_cbLobbyCreated);
     STEAM_CALLBACK(NetworkManager, OnGameLobbyJoinRequested, GameLobbyJoinRequested_t, m_cbGameLobbyJoinRequested);
@@ -60,6 +75,9 @@ private:
     STEAM_CALLBACK(NetworkManager, OnP2PSessionRequest, P2PSessionRequest_t, m_cbP2PSessionRequest);
     STEAM_CALLBACK(NetworkManager, OnP2PSessionConnectFail, P2PSessionConnectFail_t, m_cbP2PSessionConnectFail);
     STEAM_CALLBACK(NetworkManager, OnLobbyMatchList, LobbyMatchList_t, m_cbLobbyMatchList);
+    // Keep SessionContext's host and peers current
+    STEAM_CALLBACK(NetworkManager, OnLobbyChatUpdate, LobbyChatUpdate_t, m_cbLobbyChatUpdate);
+    STEAM_CALLBACK(NetworkManager, OnLobbyDataUpdate, LobbyDataUpdate_t, m_cbLobbyDataUpdate);
 };
 
 #endif // NETWORKMANAGER_H
\ No newline at end of file
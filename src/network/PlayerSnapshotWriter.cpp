@@ -0,0 +1,40 @@
+#include "PlayerSnapshotWriter.h"
+#include "messages/PlayerMessageHandler.h"
+#include "../entities/player/PlayerManager.h"
+
+std::string PlayerSnapshotWriter::Write(PlayerManager& playerManager, float elapsed) {
+    auto& players = playerManager.GetPlayers();
+    int capacity = PlayerRegistry::Capacity();
+    if (static_cast<int>(valid.size()) != capacity) {
+        positions.assign(capacity, sf::Vector2f(0.f, 0.f));
+        valid.assign(capacity, false);
+    }
+    
+    entries.clear();
+    for (int slot = 0; slot < capacity; ++slot) {
+        const RemotePlayer* rp = players.At(slot);
+        if (!rp) {
+            valid[slot] = false;
+            continue;
+        }
+        
+        PlayerSnapshotEntry entry;
+        entry.slot = slot;
+        // Remote players are drawn interpolated; the snapshot carries the authoritative result
+        bool local = slot == playerManager.GetLocalPlayerIndex();
+        entry.position = local ? rp->player.GetPosition() : rp->targetPosition;
+        if (valid[slot] && elapsed > 0.f) {
+            entry.velocity = (entry.position - positions[slot]) / elapsed;
+        }
+        entry.health = rp->player.GetHealth();
+        entry.alive = !rp->player.IsDead();
+        entry.ack = rp->lastInputSequence;
+        entries.push_back(entry);
+        
+        positions[slot] = entry.position;
+        valid[slot] = true;
+    }
+    
+    if (entries.empty()) return std::string();
+    return PlayerMessageHandler::FormatPlayerSnapshotMessage(entries);
+}
@@ -0,0 +1,29 @@
+#ifndef PLAYER_SNAPSHOT_WRITER_H
+#define PLAYER_SNAPSHOT_WRITER_H
+
+#include <SFML/System/Vector2.hpp>
+#include <string>
+#include <vector>
+#include "messages/MessageHandler.h"
+
+class PlayerManager;
+
+// Builds the host's player snapshot (PS): every player's authoritative position, velocity,
+// health and last applied input in one message. HostNetwork broadcasts it on a timer, and
+// the headless runner sends the same message so its byte counts include it.
+class PlayerSnapshotWriter {
+public:
+    static constexpr float INTERVAL = 0.05f;   // Seconds between snapshots
+
+    // elapsed is the time since the previous snapshot; it turns each player's change in
+    // position into a velocity. Returns an empty string when there is nobody to send.
+    std::string Write(PlayerManager& playerManager, float elapsed);
+
+private:
+    // By slot: positions from the previous snapshot give each player's velocity
+    std::vector<PlayerSnapshotEntry> entries;
+    std::vector<sf::Vector2f> positions;
+    std::vector<bool> valid;
+};
+
+#endif // PLAYER_SNAPSHOT_WRITER_H
@@ -0,0 +1,61 @@
+#include "SessionContext.h"
+#include <iostream>
+
+SessionContext& SessionContext::Get() {
+    static SessionContext instance;
+    return instance;
+}
+
+void SessionContext::SetLocalID(CSteamID id) {
+    localID = id;
+    localIDString = std::to_string(id.ConvertToUint64());
+    UpdateRole();
+}
+
+void SessionContext::SetLobby(CSteamID lobby, CSteamID owner, const std::vector<CSteamID>& members) {
+    if (lobby == k_steamIDNil) {
+        Clear();
+        return;
+    }
+
+    lobbyID = lobby;
+    hostID = owner;
+
+    peers.clear();
+    for (const CSteamID& member : members) {
+        if (member != localID) {
+            peers.push_back(member);
+        }
+    }
+
+    SessionRole previousRole = role;
+    UpdateRole();
+    if (role != previousRole) {
+        std::cout << "[SESSION] Now " << (IsHost() ? "host" : "client") << " of lobby "
+                  << lobby.ConvertToUint64() << " with " << peers.size() << " peers\n";
+    }
+}
+
+void SessionContext::StartLocal(CSteamID id) {
+    SetLocalID(id);
+    lobbyID = k_steamIDNil;
+    hostID = id;
+    peers.clear();
+    role = SessionRole::Host;
+}
+
+void SessionContext::Clear() {
+    lobbyID = k_steamIDNil;
+    hostID = k_steamIDNil;
+    peers.clear();
+    role = SessionRole::Offline;
+}
+
+void SessionContext::UpdateRole() {
+    if (lobbyID == k_steamIDNil) {
+        // A local session keeps its role; a cleared one stays offline
+        if (role != SessionRole::Host || hostID != localID) role = SessionRole::Offline;
+        return;
+    }
+    role = (localID == hostID) ? SessionRole::Host : SessionRole::Client;
+}
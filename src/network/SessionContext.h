@@ -0,0 +1,60 @@
+#ifndef SESSION_CONTEXT_H
+#define SESSION_CONTEXT_H
+
+#include <steam/steam_api.h>   // CSteamID only; this class never calls into Steam
+#include <string>
+#include <vector>
+
+enum class SessionRole {
+    Offline,    // Not in a lobby
+    Host,
+    Client
+};
+
+// Who we are in the current session: local id, host id, role and the other members.
+//
+// Only NetworkManager writes it, from the lobby callbacks (created, entered, member
+// joined or left, owner changed), and it is cleared when the lobby is left. Gameplay
+// code reads the cached role instead of asking Steam on every event, and a headless
+// run with no Steam client can set itself up as host with StartLocal().
+class SessionContext {
+public:
+    static SessionContext& Get();
+
+    void SetLocalID(CSteamID id);
+
+    // Owner and full member list of the lobby we are in, as read from Steam
+    void SetLobby(CSteamID lobby, CSteamID owner, const std::vector<CSteamID>& members);
+
+    // A session with only this process in it, as host
+    void StartLocal(CSteamID id);
+
+    // Back to Offline; the local id is kept
+    void Clear();
+
+    SessionRole GetRole() const { return role; }
+    bool IsHost() const { return role == SessionRole::Host; }
+    bool IsClient() const { return role == SessionRole::Client; }
+
+    CSteamID GetLocalID() const { return localID; }
+    const std::string& GetLocalIDString() const { return localIDString; }
+    CSteamID GetHostID() const { return hostID; }
+    CSteamID GetLobbyID() const { return lobbyID; }
+    const std::vector<CSteamID>& GetPeers() const { return peers; }   // Members other than us
+
+private:
+    SessionContext() = default;
+    SessionContext(const SessionContext&) = delete;
+    SessionContext& operator=(const SessionContext&) = delete;
+
+    void UpdateRole();
+
+    SessionRole role = SessionRole::Offline;
+    CSteamID localID = k_steamIDNil;
+    std::string localIDString = "0";
+    CSteamID hostID = k_steamIDNil;
+    CSteamID lobbyID = k_steamIDNil;
+    std::vector<CSteamID> peers;
+};
+
+#endif // SESSION_CONTEXT_H
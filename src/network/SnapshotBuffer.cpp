@@ -0,0 +1,93 @@
+#include "SnapshotBuffer.h"
+#include <algorithm>
+
+namespace {
+    // How quickly the clock offset drifts back up after a fast packet
+    const double OFFSET_RELAX_RATE = 0.02;
+}
+
+SnapshotClock& SnapshotClock::Get() {
+    static SnapshotClock instance;
+    return instance;
+}
+
+uint64_t SnapshotClock::HostNow() {
+    auto since = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(since).count());
+}
+
+double SnapshotClock::LocalNow() {
+    auto since = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double>(since).count();
+}
+
+void SnapshotClock::Observe(uint64_t hostTimeMs) {
+    double sample = LocalNow() - static_cast<double>(hostTimeMs) / 1000.0;
+    if (!synced || sample < offset) {
+        offset = sample;
+        synced = true;
+    } else {
+        offset += (sample - offset) * OFFSET_RELAX_RATE;
+    }
+}
+
+double SnapshotClock::HostTime() const {
+    return LocalNow() - offset;
+}
+
+double SnapshotClock::RenderTime() const {
+    return HostTime() - SNAPSHOT_INTERP_DELAY;
+}
+
+void SnapshotBuffer::Push(double time, const sf::Vector2f& position, const sf::Vector2f& velocity) {
+    // Snapshots arrive in order over a reliable channel; anything older is a duplicate
+    if (count > 0 && time <= At(count - 1).time) return;
+    
+    if (count == SNAPSHOT_BUFFER_SIZE) {
+        head = (head + 1) % SNAPSHOT_BUFFER_SIZE;
+        count--;
+    }
+    Snapshot& slot = samples[(head + count) % SNAPSHOT_BUFFER_SIZE];
+    slot.time = time;
+    slot.position = position;
+    slot.velocity = velocity;
+    count++;
+}
+
+void SnapshotBuffer::Push(double time, const sf::Vector2f& position) {
+    sf::Vector2f velocity(0.f, 0.f);
+    if (count > 0 && time > At(count - 1).time) {
+        const Snapshot& last = At(count - 1);
+        velocity = (position - last.position) / static_cast<float>(time - last.time);
+    }
+    Push(time, position, velocity);
+}
+
+SnapshotBuffer::Result SnapshotBuffer::Sample(double renderTime, sf::Vector2f& outPosition) const {
+    if (count == 0) return Result::Empty;
+    
+    // Before the oldest sample: nothing earlier to blend from
+    const Snapshot& oldest = At(0);
+    if (renderTime <= oldest.time) {
+        outPosition = oldest.position;
+        return Result::Held;
+    }
+    
+    // Find the pair bracketing the render time
+    for (size_t i = 1; i < count; ++i) {
+        const Snapshot& to = At(i);
+        if (renderTime <= to.time) {
+            const Snapshot& from = At(i - 1);
+            float t = static_cast<float>((renderTime - from.time) / (to.time - from.time));
+            outPosition = from.position + (to.position - from.position) * t;
+            return Result::Interpolated;
+        }
+    }
+    
+    // Buffer ran dry: continue along the newest velocity, up to the cap
+    const Snapshot& newest = At(count - 1);
+    float ahead = static_cast<float>(renderTime - newest.time);
+    float extrapolate = std::min(ahead, SNAPSHOT_MAX_EXTRAPOLATION);
+    outPosition = newest.position + newest.velocity * extrapolate;
+    return ahead <= SNAPSHOT_MAX_EXTRAPOLATION ? Result::Extrapolated : Result::Held;
+}
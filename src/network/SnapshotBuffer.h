@@ -0,0 +1,77 @@
+#ifndef SNAPSHOT_BUFFER_H
+#define SNAPSHOT_BUFFER_H
+
+#include <array>
+#include <cstdint>
+#include <chrono>
+#include <SFML/System/Vector2.hpp>
+#include "../utils/config/Config.h"
+
+// Maps host timestamps onto the local clock so remote entities can be drawn a fixed
+// delay behind the host, independent of when each packet happened to arrive.
+//
+// The offset follows the fastest delivery seen (the lowest local - host difference)
+// and relaxes slowly upwards, so one late packet doesn't drag the timeline back.
+class SnapshotClock {
+public:
+    static SnapshotClock& Get();
+    
+    // Host side: the timestamp stamped on outgoing snapshots, in milliseconds
+    static uint64_t HostNow();
+    
+    // Client side: feed the timestamp of every received snapshot
+    void Observe(uint64_t hostTimeMs);
+    void Reset() { synced = false; }
+    bool IsSynced() const { return synced; }
+    
+    // Best estimate of the host's clock right now, in seconds
+    double HostTime() const;
+    
+    // Host time, in seconds, that remote entities should be drawn at right now
+    double RenderTime() const;
+    
+private:
+    SnapshotClock() = default;
+    SnapshotClock(const SnapshotClock&) = delete;
+    SnapshotClock& operator=(const SnapshotClock&) = delete;
+    
+    static double LocalNow();
+    
+    double offset = 0.0;     // Local seconds minus host seconds
+    bool synced = false;
+};
+
+// Timestamped positions for one remote entity.
+//
+// Sample() interpolates between the two snapshots bracketing the render time. When the
+// render time runs past the newest snapshot it extrapolates along that snapshot's
+// velocity for at most SNAPSHOT_MAX_EXTRAPOLATION seconds, then holds.
+class SnapshotBuffer {
+public:
+    enum class Result {
+        Empty,
+        Interpolated,
+        Extrapolated,
+        Held
+    };
+    
+    void Push(double time, const sf::Vector2f& position, const sf::Vector2f& velocity);
+    void Push(double time, const sf::Vector2f& position);   // Velocity derived from the previous sample
+    Result Sample(double renderTime, sf::Vector2f& outPosition) const;
+    void Clear() { count = 0; }
+    bool Empty() const { return count == 0; }
+    
+private:
+    struct Snapshot {
+        double time = 0.0;
+        sf::Vector2f position;
+        sf::Vector2f velocity;
+    };
+    const Snapshot& At(size_t i) const { return samples[(head + i) % SNAPSHOT_BUFFER_SIZE]; }
+    
+    std::array<Snapshot, SNAPSHOT_BUFFER_SIZE> samples;
+    size_t head = 0;     // Oldest sample
+    size_t count = 0;
+};
+
+#endif // SNAPSHOT_BUFFER_H
@@ -1,187 +1,19 @@
 #include "EnemyMessageHandler.h"
 #include "MessageHandler.h"
-#include "../Client.h"
-#include "../Host.h"
-#include "../../core/Game.h"
-#include "../../states/PlayingState.h"
+#include "../SnapshotBuffer.h"
+#include "../../core/Logger.h"
 #include <sstream>
 #include <iostream>
 
-void EnemyMessageHandler::Initialize() {
-    // Register enemy message types
-    MessageHandler::RegisterMessageType("EA", 
-        ParseEnemyAddMessage,
-        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-            PlayingState* state = GetPlayingState(&game);
-            if (state && state->GetEnemyManager()) {
-                state->GetEnemyManager()->RemoteAddEnemy(parsed.enemyId, parsed.enemyType, parsed.position, parsed.health);
-            }
-        },
-        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-            // Host should be the one creating enemies, not receiving
-            std::cout << "[HOST] Received enemy add message from client, ignoring\n";
-        });
-
-    MessageHandler::RegisterMessageType("ER", 
-        ParseEnemyRemoveMessage,
-        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-            PlayingState* state = GetPlayingState(&game);
-            if (state && state->GetEnemyManager()) {
-                state->GetEnemyManager()->RemoteRemoveEnemy(parsed.enemyId);
-            }
-        },
-        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-            // Client notifying host of enemy removal
-            PlayingState* state = GetPlayingState(&game);
-            if (state && state->GetEnemyManager()) {
-                state->GetEnemyManager()->RemoveEnemy(parsed.enemyId);
-            }
-        });
-
-    MessageHandler::RegisterMessageType("ED", 
-        ParseEnemyDamageMessage,
-        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-            PlayingState* state = GetPlayingState(&game);
-            if (state && state->GetEnemyManager()) {
-                EnemyManager* enemyManager = state->GetEnemyManager();
-                if (parsed.enemyId >= 0) {
-                    auto enemy = enemyManager->FindEnemy(parsed.enemyId);
-                    if (enemy) {
-                        enemy->SetHealth(parsed.health);
-                        if (parsed.health <= 0) {
-                            enemyManager->RemoteRemoveEnemy(parsed.enemyId);
-                        }
-                    }
-                }
-            }
-        },
-        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-            // Client informing host of damage to enemy
-            PlayingState* state = GetPlayingState(&game);
-            if (state && state->GetEnemyManager()) {
-                state->GetEnemyManager()->InflictDamage(parsed.enemyId, parsed.damage);
-            }
-        });
-        MessageHandler::RegisterMessageType("ES",
-            ParseEnemyStateMessage,
-            [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                PlayingState* state = GetPlayingState(&game);
-                if (state && state->GetEnemyManager()) {
-                    auto enemyManager = state->GetEnemyManager();
-                    for (size_t i = 0; i < parsed.enemyIds.size(); ++i) {
-                        int id = parsed.enemyIds[i];
-                        Enemy* enemy = enemyManager->FindEnemy(id);
-                        if (!enemy) {
-                            EnemyType type = static_cast<EnemyType>(parsed.enemyTypes[i]);
-                            enemyManager->RemoteAddEnemy(id, type, parsed.enemyPositions[i], parsed.enemyHealths[i]);
-                        } else {
-                            enemy->SetPosition(parsed.enemyPositions[i]);
-                            enemy->SetHealth(parsed.enemyHealths[i]);
-                        }
-                    }
-                    // No need to remove enemies here; full state ("ECS") will handle that
-                }
-            },
-            [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                // Host ignores ES from clients
-            });
-        MessageHandler::RegisterMessageType("EP", 
-            ParseEnemyPositionUpdateMessage,
-            [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                PlayingState* state = GetPlayingState(&game);
-                if (state && state->GetEnemyManager()) {
-                    // Update enemy positions from network message
-                    for (size_t i = 0; i < parsed.enemyIds.size(); ++i) {
-                        int id = parsed.enemyIds[i];
-                        Enemy* enemy = state->GetEnemyManager()->FindEnemy(id);
-                        if (enemy) {
-                            // Update existing enemy position
-                            enemy->SetPosition(parsed.enemyPositions[i]);
-                            
-                            // If velocity is provided, update it too
-                            if (i < parsed.enemyVelocities.size()) {
-                                enemy->SetVelocity(parsed.enemyVelocities[i]);
-                            }
-                        }
-                    }
-                }
-            },
-            [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                // Host doesn't usually receive EP messages, but could process them if needed
-                std::cout << "[HOST] Received enemy position update from client, ignoring\n";
-            });
-            MessageHandler::RegisterMessageType("ESR", 
-                ParseEnemyStateRequestMessage,
-                [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                    // Client requesting enemy state (nothing to do here)
-                },
-                [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                    // Host handling state request - should send current enemy states
-                    PlayingState* state = GetPlayingState(&game);
-                    if (state && state->GetEnemyManager()) {
-                        // Send a complete enemy state directly to the requesting client
-                        EnemyManager* enemyManager = state->GetEnemyManager();
-                        
-                        // Create vectors for the state message
-                        std::vector<int> enemyIds;
-                        std::vector<EnemyType> types;
-                        std::vector<sf::Vector2f> positions;
-                        std::vector<float> healths;
-                        
-                        // Get all current enemies
-                        for (const auto& pair : enemyManager->GetEnemies()) {
-                            enemyIds.push_back(pair.first);
-                            types.push_back(pair.second->GetType());
-                            positions.push_back(pair.second->GetPosition());
-                            healths.push_back(pair.second->GetHealth());
-                        }
-                        
-                        // Create and send the message
-                        std::string stateMsg = EnemyMessageHandler::FormatCompleteEnemyStateMessage(
-                            enemyIds, types, positions, healths);
-                            
-                        // Send directly to the requesting client
-                        game.GetNetworkManager().SendMessage(sender, stateMsg);
-                        
-                        std::cout << "[HOST] Sent requested enemy state to client with " 
-                                  << enemyIds.size() << " enemies\n";
-                    }
-                });
-
-    MessageHandler::RegisterMessageType("EC", 
-        ParseEnemyClearMessage,
-        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-            PlayingState* state = GetPlayingState(&game);
-            if (state && state->GetEnemyManager()) {
-                state->GetEnemyManager()->ClearEnemies();
-            }
-        },
-        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-            // Host initiates clear, not receives it
-            std::cout << "[HOST] Received enemy clear from client, ignoring\n";
-        });
-        MessageHandler::RegisterMessageType("ECS",
-            EnemyMessageHandler::ParseCompleteEnemyStateMessage,
-            [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                PlayingState* state = GetPlayingState(&game);
-                if (state && state->GetEnemyManager()) {
-                    auto enemyManager = state->GetEnemyManager();
-                    for (size_t i = 0; i < parsed.enemyIds.size(); ++i) {
-                        int id = parsed.enemyIds[i];
-                        Enemy* enemy = enemyManager->FindEnemy(id);
-                        if (!enemy) {
-                            enemyManager->RemoteAddEnemy(id, static_cast<EnemyType>(parsed.enemyTypes[i]), parsed.enemyPositions[i], parsed.enemyHealths[i]);
-                        } else {
-                            enemy->SetPosition(parsed.enemyPositions[i]);
-                            enemy->SetHealth(parsed.enemyHealths[i]);
-                        }
-                    }
-                    enemyManager->RemoveEnemiesNotInList(parsed.enemyIds);
-                }
-            },
-            [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                // Host ignores ECS from clients
-            });
+// Reads the host timestamp that leads EP and ECS, returning the index of the first entry
+size_t EnemyMessageHandler::ParseSnapshotTime(const std::vector<std::string>& parts, ParsedMessage& parsed) {
+    if (parts.size() < 2 || parts[1].find(',') != std::string::npos) return 1;
+    try {
+        parsed.snapshotTime = std::stoull(parts[1]);
+    } catch (const std::exception& e) {
+        std::cout << "[EnemyMessageHandler] Bad snapshot timestamp: " << parts[1] << "\n";
+    }
+    return 2;
 }
 
 // Enemy message parsing functions
@@ -234,9 +66,10 @@ ParsedMessage EnemyMessageHandler::ParseEnemyPositionUpdateMessage(const std::ve
     ParsedMessage parsed;
     parsed.type = MessageType::EnemyPositionUpdate;
     
-    // Format: EP|id,x,y,vx,vy|id,x,y,vx,vy|...
+    // Format: EP|hostTimeMs|id,x,y,vx,vy|id,x,y,vx,vy|...
     // Or potentially older format: EP|id,x,y|id,x,y|...
-    for (size_t i = 1; i < parts.size(); ++i) {
+    size_t first = ParseSnapshotTime(parts, parsed);
+    for (size_t i = first; i < parts.size(); ++i) {
         std::string chunk = parts[i];
         std::vector<std::string> subParts = MessageHandler::SplitString(chunk, ',');
         
@@ -261,9 +94,8 @@ ParsedMessage EnemyMessageHandler::ParseEnemyPositionUpdateMessage(const std::ve
                 parsed.enemyPositions.push_back(sf::Vector2f(x, y));
                 parsed.enemyVelocities.push_back(sf::Vector2f(vx, vy));
                 
-                std::cout << "[MessageHandler] Parsed enemy position update: id=" << id 
-                          << ", pos=(" << x << "," << y << ")"
-                          << ", vel=(" << vx << "," << vy << ")" << std::endl;
+                LOG_TRACE("MessageHandler", "Parsed enemy position update: id={}, pos=({},{}), vel=({},{})",
+                          id, x, y, vx, vy);
             } catch (const std::exception& e) {
                 std::cout << "[MessageHandler] Error parsing enemy position data: " 
                           << chunk << " - Error: " << e.what() << std::endl;
@@ -344,7 +176,7 @@ std::string EnemyMessageHandler::FormatEnemyPositionUpdateMessage(
     const std::vector<sf::Vector2f>& velocities) {
     
     std::ostringstream oss;
-    oss << "EP";
+    oss << "EP|" << SnapshotClock::HostNow();
     
     size_t count = std::min(enemyIds.size(), positions.size());
     for (size_t i = 0; i < count; ++i) {
@@ -385,7 +217,7 @@ std::string EnemyMessageHandler::FormatEnemyClearMessage() {
 std::string EnemyMessageHandler::FormatCompleteEnemyStateMessage(const std::vector<int>& enemyIds, const std::vector<EnemyType>& types, 
     const std::vector<sf::Vector2f>& positions, const std::vector<float>& healths) {
 std::ostringstream oss;
-oss << "ECS"; // Note the different prefix for Complete State
+oss << "ECS|" << SnapshotClock::HostNow(); // Note the different prefix for Complete State
 
 size_t count = std::min(enemyIds.size(), std::min(positions.size(), healths.size()));
 for (size_t i = 0; i < count; ++i) {
@@ -396,6 +228,36 @@ oss << "|" << enemyIds[i] << "," << static_cast<int>(types[i]) << ","
 return oss.str();
 }
 
+// Format: EB|hostTimeMs|<Enemy::Serialize()>|<Enemy::Serialize()>|... (five fields per enemy)
+// Replaces out with the header; the caller appends '|' and Enemy::SerializeTo() per enemy,
+// so the host can build the message in one reused string.
+void EnemyMessageHandler::BeginEnemyBehaviorMessage(std::string& out) {
+    out.assign("EB|");
+    out += std::to_string(SnapshotClock::HostNow());
+}
+
+ParsedMessage EnemyMessageHandler::ParseEnemyBehaviorMessage(const std::vector<std::string>& parts) {
+    ParsedMessage parsed;
+    parsed.type = MessageType::EnemyBehavior;
+    
+    const size_t fieldsPerEnemy = 5;   // id|type|x,y|health|behaviour
+    size_t first = ParseSnapshotTime(parts, parsed);
+    for (size_t i = first; i + fieldsPerEnemy <= parts.size(); i += fieldsPerEnemy) {
+        try {
+            int id = std::stoi(parts[i]);
+            std::string enemyState = parts[i];
+            for (size_t f = 1; f < fieldsPerEnemy; ++f) {
+                enemyState += "|" + parts[i + f];
+            }
+            parsed.enemyIds.push_back(id);
+            parsed.enemyStates.push_back(enemyState);
+        } catch (const std::exception& e) {
+            std::cout << "[EnemyMessageHandler] Error parsing EB data: " << parts[i] << " - " << e.what() << "\n";
+        }
+    }
+    return parsed;
+}
+
 std::string EnemyMessageHandler::FormatEnemyStateRequestMessage() {
     return "ESR";
 }
@@ -404,7 +266,8 @@ ParsedMessage EnemyMessageHandler::ParseCompleteEnemyStateMessage(const std::vec
     ParsedMessage parsed;
     parsed.type = MessageType::EnemyState;
 
-    for (size_t i = 1; i < parts.size(); ++i) {
+    size_t first = ParseSnapshotTime(parts, parsed);
+    for (size_t i = first; i < parts.size(); ++i) {
         if (parts[i].empty()) continue;
         std::vector<std::string> fields = MessageHandler::SplitString(parts[i], ',');
         if (fields.size() >= 5) {
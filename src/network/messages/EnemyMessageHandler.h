@@ -23,6 +23,7 @@ public:
     static ParsedMessage ParseEnemyStateMessage(const std::vector<std::string>& parts);
     static ParsedMessage ParseEnemyStateRequestMessage(const std::vector<std::string>& parts);
     static ParsedMessage ParseEnemyClearMessage(const std::vector<std::string>& parts);
+    static ParsedMessage ParseEnemyBehaviorMessage(const std::vector<std::string>& parts);
     
     // Message formatting functions
     static std::string FormatEnemyAddMessage(int enemyId, EnemyType type, const sf::Vector2f& position, float health);
@@ -32,9 +33,11 @@ public:
     static std::string FormatEnemyStateMessage(const std::vector<int>& enemyIds, const std::vector<EnemyType>& types, 
                                             const std::vector<sf::Vector2f>& positions, const std::vector<float>& healths);
     static std::string FormatEnemyClearMessage();
+    static void BeginEnemyBehaviorMessage(std::string& out);
     static std::string FormatCompleteEnemyStateMessage(const std::vector<int>& enemyIds, const std::vector<EnemyType>& types, const std::vector<sf::Vector2f>& positions, const std::vector<float>& healths);
     static std::string EnemyMessageHandler::FormatEnemyStateRequestMessage();
     static ParsedMessage ParseCompleteEnemyStateMessage(const std::vector<std::string>& parts);
+    static size_t ParseSnapshotTime(const std::vector<std::string>& parts, ParsedMessage& parsed);
 };
 
 #endif // ENEMY_MESSAGE_HANDLER_H
\ No newline at end of file
@@ -0,0 +1,529 @@
+#include "MessageHandler.h"
+#include "PlayerMessageHandler.h"
+#include "EnemyMessageHandler.h"
+#include "StateMessageHandler.h"
+#include "SystemMessageHandler.h"
+#include "../Client.h"
+#include "../Host.h"
+#include "../SnapshotBuffer.h"
+#include "../../core/Game.h"
+#include "../../states/PlayingState.h"
+#include "../../states/PlayingStateUI.h"
+#include "../../core/TraceRecorder.h"
+#include <sstream>
+#include <iostream>
+#include <chrono>
+
+// What each message does when it arrives. The handlers act on Game, HostNetwork and
+// ClientNetwork, so they are registered here, away from the parsing and formatting
+// code that the headless simulation links without them.
+
+void MessageHandler::Initialize() {
+    // Clear existing handlers
+    messageParsers.clear();
+    messageDescriptors.clear();
+    
+    // Initialize all message handlers
+    SystemMessageHandler::Initialize();
+    PlayerMessageHandler::Initialize();
+    EnemyMessageHandler::Initialize();
+    StateMessageHandler::Initialize();
+}
+
+void MessageHandler::ProcessUnknownMessage(Game& game, ClientNetwork& /*client*/, const ParsedMessage& parsed) {
+    // Check if it might be a chunked message that was incorrectly parsed
+    if (!parsed.steamID.empty()) {
+        std::cout << "[MessageHandler] Attempting to recover from unknown message, ID: " << parsed.steamID << "\n";
+        
+        // Try to interpret it as an enemy state update if it contains numbers and commas
+        if (parsed.steamID.find_first_of("0123456789,.") != std::string::npos) {
+            std::vector<std::string> parts;
+            parts.push_back("ES"); // Enemy State prefix
+            parts.push_back(parsed.steamID);
+            
+            // Try to parse as enemy state
+            ParsedMessage recoveredMessage = EnemyMessageHandler::ParseEnemyStateMessage(parts);
+            
+            // If we recovered at least one enemy, process it
+            if (!recoveredMessage.enemyIds.empty()) {
+                std::cout << "[MessageHandler] Recovered " << recoveredMessage.enemyIds.size() << " enemy positions\n";
+                PlayingState* state = GetPlayingState(&game);
+                if (state && state->GetEnemyManager()) {
+                    for (size_t i = 0; i < recoveredMessage.enemyIds.size(); ++i) {
+                        int id = recoveredMessage.enemyIds[i];
+                        auto enemyManager = state->GetEnemyManager();
+                        auto enemy = enemyManager->FindEnemy(id);
+                        
+                        if (enemy) {
+                            // Update existing enemy
+                            enemy->SetPosition(recoveredMessage.enemyPositions[i]);
+                        } else {
+                            // Create new enemy
+                            EnemyType type = static_cast<EnemyType>(recoveredMessage.enemyTypes[i]);
+                            enemyManager->RemoteAddEnemy(id, type, recoveredMessage.enemyPositions[i], 
+                                                       recoveredMessage.enemyHealths[i]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void SystemMessageHandler::Initialize() {
+    // Register chunking handlers
+    MessageHandler::RegisterMessageType("CHUNK_START", ParseChunkStartMessage,
+        [](Game& /*game*/, ClientNetwork& /*client*/, const ParsedMessage& /*parsed*/) {
+            // Client just stores the start info
+        },
+        [](Game& /*game*/, HostNetwork& /*host*/, const ParsedMessage& /*parsed*/, CSteamID /*sender*/) {
+            // Host just stores the start info
+        });
+  
+    MessageHandler::RegisterMessageType("CHUNK_PART", ParseChunkPartMessage,
+        [](Game& /*game*/, ClientNetwork& /*client*/, const ParsedMessage& /*parsed*/) {
+            // Client just processes the chunk part
+        },
+        [](Game& /*game*/, HostNetwork& /*host*/, const ParsedMessage& /*parsed*/, CSteamID /*sender*/) {
+            // Host just processes the chunk part
+        });
+  
+    MessageHandler::RegisterMessageType("CHUNK_END", ParseChunkEndMessage,
+        [](Game& /*game*/, ClientNetwork& /*client*/, const ParsedMessage& /*parsed*/) {
+            // Client should process the reconstructed message
+        },
+        [](Game& /*game*/, HostNetwork& /*host*/, const ParsedMessage& /*parsed*/, CSteamID /*sender*/) {
+            // Host should process the reconstructed message
+        });
+        
+    MessageHandler::RegisterMessageType("T", 
+        ParseChatMessage,
+        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+            client.ProcessChatMessage(game, client, parsed);
+        },
+        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+            host.ProcessChatMessageParsed(game, host, parsed, sender);
+        });
+    
+    // Setup chunking handlers
+    MessageHandler::messageParsers["CHUNK_START"] = [](const std::vector<std::string>& parts) {
+        if (parts.size() >= 4) {
+            std::string messageType = parts[1];
+            int totalChunks = std::stoi(parts[2]);
+            std::string chunkId = parts[3];
+            
+            std::cout << "[MessageHandler] Starting new chunked message " << chunkId 
+                      << " of type " << messageType << " with " << totalChunks << " chunks\n";
+            
+            MessageHandler::chunkTypes[chunkId] = messageType;
+            MessageHandler::chunkCounts[chunkId] = totalChunks;
+            MessageHandler::chunkStorage[chunkId].resize(totalChunks);
+        }
+        return ParsedMessage{MessageType::ChunkStart}; // Create a specific type for chunks
+    };
+    
+    MessageHandler::messageParsers["CHUNK_PART"] = [](const std::vector<std::string>& parts) {
+        ParsedMessage result{MessageType::ChunkPart};
+        if (parts.size() >= 4) {
+            std::string chunkId = parts[1];
+            int chunkNum = std::stoi(parts[2]);
+            std::string chunkData = parts[3];
+            
+            std::cout << "[MessageHandler] Processing chunk part " << chunkNum 
+                      << " for message " << chunkId << "\n";
+            
+            AddChunk(chunkId, chunkNum, chunkData);
+        }
+        return result;
+    };
+    
+    MessageHandler::messageParsers["CHUNK_END"] = [](const std::vector<std::string>& parts) {
+        if (parts.size() >= 2) {
+            std::string chunkId = parts[1];
+            std::cout << "[MessageHandler] Processing CHUNK_END for " << chunkId << "\n";
+            
+            if (MessageHandler::chunkStorage.find(chunkId) != MessageHandler::chunkStorage.end() && 
+                MessageHandler::chunkCounts.find(chunkId) != MessageHandler::chunkCounts.end()) {
+                
+                int expectedChunks = MessageHandler::chunkCounts[chunkId];
+                if (IsChunkComplete(chunkId, expectedChunks)) {
+                    // Get message type
+                    std::string messageType = MessageHandler::chunkTypes[chunkId];
+                    
+                    // Reconstruct the full message
+                    std::string fullMessage = GetReconstructedMessage(chunkId);
+                    
+                    // Parse the reconstructed message
+                    std::vector<std::string> messageParts = MessageHandler::SplitString(fullMessage, '|');
+                    auto parserIt = MessageHandler::messageParsers.find(messageType);
+                    if (parserIt != MessageHandler::messageParsers.end()) {
+                        // Clear chunks to free memory
+                        ClearChunks(chunkId);
+                        
+                        // Parse the reconstructed message and return the result
+                        return parserIt->second(messageParts);
+                    }
+                    else {
+                        std::cout << "[MessageHandler] No parser found for message type: " << messageType << "\n";
+                        ClearChunks(chunkId);
+                    }
+                }
+                else {
+                    std::cout << "[MessageHandler] Chunks incomplete for " << chunkId << ". Expected: " 
+                              << expectedChunks << ", Have: " << MessageHandler::chunkStorage[chunkId].size() << "\n";
+                }
+            }
+            else {
+                std::cout << "[MessageHandler] Chunk storage or counts not found for " << chunkId << "\n";
+            }
+        }
+        
+        return ParsedMessage{MessageType::ChunkEnd};
+    };
+}
+
+void PlayerMessageHandler::Initialize() {
+    // Register message types with their parsers and handlers
+    MessageHandler::RegisterMessageType("C", 
+                        ParseConnectionMessage,
+                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+                            client.ProcessConnectionMessage(game, client, parsed);
+                        },
+                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+                            host.ProcessConnectionMessage(game, host, parsed, sender);
+                        });
+    
+    MessageHandler::RegisterMessageType("M", 
+                        ParseMovementMessage,
+                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+                            client.ProcessMovementMessage(game, client, parsed);
+                        },
+                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+                            host.ProcessMovementMessage(game, host, parsed, sender);
+                        });
+    
+    MessageHandler::RegisterMessageType("B", 
+                        ParseBulletMessage,
+                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+                            client.ProcessBulletMessage(game, client, parsed);
+                        },
+                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+                            host.ProcessBulletMessage(game, host, parsed, sender);
+                        });
+
+    MessageHandler::RegisterMessageType("D", 
+                        ParsePlayerDeathMessage,
+                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+                            client.ProcessPlayerDeathMessage(game, client, parsed);
+                        },
+                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+                            host.ProcessPlayerDeathMessage(game, host, parsed, sender);
+                        });
+
+    MessageHandler::RegisterMessageType("RS", 
+                        ParsePlayerRespawnMessage,
+                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+                            client.ProcessPlayerRespawnMessage(game, client, parsed);
+                        },
+                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+                            host.ProcessPlayerRespawnMessage(game, host, parsed, sender);
+                        });
+
+    MessageHandler::RegisterMessageType("PD", 
+                        ParsePlayerDamageMessage,
+                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+                            client.ProcessPlayerDamageMessage(game, client, parsed);
+                        },
+                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+                            host.ProcessPlayerDamageMessage(game, host, parsed, sender);
+                        });
+                        
+    MessageHandler::RegisterMessageType("KL", 
+                        ParseKillMessage,
+                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+                            client.ProcessKillMessage(game, client, parsed);
+                        },
+                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+                            host.ProcessKillMessage(game, host, parsed, sender);
+                        });
+                        
+    MessageHandler::RegisterMessageType("FZ", 
+                        ParseForceFieldZapMessage,
+                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+                            // Handle force field zap on client
+                            client.ProcessForceFieldZapMessage(game, client, parsed);
+                        },
+                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+                            // Handle force field zap on host
+                            host.ProcessForceFieldZapMessage(game, host, parsed, sender);
+                        });
+                        
+    MessageHandler::RegisterMessageType("FFU", 
+                      ParseForceFieldUpdateMessage,
+                      [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+                          // Handle force field update on client
+                          client.ProcessForceFieldUpdateMessage(game, client, parsed);
+                      },
+                      [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+                          // Handle force field update on host
+                          host.ProcessForceFieldUpdateMessage(game, host, parsed, sender);
+                      });
+    
+    MessageHandler::RegisterMessageType("PS", 
+                        ParsePlayerSnapshotMessage,
+                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+                            client.ProcessPlayerSnapshotMessage(game, client, parsed);
+                        },
+                        [](Game& /*game*/, HostNetwork& /*host*/, const ParsedMessage& /*parsed*/, CSteamID /*sender*/) {
+                            // Only the host produces snapshots
+                            std::cout << "[HOST] Received player snapshot from client, ignoring\n";
+                        });
+    
+    MessageHandler::RegisterMessageType("IN", 
+                        ParsePlayerInputMessage,
+                        [](Game& /*game*/, ClientNetwork& /*client*/, const ParsedMessage& /*parsed*/) {
+                            // Input commands only travel to the host
+                        },
+                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+                            host.ProcessPlayerInputMessage(game, host, parsed, sender);
+                        });
+}
+
+void EnemyMessageHandler::Initialize() {
+    // Register enemy message types
+    MessageHandler::RegisterMessageType("EA", 
+        ParseEnemyAddMessage,
+        [](Game& game, ClientNetwork& /*client*/, const ParsedMessage& parsed) {
+            PlayingState* state = GetPlayingState(&game);
+            if (state && state->GetEnemyManager()) {
+                state->GetEnemyManager()->RemoteAddEnemy(parsed.enemyId, parsed.enemyType, parsed.position, parsed.health);
+            }
+        },
+        [](Game& /*game*/, HostNetwork& /*host*/, const ParsedMessage& /*parsed*/, CSteamID /*sender*/) {
+            // Host should be the one creating enemies, not receiving
+            std::cout << "[HOST] Received enemy add message from client, ignoring\n";
+        });
+
+    MessageHandler::RegisterMessageType("ER", 
+        ParseEnemyRemoveMessage,
+        [](Game& game, ClientNetwork& /*client*/, const ParsedMessage& parsed) {
+            PlayingState* state = GetPlayingState(&game);
+            if (state && state->GetEnemyManager()) {
+                state->GetEnemyManager()->RemoteRemoveEnemy(parsed.enemyId);
+            }
+        },
+        [](Game& game, HostNetwork& /*host*/, const ParsedMessage& parsed, CSteamID /*sender*/) {
+            // Client notifying host of enemy removal
+            PlayingState* state = GetPlayingState(&game);
+            if (state && state->GetEnemyManager()) {
+                state->GetEnemyManager()->RemoveEnemy(parsed.enemyId);
+            }
+        });
+
+    MessageHandler::RegisterMessageType("ED", 
+        ParseEnemyDamageMessage,
+        [](Game& game, ClientNetwork& /*client*/, const ParsedMessage& parsed) {
+            PlayingState* state = GetPlayingState(&game);
+            if (state && state->GetEnemyManager()) {
+                EnemyManager* enemyManager = state->GetEnemyManager();
+                if (parsed.enemyId >= 0) {
+                    auto enemy = enemyManager->FindEnemy(parsed.enemyId);
+                    if (enemy) {
+                        enemy->SetHealth(parsed.health);
+                        if (parsed.health <= 0) {
+                            enemyManager->RemoteRemoveEnemy(parsed.enemyId);
+                        }
+                    }
+                }
+            }
+        },
+        [](Game& game, HostNetwork& /*host*/, const ParsedMessage& parsed, CSteamID /*sender*/) {
+            // Client informing host of damage to enemy
+            PlayingState* state = GetPlayingState(&game);
+            if (state && state->GetEnemyManager()) {
+                state->GetEnemyManager()->InflictDamage(parsed.enemyId, parsed.damage);
+            }
+        });
+        MessageHandler::RegisterMessageType("ES",
+            ParseEnemyStateMessage,
+            [](Game& game, ClientNetwork& /*client*/, const ParsedMessage& parsed) {
+                PlayingState* state = GetPlayingState(&game);
+                if (state && state->GetEnemyManager()) {
+                    auto enemyManager = state->GetEnemyManager();
+                    for (size_t i = 0; i < parsed.enemyIds.size(); ++i) {
+                        int id = parsed.enemyIds[i];
+                        Enemy* enemy = enemyManager->FindEnemy(id);
+                        if (!enemy) {
+                            EnemyType type = static_cast<EnemyType>(parsed.enemyTypes[i]);
+                            enemyManager->RemoteAddEnemy(id, type, parsed.enemyPositions[i], parsed.enemyHealths[i]);
+                        } else {
+                            enemy->SetPosition(parsed.enemyPositions[i]);
+                            enemy->SetHealth(parsed.enemyHealths[i]);
+                        }
+                    }
+                    // No need to remove enemies here; full state ("ECS") will handle that
+                }
+            },
+            [](Game& /*game*/, HostNetwork& /*host*/, const ParsedMessage& /*parsed*/, CSteamID /*sender*/) {
+                // Host ignores ES from clients
+            });
+        MessageHandler::RegisterMessageType("EP", 
+            ParseEnemyPositionUpdateMessage,
+            [](Game& game, ClientNetwork& /*client*/, const ParsedMessage& parsed) {
+                PlayingState* state = GetPlayingState(&game);
+                if (state && state->GetEnemyManager()) {
+                    // Feed dead reckoning; untimed updates still snap
+                    EnemyManager* enemyManager = state->GetEnemyManager();
+                    for (size_t i = 0; i < parsed.enemyIds.size(); ++i) {
+                        int id = parsed.enemyIds[i];
+                        Enemy* enemy = enemyManager->FindEnemy(id);
+                        if (enemy) {
+                            sf::Vector2f velocity = i < parsed.enemyVelocities.size() ? parsed.enemyVelocities[i] : sf::Vector2f(0.f, 0.f);
+                            enemy->SetVelocity(velocity);
+                            if (parsed.snapshotTime != 0) {
+                                enemyManager->PushEnemySnapshot(id, parsed.snapshotTime, parsed.enemyPositions[i], &velocity);
+                            } else {
+                                enemy->SetPosition(parsed.enemyPositions[i]);
+                            }
+                        }
+                    }
+                }
+            },
+            [](Game& /*game*/, HostNetwork& /*host*/, const ParsedMessage& /*parsed*/, CSteamID /*sender*/) {
+                // Host doesn't usually receive EP messages, but could process them if needed
+                std::cout << "[HOST] Received enemy position update from client, ignoring\n";
+            });
+            MessageHandler::RegisterMessageType("ESR", 
+                ParseEnemyStateRequestMessage,
+                [](Game& /*game*/, ClientNetwork& /*client*/, const ParsedMessage& /*parsed*/) {
+                    // Client requesting enemy state (nothing to do here)
+                },
+                [](Game& game, HostNetwork& /*host*/, const ParsedMessage& /*parsed*/, CSteamID sender) {
+                    // Host handling state request - should send current enemy states
+                    PlayingState* state = GetPlayingState(&game);
+                    if (state && state->GetEnemyManager()) {
+                        // Send a complete enemy state directly to the requesting client
+                        EnemyManager* enemyManager = state->GetEnemyManager();
+                        
+                        // Create vectors for the state message
+                        std::vector<int> enemyIds;
+                        std::vector<EnemyType> types;
+                        std::vector<sf::Vector2f> positions;
+                        std::vector<float> healths;
+                        
+                        // Get all current enemies
+                        for (const auto& pair : enemyManager->GetEnemies()) {
+                            enemyIds.push_back(pair.first);
+                            types.push_back(pair.second->GetType());
+                            positions.push_back(pair.second->GetPosition());
+                            healths.push_back(pair.second->GetHealth());
+                        }
+                        
+                        // Create and send the message
+                        std::string stateMsg = EnemyMessageHandler::FormatCompleteEnemyStateMessage(
+                            enemyIds, types, positions, healths);
+                            
+                        // Send directly to the requesting client
+                        game.GetNetworkManager().SendMessage(sender, stateMsg);
+                        
+                        std::cout << "[HOST] Sent requested enemy state to client with " 
+                                  << enemyIds.size() << " enemies\n";
+                    }
+                });
+
+    MessageHandler::RegisterMessageType("EC", 
+        ParseEnemyClearMessage,
+        [](Game& game, ClientNetwork& /*client*/, const ParsedMessage& /*parsed*/) {
+            PlayingState* state = GetPlayingState(&game);
+            if (state && state->GetEnemyManager()) {
+                state->GetEnemyManager()->ClearEnemies();
+            }
+        },
+        [](Game& /*game*/, HostNetwork& /*host*/, const ParsedMessage& /*parsed*/, CSteamID /*sender*/) {
+            // Host initiates clear, not receives it
+            std::cout << "[HOST] Received enemy clear from client, ignoring\n";
+        });
+        MessageHandler::RegisterMessageType("ECS",
+            EnemyMessageHandler::ParseCompleteEnemyStateMessage,
+            [](Game& game, ClientNetwork& /*client*/, const ParsedMessage& parsed) {
+                PlayingState* state = GetPlayingState(&game);
+                if (state && state->GetEnemyManager()) {
+                    auto enemyManager = state->GetEnemyManager();
+                    for (size_t i = 0; i < parsed.enemyIds.size(); ++i) {
+                        int id = parsed.enemyIds[i];
+                        Enemy* enemy = enemyManager->FindEnemy(id);
+                        if (!enemy) {
+                            enemyManager->RemoteAddEnemy(id, static_cast<EnemyType>(parsed.enemyTypes[i]), parsed.enemyPositions[i], parsed.enemyHealths[i]);
+                        } else if (parsed.snapshotTime != 0) {
+                            // Full state has no velocities; the buffer derives one from the previous sample
+                            enemyManager->PushEnemySnapshot(id, parsed.snapshotTime, parsed.enemyPositions[i], nullptr);
+                            enemy->SetHealth(parsed.enemyHealths[i]);
+                        } else {
+                            enemy->SetPosition(parsed.enemyPositions[i]);
+                            enemy->SetHealth(parsed.enemyHealths[i]);
+                        }
+                    }
+                    enemyManager->RemoveEnemiesNotInList(parsed.enemyIds);
+                }
+            },
+            [](Game& /*game*/, HostNetwork& /*host*/, const ParsedMessage& /*parsed*/, CSteamID /*sender*/) {
+                // Host ignores ECS from clients
+            });
+    MessageHandler::RegisterMessageType("EB",
+        ParseEnemyBehaviorMessage,
+        [](Game& game, ClientNetwork& /*client*/, const ParsedMessage& parsed) {
+            PlayingState* state = GetPlayingState(&game);
+            if (state && state->GetEnemyManager()) {
+                EnemyManager* enemyManager = state->GetEnemyManager();
+                for (size_t i = 0; i < parsed.enemyIds.size(); ++i) {
+                    enemyManager->ApplyEnemyBehavior(parsed.enemyIds[i], parsed.enemyStates[i]);
+                }
+            }
+        },
+        [](Game& /*game*/, HostNetwork& /*host*/, const ParsedMessage& /*parsed*/, CSteamID /*sender*/) {
+            // Host owns enemy behaviour
+        });
+}
+
+void StateMessageHandler::Initialize() {
+    // Register state message types
+    MessageHandler::RegisterMessageType("R", 
+                        ParseReadyStatusMessage,
+                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+                            client.ProcessReadyStatusMessage(game, client, parsed);
+                        },
+                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+                            host.ProcessReadyStatusMessage(game, host, parsed, sender);
+                        });
+
+    MessageHandler::RegisterMessageType("SG", 
+                        ParseStartGameMessage,
+                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
+                            client.ProcessStartGameMessage(game, client, parsed);
+                        },
+                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
+                            host.ProcessStartGameMessage(game, host, parsed, sender);
+                        });
+    MessageHandler::RegisterMessageType("WS", 
+                            ParseWaveStartMessage,
+                            [](Game& game, ClientNetwork& /*client*/, const ParsedMessage& parsed) {
+                                PlayingState* state = GetPlayingState(&game);
+                                if (state && state->GetEnemyManager()) {
+                                    // Just update the wave number, don't spawn enemies
+                                    state->GetEnemyManager()->SetCurrentWave(parsed.waveNumber);
+                                    TraceRecorder::Get().Marker("Wave start", "wave", parsed.waveNumber,
+                                                                "enemies", parsed.enemyCount);
+                                    
+                                    // Update UI
+                                    if (state->GetUI()) {
+                                        state->GetUI()->UpdateWaveInfo();
+                                    }
+                                    
+                                    std::cout << "[CLIENT] Received wave start message for wave " 
+                                             << parsed.waveNumber << " with " << parsed.enemyCount << " enemies\n";
+                                }
+                            },
+                            [](Game& /*game*/, HostNetwork& /*host*/, const ParsedMessage& /*parsed*/, CSteamID /*sender*/) {
+                                // Host initiates waves, not receives messages about them
+                            });
+}
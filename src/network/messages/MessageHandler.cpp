@@ -7,10 +7,6 @@
 #include <sstream>
 #include <chrono>
 #include <cstdlib>
-#include "../Client.h"
-#include "../Host.h"
-#include "../../core/Game.h"
-#include "../../states/PlayingState.h"
 #include <sstream>
 #include <iostream>
 #include <chrono>
@@ -23,18 +19,6 @@ std::unordered_map<std::string, std::vector<std::string>> MessageHandler::chunkS
 std::unordered_map<std::string, std::string> MessageHandler::chunkTypes;
 std::unordered_map<std::string, int> MessageHandler::chunkCounts;
 
-void MessageHandler::Initialize() {
-    // Clear existing handlers
-    messageParsers.clear();
-    messageDescriptors.clear();
-    
-    // Initialize all message handlers
-    SystemMessageHandler::Initialize();
-    PlayerMessageHandler::Initialize();
-    EnemyMessageHandler::Initialize();
-    StateMessageHandler::Initialize();
-}
-
 void MessageHandler::RegisterMessageType(
     const std::string& prefix,
     MessageParserFunc parser,
@@ -57,6 +41,8 @@ std::string MessageHandler::GetPrefixForType(MessageType type) {
         case MessageType::Kill: return "KL";
         case MessageType::ForceFieldZap: return "FZ";
         case MessageType::ForceFieldUpdate: return "FFU";
+        case MessageType::PlayerSnapshot: return "PS";
+        case MessageType::PlayerInput: return "IN";
         
         // Enemy-related messages
         case MessageType::EnemyAdd: return "EA";
@@ -66,6 +52,7 @@ std::string MessageHandler::GetPrefixForType(MessageType type) {
         case MessageType::EnemyState: return "ES";
         case MessageType::EnemyStateRequest: return "ESR";
         case MessageType::EnemyClear: return "EC";
+        case MessageType::EnemyBehavior: return "EB";
         
         // State-related messages
         case MessageType::ReadyStatus: return "R";
@@ -119,46 +106,6 @@ ParsedMessage MessageHandler::ParseMessage(const std::string& msg) {
     return ParsedMessage{MessageType::Unknown};
 }
 
-void MessageHandler::ProcessUnknownMessage(Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-    // Check if it might be a chunked message that was incorrectly parsed
-    if (!parsed.steamID.empty()) {
-        std::cout << "[MessageHandler] Attempting to recover from unknown message, ID: " << parsed.steamID << "\n";
-        
-        // Try to interpret it as an enemy state update if it contains numbers and commas
-        if (parsed.steamID.find_first_of("0123456789,.") != std::string::npos) {
-            std::vector<std::string> parts;
-            parts.push_back("ES"); // Enemy State prefix
-            parts.push_back(parsed.steamID);
-            
-            // Try to parse as enemy state
-            ParsedMessage recoveredMessage = EnemyMessageHandler::ParseEnemyStateMessage(parts);
-            
-            // If we recovered at least one enemy, process it
-            if (!recoveredMessage.enemyIds.empty()) {
-                std::cout << "[MessageHandler] Recovered " << recoveredMessage.enemyIds.size() << " enemy positions\n";
-                PlayingState* state = GetPlayingState(&game);
-                if (state && state->GetEnemyManager()) {
-                    for (size_t i = 0; i < recoveredMessage.enemyIds.size(); ++i) {
-                        int id = recoveredMessage.enemyIds[i];
-                        auto enemyManager = state->GetEnemyManager();
-                        auto enemy = enemyManager->FindEnemy(id);
-                        
-                        if (enemy) {
-                            // Update existing enemy
-                            enemy->SetPosition(recoveredMessage.enemyPositions[i]);
-                        } else {
-                            // Create new enemy
-                            EnemyType type = static_cast<EnemyType>(recoveredMessage.enemyTypes[i]);
-                            enemyManager->RemoteAddEnemy(id, type, recoveredMessage.enemyPositions[i], 
-                                                       recoveredMessage.enemyHealths[i]);
-                        }
-                    }
-                }
-            }
-        }
-    }
-}
-
 // Utility function to split strings - needed by all message handlers
 std::vector<std::string> MessageHandler::SplitString(const std::string& str, char delimiter) {
     std::vector<std::string> parts;
@@ -49,13 +49,30 @@ enum class MessageType {
     SettingsUpdate,
     SettingsRequest,
     ReturnToLobby,
+    PlayerSnapshot,
+    PlayerInput,
+    EnemyBehavior,
+};
+
+// One player's replicated state inside a host snapshot
+struct PlayerSnapshotEntry {
+    int slot = PLAYER_INVALID_INDEX;
+    sf::Vector2f position;
+    sf::Vector2f velocity;
+    int health = 0;
+    bool alive = false;
+    uint32_t ack = 0;   // Last input command the host applied for this player
 };
 
 struct ParsedMessage {
+    ParsedMessage() = default;
+    explicit ParsedMessage(MessageType type) : type(type) {}
+
     MessageType type = MessageType::Unknown;
     std::string steamID;
     std::string steamName;
-    std::string killerID;
+    int playerSlot = PLAYER_INVALID_INDEX;   // Session slot of the player the message is about
+    int killerSlot = PLAYER_INVALID_INDEX;   // Session slot of the killer (death messages)
     sf::Vector2f position;
     sf::Color color;
     std::string chatMessage;
@@ -74,7 +91,16 @@ struct ParsedMessage {
     std::vector<float> enemyHealths;
     int health;
     std::vector<int> enemyTypes;
+    std::vector<std::string> enemyStates;   // Enemy::Serialize() strings with behaviour (EB)
     uint32_t killSequence;
+    std::vector<PlayerSnapshotEntry> playerSnapshot;
+    uint64_t snapshotTime = 0;    // Host timestamp (ms) on PS, EP and ECS; 0 when absent
+    uint64_t viewTime = 0;        // Host time (ms) the shooter's screen showed when firing (B); 0 when unknown
+    
+    // Movement input commands (client -> host); position holds the client's position before the first
+    uint32_t inputSequence = 0;   // Sequence of the first command in movementInputs
+    int tickRate = 0;             // Sender's simulation rate in Hz (C from the host, IN); 0 when absent
+    std::vector<uint8_t> movementInputs;
     
     // Force field update parameters
     float ffRadius;
@@ -1,97 +1,29 @@
 #include "PlayerMessageHandler.h"
 #include "MessageHandler.h"
-#include "../Client.h"
-#include "../Host.h"
-#include "../../core/Game.h"
+#include "../SnapshotBuffer.h"
 #include <sstream>
 #include <iostream>
 
-void PlayerMessageHandler::Initialize() {
-    // Register message types with their parsers and handlers
-    MessageHandler::RegisterMessageType("C", 
-                        ParseConnectionMessage,
-                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                            client.ProcessConnectionMessage(game, client, parsed);
-                        },
-                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                            host.ProcessConnectionMessage(game, host, parsed, sender);
-                        });
-    
-    MessageHandler::RegisterMessageType("M", 
-                        ParseMovementMessage,
-                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                            client.ProcessMovementMessage(game, client, parsed);
-                        },
-                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                            host.ProcessMovementMessage(game, host, parsed, sender);
-                        });
-    
-    MessageHandler::RegisterMessageType("B", 
-                        ParseBulletMessage,
-                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                            client.ProcessBulletMessage(game, client, parsed);
-                        },
-                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                            host.ProcessBulletMessage(game, host, parsed, sender);
-                        });
-
-    MessageHandler::RegisterMessageType("D", 
-                        ParsePlayerDeathMessage,
-                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                            client.ProcessPlayerDeathMessage(game, client, parsed);
-                        },
-                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                            host.ProcessPlayerDeathMessage(game, host, parsed, sender);
-                        });
+namespace {
+    const char SLOT_DIGITS[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    const char SLOT_UNKNOWN = '-';
+}
 
-    MessageHandler::RegisterMessageType("RS", 
-                        ParsePlayerRespawnMessage,
-                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                            client.ProcessPlayerRespawnMessage(game, client, parsed);
-                        },
-                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                            host.ProcessPlayerRespawnMessage(game, host, parsed, sender);
-                        });
+char PlayerMessageHandler::EncodeSlot(int slot) {
+    if (slot < 0 || slot >= PLAYER_REGISTRY_CAPACITY || slot >= static_cast<int>(sizeof(SLOT_DIGITS) - 1)) {
+        return SLOT_UNKNOWN;
+    }
+    return SLOT_DIGITS[slot];
+}
 
-    MessageHandler::RegisterMessageType("PD", 
-                        ParsePlayerDamageMessage,
-                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                            client.ProcessPlayerDamageMessage(game, client, parsed);
-                        },
-                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                            host.ProcessPlayerDamageMessage(game, host, parsed, sender);
-                        });
-                        
-    MessageHandler::RegisterMessageType("KL", 
-                        ParseKillMessage,
-                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                            client.ProcessKillMessage(game, client, parsed);
-                        },
-                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                            host.ProcessKillMessage(game, host, parsed, sender);
-                        });
-                        
-    MessageHandler::RegisterMessageType("FZ", 
-                        ParseForceFieldZapMessage,
-                        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                            // Handle force field zap on client
-                            client.ProcessForceFieldZapMessage(game, client, parsed);
-                        },
-                        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                            // Handle force field zap on host
-                            host.ProcessForceFieldZapMessage(game, host, parsed, sender);
-                        });
-                        
-    MessageHandler::RegisterMessageType("FFU", 
-                      ParseForceFieldUpdateMessage,
-                      [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-                          // Handle force field update on client
-                          client.ProcessForceFieldUpdateMessage(game, client, parsed);
-                      },
-                      [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-                          // Handle force field update on host
-                          host.ProcessForceFieldUpdateMessage(game, host, parsed, sender);
-                      });
+int PlayerMessageHandler::DecodeSlot(const std::string& field) {
+    if (field.size() != 1) return PLAYER_INVALID_INDEX;
+    char c = field[0];
+    int slot = PLAYER_INVALID_INDEX;
+    if (c >= '0' && c <= '9') slot = c - '0';
+    else if (c >= 'a' && c <= 'z') slot = 10 + (c - 'a');
+    if (slot >= PLAYER_REGISTRY_CAPACITY) return PLAYER_INVALID_INDEX;
+    return slot;
 }
 
 // Connection message parsing
@@ -108,6 +40,16 @@ ParsedMessage PlayerMessageHandler::ParseConnectionMessage(const std::vector<std
         parsed.color = sf::Color(r, g, b);
         parsed.isReady = (parts[4] == "1");
         parsed.isHost = (parts[5] == "1");
+        if (parts.size() >= 7) {
+            parsed.playerSlot = DecodeSlot(parts[6]);
+        }
+        if (parts.size() >= 8) {
+            try {
+                parsed.tickRate = std::stoi(parts[7]);
+            } catch (const std::exception& e) {
+                parsed.tickRate = 0;
+            }
+        }
     }
     return parsed;
 }
@@ -117,7 +59,7 @@ ParsedMessage PlayerMessageHandler::ParseMovementMessage(const std::vector<std::
     ParsedMessage parsed;
     parsed.type = MessageType::Movement;
     if (parts.size() >= 3) {
-        parsed.steamID = parts[1];
+        parsed.playerSlot = DecodeSlot(parts[1]);
         std::istringstream posStream(parts[2]);
         float x, y;
         char comma;
@@ -132,7 +74,7 @@ ParsedMessage PlayerMessageHandler::ParseBulletMessage(const std::vector<std::st
     ParsedMessage parsed;
     parsed.type = MessageType::Bullet;
     if (parts.size() >= 5) {
-        parsed.steamID = parts[1];
+        parsed.playerSlot = DecodeSlot(parts[1]);
         std::istringstream posStream(parts[2]);
         float px, py;
         char comma;
@@ -143,6 +85,9 @@ ParsedMessage PlayerMessageHandler::ParseBulletMessage(const std::vector<std::st
         dirStream >> dx >> comma >> dy;
         parsed.direction = sf::Vector2f(dx, dy);
         parsed.velocity = std::stof(parts[4]);
+        if (parts.size() >= 6) {
+            parsed.viewTime = std::stoull(parts[5]);
+        }
     }
     return parsed;
 }
@@ -152,8 +97,8 @@ ParsedMessage PlayerMessageHandler::ParsePlayerDeathMessage(const std::vector<st
     ParsedMessage parsed;
     parsed.type = MessageType::PlayerDeath;
     if (parts.size() >= 3) {
-        parsed.steamID = parts[1];
-        parsed.killerID = parts[2];
+        parsed.playerSlot = DecodeSlot(parts[1]);
+        parsed.killerSlot = DecodeSlot(parts[2]);
     }
     return parsed;
 }
@@ -163,7 +108,7 @@ ParsedMessage PlayerMessageHandler::ParsePlayerRespawnMessage(const std::vector<
     ParsedMessage parsed;
     parsed.type = MessageType::PlayerRespawn;
     if (parts.size() >= 3) {
-        parsed.steamID = parts[1];
+        parsed.playerSlot = DecodeSlot(parts[1]);
         std::istringstream posStream(parts[2]);
         float x, y;
         char comma;
@@ -178,7 +123,7 @@ ParsedMessage PlayerMessageHandler::ParsePlayerDamageMessage(const std::vector<s
     ParsedMessage parsed;
     parsed.type = MessageType::PlayerDamage;
     if (parts.size() >= 4) {
-        parsed.steamID = parts[1];
+        parsed.playerSlot = DecodeSlot(parts[1]);
         parsed.damage = std::stoi(parts[2]);
         parsed.enemyId = std::stoi(parts[3]);
     }
@@ -190,7 +135,7 @@ ParsedMessage PlayerMessageHandler::ParseKillMessage(const std::vector<std::stri
     ParsedMessage parsed;
     parsed.type = MessageType::Kill;
     if (parts.size() >= 3) {
-        parsed.steamID = parts[1];  // Killer ID
+        parsed.playerSlot = DecodeSlot(parts[1]);  // Killer slot
         parsed.enemyId = std::stoi(parts[2]);  // Enemy ID
     }
     return parsed;
@@ -202,7 +147,7 @@ ParsedMessage PlayerMessageHandler::ParseForceFieldZapMessage(const std::vector<
     parsed.type = MessageType::ForceFieldZap;
     
     if (parts.size() >= 4) {
-        parsed.steamID = parts[1];  // Player ID who owns the force field
+        parsed.playerSlot = DecodeSlot(parts[1]);  // Slot of the player who owns the force field
         parsed.enemyId = std::stoi(parts[2]);  // Enemy ID that was zapped
         parsed.damage = std::stof(parts[3]);  // Damage applied
     }
@@ -216,7 +161,7 @@ ParsedMessage PlayerMessageHandler::ParseForceFieldUpdateMessage(const std::vect
     parsed.type = MessageType::ForceFieldUpdate;
     
     if (parts.size() >= 9) {
-        parsed.steamID = parts[1];                   // Player ID
+        parsed.playerSlot = DecodeSlot(parts[1]);    // Player slot
         parsed.ffRadius = std::stof(parts[2]);       // Force field radius
         parsed.ffDamage = std::stof(parts[3]);       // Force field damage
         parsed.ffCooldown = std::stof(parts[4]);     // Force field cooldown
@@ -229,75 +174,159 @@ ParsedMessage PlayerMessageHandler::ParseForceFieldUpdateMessage(const std::vect
     return parsed;
 }
 
+// Player snapshot parsing
+ParsedMessage PlayerMessageHandler::ParsePlayerSnapshotMessage(const std::vector<std::string>& parts) {
+    ParsedMessage parsed;
+    parsed.type = MessageType::PlayerSnapshot;
+    
+    // Format: PS|hostTimeMs|slot,x,y,vx,vy,health,alive,ack|slot,...|...
+    if (parts.size() < 2) return parsed;
+    try {
+        parsed.snapshotTime = std::stoull(parts[1]);
+    } catch (const std::exception& e) {
+        std::cout << "[PlayerMessageHandler] Bad snapshot timestamp: " << parts[1] << "\n";
+    }
+    for (size_t i = 2; i < parts.size(); ++i) {
+        std::vector<std::string> fields = MessageHandler::SplitString(parts[i], ',');
+        if (fields.size() < 7) continue;
+        
+        PlayerSnapshotEntry entry;
+        entry.slot = DecodeSlot(fields[0]);
+        if (entry.slot == PLAYER_INVALID_INDEX) continue;
+        try {
+            entry.position = sf::Vector2f(std::stof(fields[1]), std::stof(fields[2]));
+            entry.velocity = sf::Vector2f(std::stof(fields[3]), std::stof(fields[4]));
+            entry.health = std::stoi(fields[5]);
+            if (fields.size() >= 8) {
+                entry.ack = static_cast<uint32_t>(std::stoul(fields[7]));
+            }
+        } catch (const std::exception& e) {
+            std::cout << "[PlayerMessageHandler] Bad snapshot entry: " << parts[i] << "\n";
+            continue;
+        }
+        entry.alive = (fields[6] == "1");
+        parsed.playerSnapshot.push_back(entry);
+    }
+    
+    return parsed;
+}
+
+// Player input parsing
+ParsedMessage PlayerMessageHandler::ParsePlayerInputMessage(const std::vector<std::string>& parts) {
+    ParsedMessage parsed;
+    parsed.type = MessageType::PlayerInput;
+    
+    // Format: IN|firstSeq|x,y|<one hex digit per command>|tickRate (no commands for a heartbeat)
+    if (parts.size() >= 3) {
+        try {
+            parsed.inputSequence = static_cast<uint32_t>(std::stoul(parts[1]));
+            std::istringstream posStream(parts[2]);
+            float x, y;
+            char comma;
+            posStream >> x >> comma >> y;
+            parsed.position = sf::Vector2f(x, y);
+        } catch (const std::exception& e) {
+            std::cout << "[PlayerMessageHandler] Bad input message\n";
+            parsed.type = MessageType::Unknown;
+            return parsed;
+        }
+        if (parts.size() >= 4) {
+            parsed.movementInputs.reserve(parts[3].size());
+            for (char c : parts[3]) {
+                if (c >= '0' && c <= '9') parsed.movementInputs.push_back(static_cast<uint8_t>(c - '0'));
+                else if (c >= 'a' && c <= 'f') parsed.movementInputs.push_back(static_cast<uint8_t>(10 + c - 'a'));
+            }
+        }
+        if (parts.size() >= 5) {
+            try {
+                parsed.tickRate = std::stoi(parts[4]);
+            } catch (const std::exception& e) {
+                parsed.tickRate = 0;
+            }
+        }
+    }
+    return parsed;
+}
+
 // Message formatting functions
 std::string PlayerMessageHandler::FormatConnectionMessage(const std::string& steamID, 
                                                      const std::string& steamName, 
                                                      const sf::Color& color, 
                                                      bool isReady, 
-                                                     bool isHost) {
+                                                     bool isHost,
+                                                     int slot,
+                                                     int tickRate) {
     std::ostringstream oss;
     oss << "C|" << steamID << "|" << steamName << "|" 
         << static_cast<int>(color.r) << "," 
         << static_cast<int>(color.g) << "," 
         << static_cast<int>(color.b) << "|" 
         << (isReady ? "1" : "0") << "|" 
-        << (isHost ? "1" : "0");
+        << (isHost ? "1" : "0") << "|"
+        << EncodeSlot(slot);
+    if (tickRate > 0) {
+        oss << "|" << tickRate;
+    }
     return oss.str();
 }
 
-std::string PlayerMessageHandler::FormatMovementMessage(const std::string& steamID, 
+std::string PlayerMessageHandler::FormatMovementMessage(int playerSlot, 
                                                     const sf::Vector2f& position) {
     std::ostringstream oss;
-    oss << "M|" << steamID << "|" << position.x << "," << position.y;
+    oss << "M|" << EncodeSlot(playerSlot) << "|" << position.x << "," << position.y;
     return oss.str();
 }
 
-std::string PlayerMessageHandler::FormatBulletMessage(const std::string& shooterID, 
+std::string PlayerMessageHandler::FormatBulletMessage(int shooterSlot, 
                                                  const sf::Vector2f& position, 
                                                  const sf::Vector2f& direction, 
-                                                 float velocity) {
+                                                 float velocity,
+                                                 uint64_t viewTime) {
     std::ostringstream oss;
-    oss << "B|" << shooterID << "|" << position.x << "," << position.y << "|" 
+    oss << "B|" << EncodeSlot(shooterSlot) << "|" << position.x << "," << position.y << "|" 
         << direction.x << "," << direction.y << "|" << velocity;
+    if (viewTime != 0) {
+        oss << "|" << viewTime;
+    }
     return oss.str();
 }
 
-std::string PlayerMessageHandler::FormatPlayerDeathMessage(const std::string& playerID, 
-                                                      const std::string& killerID) {
+std::string PlayerMessageHandler::FormatPlayerDeathMessage(int playerSlot, 
+                                                      int killerSlot) {
     std::ostringstream oss;
-    oss << "D|" << playerID << "|" << killerID;
+    oss << "D|" << EncodeSlot(playerSlot) << "|" << EncodeSlot(killerSlot);
     return oss.str();
 }
 
-std::string PlayerMessageHandler::FormatPlayerRespawnMessage(const std::string& playerID, 
+std::string PlayerMessageHandler::FormatPlayerRespawnMessage(int playerSlot, 
                                                         const sf::Vector2f& position) {
     std::ostringstream oss;
-    oss << "RS|" << playerID << "|" << position.x << "," << position.y;
+    oss << "RS|" << EncodeSlot(playerSlot) << "|" << position.x << "," << position.y;
     return oss.str();
 }
 
-std::string PlayerMessageHandler::FormatPlayerDamageMessage(const std::string& playerID, 
+std::string PlayerMessageHandler::FormatPlayerDamageMessage(int playerSlot, 
                                                        int damage, 
                                                        int enemyId) {
     std::ostringstream oss;
-    oss << "PD|" << playerID << "|" << damage << "|" << enemyId;
+    oss << "PD|" << EncodeSlot(playerSlot) << "|" << damage << "|" << enemyId;
     return oss.str();
 }
 
-std::string PlayerMessageHandler::FormatKillMessage(const std::string& killerID, int enemyId) {
+std::string PlayerMessageHandler::FormatKillMessage(int killerSlot, int enemyId) {
     std::ostringstream oss;
-    oss << "KL|" << killerID << "|" << enemyId;
+    oss << "KL|" << EncodeSlot(killerSlot) << "|" << enemyId;
     return oss.str();
 }
 
-std::string PlayerMessageHandler::FormatForceFieldZapMessage(const std::string& playerID, int enemyId, float damage) {
+std::string PlayerMessageHandler::FormatForceFieldZapMessage(int playerSlot, int enemyId, float damage) {
     std::ostringstream oss;
-    oss << "FZ|" << playerID << "|" << enemyId << "|" << damage;
+    oss << "FZ|" << EncodeSlot(playerSlot) << "|" << enemyId << "|" << damage;
     return oss.str();
 }
 
 std::string PlayerMessageHandler::FormatForceFieldUpdateMessage(
-    const std::string& playerID,
+    int playerSlot,
     float radius,
     float damage,
     float cooldown,
@@ -307,7 +336,7 @@ std::string PlayerMessageHandler::FormatForceFieldUpdateMessage(
     bool chainEnabled)
 {
     std::ostringstream oss;
-    oss << "FFU|" << playerID 
+    oss << "FFU|" << EncodeSlot(playerSlot) 
         << "|" << radius 
         << "|" << damage 
         << "|" << cooldown 
@@ -316,4 +345,34 @@ std::string PlayerMessageHandler::FormatForceFieldUpdateMessage(
         << "|" << powerLevel
         << "|" << (chainEnabled ? "1" : "0");
     return oss.str();
-}
\ No newline at end of file
+}
+
+std::string PlayerMessageHandler::FormatPlayerSnapshotMessage(const std::vector<PlayerSnapshotEntry>& entries) {
+    std::ostringstream oss;
+    oss << "PS|" << SnapshotClock::HostNow();
+    for (const PlayerSnapshotEntry& entry : entries) {
+        oss << "|" << EncodeSlot(entry.slot)
+            << "," << entry.position.x << "," << entry.position.y
+            << "," << entry.velocity.x << "," << entry.velocity.y
+            << "," << entry.health
+            << "," << (entry.alive ? "1" : "0")
+            << "," << entry.ack;
+    }
+    return oss.str();
+}
+
+std::string PlayerMessageHandler::FormatPlayerInputMessage(uint32_t firstSequence,
+                                                       const sf::Vector2f& basePosition,
+                                                       const std::vector<uint8_t>& inputs,
+                                                       int tickRate) {
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    std::ostringstream oss;
+    oss << "IN|" << firstSequence 
+        << "|" << basePosition.x << "," << basePosition.y 
+        << "|";
+    for (uint8_t input : inputs) {
+        oss << HEX_DIGITS[input & 0x0F];
+    }
+    oss << "|" << tickRate;
+    return oss.str();
+}
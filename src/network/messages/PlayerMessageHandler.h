@@ -5,9 +5,11 @@
 #include <vector>
 #include <SFML/Graphics.hpp>
 #include <steam/steam_api.h>
+#include "../../utils/config/PlayerConfig.h"
 
 // Forward declarations
 struct ParsedMessage;
+struct PlayerSnapshotEntry;
 
 class PlayerMessageHandler {
 public:
@@ -24,30 +26,44 @@ public:
     static ParsedMessage ParseKillMessage(const std::vector<std::string>& parts);
     static ParsedMessage ParseForceFieldZapMessage(const std::vector<std::string>& parts);
     static ParsedMessage ParseForceFieldUpdateMessage(const std::vector<std::string>& parts);
+    static ParsedMessage ParsePlayerSnapshotMessage(const std::vector<std::string>& parts);
+    static ParsedMessage ParsePlayerInputMessage(const std::vector<std::string>& parts);
+    
+    // Session slots - one character on the wire, '-' when the slot isn't known yet
+    static char EncodeSlot(int slot);
+    static int DecodeSlot(const std::string& field);
     
     // Message formatting functions
+    // The connection message is the handshake: it is the only one carrying a Steam ID,
+    // and when sent by the host it also carries the slot assigned to that player and the
+    // host's tick rate, which clients adopt for the session.
+    // Every other player message refers to players by slot.
     static std::string FormatConnectionMessage(const std::string& steamID, 
                                              const std::string& steamName, 
                                              const sf::Color& color, 
                                              bool isReady, 
-                                             bool isHost);
-    static std::string FormatMovementMessage(const std::string& steamID, 
+                                             bool isHost,
+                                             int slot = PLAYER_INVALID_INDEX,
+                                             int tickRate = 0);
+    static std::string FormatMovementMessage(int playerSlot, 
                                            const sf::Vector2f& position);
-    static std::string FormatBulletMessage(const std::string& shooterID, 
+    // viewTime is the host time the shooter's screen was showing, used for lag compensation
+    static std::string FormatBulletMessage(int shooterSlot, 
                                          const sf::Vector2f& position, 
                                          const sf::Vector2f& direction, 
-                                         float velocity);
-    static std::string FormatPlayerDeathMessage(const std::string& playerID, 
-                                              const std::string& killerID);
-    static std::string FormatPlayerRespawnMessage(const std::string& playerID, 
+                                         float velocity,
+                                         uint64_t viewTime = 0);
+    static std::string FormatPlayerDeathMessage(int playerSlot, 
+                                              int killerSlot);
+    static std::string FormatPlayerRespawnMessage(int playerSlot, 
                                                 const sf::Vector2f& position);
-    static std::string FormatPlayerDamageMessage(const std::string& playerID, 
+    static std::string FormatPlayerDamageMessage(int playerSlot, 
                                                int damage, 
                                                int enemyId);
-    static std::string FormatKillMessage(const std::string& killerID, int enemyId);
-    static std::string FormatForceFieldZapMessage(const std::string& playerID, int enemyId, float damage);
+    static std::string FormatKillMessage(int killerSlot, int enemyId);
+    static std::string FormatForceFieldZapMessage(int playerSlot, int enemyId, float damage);
     static std::string FormatForceFieldUpdateMessage(
-        const std::string& playerID,
+        int playerSlot,
         float radius,
         float damage,
         float cooldown,
@@ -55,6 +71,16 @@ public:
         int fieldType,
         int powerLevel,
         bool chainEnabled);
+    // Host -> clients: every player's state in one message, one '|' field per player
+    static std::string FormatPlayerSnapshotMessage(const std::vector<PlayerSnapshotEntry>& entries);
+    // Client -> host: consecutive movement commands starting at firstSequence, one hex digit each.
+    // basePosition is where the client stood before the first of them. Speed isn't sent, the
+    // host moves the player with its own; tickRate is the rate the commands were recorded at,
+    // so the host can drop batches that don't match its tick length.
+    static std::string FormatPlayerInputMessage(uint32_t firstSequence,
+                                              const sf::Vector2f& basePosition,
+                                              const std::vector<uint8_t>& inputs,
+                                              int tickRate);
 };
 
 #endif // PLAYER_MESSAGE_HANDLER_H
\ No newline at end of file
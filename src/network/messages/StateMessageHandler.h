@@ -19,7 +19,7 @@ public:
     static ParsedMessage ParseWaveStartMessage(const std::vector<std::string>& parts);
     
     // Message formatting functions
-    static std::string FormatReadyStatusMessage(const std::string& steamID, bool isReady);
+    static std::string FormatReadyStatusMessage(int playerSlot, bool isReady);
     static std::string FormatStartGameMessage(const std::string& hostID);
     static std::string FormatWaveStartMessage(int waveNumber, int enemyCount);
 };
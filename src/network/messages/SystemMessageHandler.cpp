@@ -1,8 +1,6 @@
 #include "SystemMessageHandler.h"
 #include "MessageHandler.h"
-#include "../Client.h"
-#include "../Host.h"
-#include "../../core/Game.h"
+#include "../../core/Logger.h"
 #include <sstream>
 #include <iostream>
 #include <chrono>
@@ -10,118 +8,6 @@
 
 // Constants
 
-void SystemMessageHandler::Initialize() {
-    // Register chunking handlers
-    MessageHandler::RegisterMessageType("CHUNK_START", ParseChunkStartMessage,
-        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-            // Client just stores the start info
-        },
-        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-            // Host just stores the start info
-        });
-  
-    MessageHandler::RegisterMessageType("CHUNK_PART", ParseChunkPartMessage,
-        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-            // Client just processes the chunk part
-        },
-        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-            // Host just processes the chunk part
-        });
-  
-    MessageHandler::RegisterMessageType("CHUNK_END", ParseChunkEndMessage,
-        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-            // Client should process the reconstructed message
-        },
-        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-            // Host should process the reconstructed message
-        });
-        
-    MessageHandler::RegisterMessageType("T", 
-        ParseChatMessage,
-        [](Game& game, ClientNetwork& client, const ParsedMessage& parsed) {
-            client.ProcessChatMessage(game, client, parsed);
-        },
-        [](Game& game, HostNetwork& host, const ParsedMessage& parsed, CSteamID sender) {
-            host.ProcessChatMessageParsed(game, host, parsed, sender);
-        });
-    
-    // Setup chunking handlers
-    MessageHandler::messageParsers["CHUNK_START"] = [](const std::vector<std::string>& parts) {
-        if (parts.size() >= 4) {
-            std::string messageType = parts[1];
-            int totalChunks = std::stoi(parts[2]);
-            std::string chunkId = parts[3];
-            
-            std::cout << "[MessageHandler] Starting new chunked message " << chunkId 
-                      << " of type " << messageType << " with " << totalChunks << " chunks\n";
-            
-            MessageHandler::chunkTypes[chunkId] = messageType;
-            MessageHandler::chunkCounts[chunkId] = totalChunks;
-            MessageHandler::chunkStorage[chunkId].resize(totalChunks);
-        }
-        return ParsedMessage{MessageType::ChunkStart}; // Create a specific type for chunks
-    };
-    
-    MessageHandler::messageParsers["CHUNK_PART"] = [](const std::vector<std::string>& parts) {
-        ParsedMessage result{MessageType::ChunkPart};
-        if (parts.size() >= 4) {
-            std::string chunkId = parts[1];
-            int chunkNum = std::stoi(parts[2]);
-            std::string chunkData = parts[3];
-            
-            std::cout << "[MessageHandler] Processing chunk part " << chunkNum 
-                      << " for message " << chunkId << "\n";
-            
-            AddChunk(chunkId, chunkNum, chunkData);
-        }
-        return result;
-    };
-    
-    MessageHandler::messageParsers["CHUNK_END"] = [](const std::vector<std::string>& parts) {
-        if (parts.size() >= 2) {
-            std::string chunkId = parts[1];
-            std::cout << "[MessageHandler] Processing CHUNK_END for " << chunkId << "\n";
-            
-            if (MessageHandler::chunkStorage.find(chunkId) != MessageHandler::chunkStorage.end() && 
-                MessageHandler::chunkCounts.find(chunkId) != MessageHandler::chunkCounts.end()) {
-                
-                int expectedChunks = MessageHandler::chunkCounts[chunkId];
-                if (IsChunkComplete(chunkId, expectedChunks)) {
-                    // Get message type
-                    std::string messageType = MessageHandler::chunkTypes[chunkId];
-                    
-                    // Reconstruct the full message
-                    std::string fullMessage = GetReconstructedMessage(chunkId);
-                    
-                    // Parse the reconstructed message
-                    std::vector<std::string> messageParts = MessageHandler::SplitString(fullMessage, '|');
-                    auto parserIt = MessageHandler::messageParsers.find(messageType);
-                    if (parserIt != MessageHandler::messageParsers.end()) {
-                        // Clear chunks to free memory
-                        ClearChunks(chunkId);
-                        
-                        // Parse the reconstructed message and return the result
-                        return parserIt->second(messageParts);
-                    }
-                    else {
-                        std::cout << "[MessageHandler] No parser found for message type: " << messageType << "\n";
-                        ClearChunks(chunkId);
-                    }
-                }
-                else {
-                    std::cout << "[MessageHandler] Chunks incomplete for " << chunkId << ". Expected: " 
-                              << expectedChunks << ", Have: " << MessageHandler::chunkStorage[chunkId].size() << "\n";
-                }
-            }
-            else {
-                std::cout << "[MessageHandler] Chunk storage or counts not found for " << chunkId << "\n";
-            }
-        }
-        
-        return ParsedMessage{MessageType::ChunkEnd};
-    };
-}
-
 // Chat message parsing
 ParsedMessage SystemMessageHandler::ParseChatMessage(const std::vector<std::string>& parts) {
     ParsedMessage parsed;
@@ -215,15 +101,14 @@ void SystemMessageHandler::AddChunk(const std::string& chunkId, int chunkNum, co
         }
         
         MessageHandler::chunkStorage[chunkId].resize(expectedCount);
-        std::cout << "[MessageHandler] Created storage for chunk ID " << chunkId 
-                  << " with " << expectedCount << " slots\n";
+        LOG_DEBUG("MessageHandler", "Created storage for chunk ID {} with {} slots", chunkId, expectedCount);
     }
     
     // Ensure the vector is large enough
     if (static_cast<size_t>(chunkNum) >= MessageHandler::chunkStorage[chunkId].size()) {
         size_t newSize = chunkNum + 1;
-        std::cout << "[MessageHandler] Resizing chunk storage for " << chunkId 
-                  << " from " << MessageHandler::chunkStorage[chunkId].size() << " to " << newSize << "\n";
+        LOG_DEBUG("MessageHandler", "Resizing chunk storage for {} from {} to {}",
+                  chunkId, MessageHandler::chunkStorage[chunkId].size(), newSize);
         MessageHandler::chunkStorage[chunkId].resize(newSize);
         
         // Update expected count if necessary
@@ -235,9 +120,7 @@ void SystemMessageHandler::AddChunk(const std::string& chunkId, int chunkNum, co
     // Store the chunk
     MessageHandler::chunkStorage[chunkId][chunkNum] = chunkData;
     
-    // Debug output
-    std::cout << "[MessageHandler] Added chunk " << chunkNum << " of " << MessageHandler::chunkCounts[chunkId] 
-              << " for ID " << chunkId << "\n";
+    LOG_DEBUG("MessageHandler", "Added chunk {} of {} for ID {}", chunkNum, MessageHandler::chunkCounts[chunkId], chunkId);
 }
 
 bool SystemMessageHandler::IsChunkComplete(const std::string& chunkId, int expectedChunks) {
@@ -9,14 +9,18 @@ PlayerRenderer::PlayerRenderer(PlayerManager* manager)
 PlayerRenderer::~PlayerRenderer() {
 }
 
-void PlayerRenderer::Render(sf::RenderWindow& window) {
+void PlayerRenderer::Render(RenderSnapshot& frame, float alpha) {
     auto& players = playerManager->GetPlayers();
     for (auto& pair : players) {
-        window.draw(pair.second.player.GetShape());
-        window.draw(pair.second.nameText);
-    }
-    auto& bullets = playerManager->GetAllBullets();
-    for (auto& bullet : bullets) {
-        window.draw(bullet.GetShape());
+        // Offset from the sim position to the interpolated one
+        const Player& player = pair.second.player;
+        sf::Transform offset;
+        offset.translate(player.GetInterpolatedPosition(alpha) - player.GetPosition());
+        
+        frame.Draw(player.GetShape(), offset);
+        frame.Draw(pair.second.nameText, offset);
     }
+    
+    // Bullet quads are generated here from the pooled positions
+    playerManager->GetAllBullets().Render(frame, alpha);
 }
\ No newline at end of file
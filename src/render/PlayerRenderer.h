@@ -5,6 +5,7 @@
 #include <iostream>
 #include "../entities/player/PlayerManager.h"  
 #include "../utils/SteamHelpers.h"
+#include "RenderSnapshot.h"
 
 class PlayerManager; // Forward declaration
 
@@ -13,8 +14,9 @@ public:
     explicit PlayerRenderer(PlayerManager* manager);
     ~PlayerRenderer();
 
-    // Draw all players onto the provided window.
-    void Render(sf::RenderWindow& window);
+    // Record all players into the frame, blended alpha of the way
+    // between the previous and current simulation tick.
+    void Render(RenderSnapshot& frame, float alpha = 1.0f);
 
 private:
     PlayerManager* playerManager;
@@ -0,0 +1,384 @@
+#include "RenderSnapshot.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_set>
+
+namespace {
+    // Primitives that can be concatenated without changing what is drawn
+    bool IsListPrimitive(sf::PrimitiveType type) {
+        return type == sf::Points || type == sf::Lines || type == sf::Triangles || type == sf::Quads;
+    }
+
+    bool SameTransform(const sf::Transform& a, const sf::Transform& b) {
+        return std::equal(a.getMatrix(), a.getMatrix() + 16, b.getMatrix());
+    }
+
+    bool SameStates(const sf::RenderStates& a, const sf::RenderStates& b) {
+        return a.texture == b.texture && a.shader == b.shader &&
+               a.blendMode == b.blendMode && SameTransform(a.transform, b.transform);
+    }
+
+    sf::Vector2f EdgeNormal(const sf::Vector2f& from, const sf::Vector2f& to) {
+        sf::Vector2f normal(from.y - to.y, to.x - from.x);
+        float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+        if (length != 0.f) normal /= length;
+        return normal;
+    }
+
+    // Glyphs a font page has been asked for, as seen from the recording thread. Asking for
+    // a new one means the font has just drawn it into its texture (growing it if needed),
+    // so a snapshot holding an older copy of that texture has to take a new one. Glyphs
+    // never move when the texture grows, so a newer copy is good for older layouts too.
+    struct FontPage {
+        const sf::Font* font;
+        unsigned int characterSize;
+        std::unordered_set<uint64_t> glyphs;
+        uint64_t generation = 0;
+    };
+    std::vector<FontPage> fontPages;   // Shared by every snapshot, recording thread only
+
+    FontPage& GetFontPage(const sf::Font& font, unsigned int characterSize) {
+        for (FontPage& page : fontPages) {
+            if (page.font == &font && page.characterSize == characterSize) return page;
+        }
+        fontPages.push_back(FontPage{&font, characterSize, {}, 0});
+        return fontPages.back();
+    }
+
+    const sf::Glyph& LoadGlyph(FontPage& page, sf::Uint32 codePoint, bool bold, float outlineThickness = 0.f) {
+        uint32_t thicknessBits;
+        std::memcpy(&thicknessBits, &outlineThickness, sizeof(thicknessBits));
+        uint64_t key = (static_cast<uint64_t>(thicknessBits) << 22) | (static_cast<uint64_t>(bold) << 21) | (codePoint & 0x1FFFFF);
+        if (page.glyphs.insert(key).second) page.generation++;
+        return page.font->getGlyph(codePoint, page.characterSize, bold, outlineThickness);
+    }
+
+    // The rest is sf::Text's own layout (SFML 2.5), in the text's local space
+
+    void AddLine(std::vector<sf::Vertex>& out, float lineLength, float lineTop, const sf::Color& color,
+                 float offset, float thickness, float outlineThickness = 0.f) {
+        float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+        float bottom = top + std::floor(thickness + 0.5f);
+        sf::Vector2f texCoords(1.f, 1.f);   // The page's reserved white pixels
+
+        out.push_back(sf::Vertex(sf::Vector2f(-outlineThickness, top - outlineThickness), color, texCoords));
+        out.push_back(sf::Vertex(sf::Vector2f(lineLength + outlineThickness, top - outlineThickness), color, texCoords));
+        out.push_back(sf::Vertex(sf::Vector2f(-outlineThickness, bottom + outlineThickness), color, texCoords));
+        out.push_back(sf::Vertex(sf::Vector2f(-outlineThickness, bottom + outlineThickness), color, texCoords));
+        out.push_back(sf::Vertex(sf::Vector2f(lineLength + outlineThickness, top - outlineThickness), color, texCoords));
+        out.push_back(sf::Vertex(sf::Vector2f(lineLength + outlineThickness, bottom + outlineThickness), color, texCoords));
+    }
+
+    void AddGlyphQuad(std::vector<sf::Vertex>& out, sf::Vector2f position, const sf::Color& color,
+                      const sf::Glyph& glyph, float italicShear, float outlineThickness = 0.f) {
+        float padding = 1.f;
+
+        float left = glyph.bounds.left - padding;
+        float top = glyph.bounds.top - padding;
+        float right = glyph.bounds.left + glyph.bounds.width + padding;
+        float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+        float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+        float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+        float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+        float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+        float x = position.x - outlineThickness;
+        float y = position.y - outlineThickness;
+        out.push_back(sf::Vertex(sf::Vector2f(x + left - italicShear * top, y + top), color, sf::Vector2f(u1, v1)));
+        out.push_back(sf::Vertex(sf::Vector2f(x + right - italicShear * top, y + top), color, sf::Vector2f(u2, v1)));
+        out.push_back(sf::Vertex(sf::Vector2f(x + left - italicShear * bottom, y + bottom), color, sf::Vector2f(u1, v2)));
+        out.push_back(sf::Vertex(sf::Vector2f(x + left - italicShear * bottom, y + bottom), color, sf::Vector2f(u1, v2)));
+        out.push_back(sf::Vertex(sf::Vector2f(x + right - italicShear * top, y + top), color, sf::Vector2f(u2, v1)));
+        out.push_back(sf::Vertex(sf::Vector2f(x + right - italicShear * bottom, y + bottom), color, sf::Vector2f(u2, v2)));
+    }
+
+    void LayoutText(const sf::Text& text, FontPage& page, std::vector<sf::Vertex>& fill, std::vector<sf::Vertex>& outline) {
+        fill.clear();
+        outline.clear();
+
+        const sf::Font& font = *page.font;
+        unsigned int characterSize = page.characterSize;
+        sf::Uint32 style = text.getStyle();
+        bool bold = (style & sf::Text::Bold) != 0;
+        bool underlined = (style & sf::Text::Underlined) != 0;
+        bool strikeThrough = (style & sf::Text::StrikeThrough) != 0;
+        float italicShear = (style & sf::Text::Italic) ? 0.209f : 0.f;   // 12 degrees
+        float outlineThickness = text.getOutlineThickness();
+        sf::Color fillColor = text.getFillColor();
+        sf::Color outlineColor = text.getOutlineColor();
+
+        float underlineOffset = font.getUnderlinePosition(characterSize);
+        float underlineThickness = font.getUnderlineThickness(characterSize);
+        sf::FloatRect xBounds = LoadGlyph(page, L'x', bold).bounds;
+        float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+
+        float whitespaceWidth = LoadGlyph(page, L' ', bold).advance;
+        float letterSpacing = (whitespaceWidth / 3.f) * (text.getLetterSpacing() - 1.f);
+        whitespaceWidth += letterSpacing;
+        float lineSpacing = font.getLineSpacing(characterSize) * text.getLineSpacing();
+
+        auto addLines = [&](float x, float y) {
+            if (underlined) {
+                AddLine(fill, x, y, fillColor, underlineOffset, underlineThickness);
+                if (outlineThickness != 0.f) {
+                    AddLine(outline, x, y, outlineColor, underlineOffset, underlineThickness, outlineThickness);
+                }
+            }
+            if (strikeThrough) {
+                AddLine(fill, x, y, fillColor, strikeThroughOffset, underlineThickness);
+                if (outlineThickness != 0.f) {
+                    AddLine(outline, x, y, outlineColor, strikeThroughOffset, underlineThickness, outlineThickness);
+                }
+            }
+        };
+
+        const sf::String& string = text.getString();
+        float x = 0.f;
+        float y = static_cast<float>(characterSize);
+        sf::Uint32 previous = 0;
+        for (std::size_t i = 0; i < string.getSize(); i++) {
+            sf::Uint32 current = string[i];
+            if (current == L'\r') continue;
+
+            x += font.getKerning(previous, current, characterSize);
+            if (current == L'\n' && previous != L'\n') addLines(x, y);
+            previous = current;
+
+            if (current == L' ' || current == L'\n' || current == L'\t') {
+                switch (current) {
+                    case L' ':  x += whitespaceWidth; break;
+                    case L'\t': x += whitespaceWidth * 4; break;
+                    case L'\n': y += lineSpacing; x = 0.f; break;
+                }
+                continue;
+            }
+
+            if (outlineThickness != 0.f) {
+                const sf::Glyph& glyph = LoadGlyph(page, current, bold, outlineThickness);
+                AddGlyphQuad(outline, sf::Vector2f(x, y), outlineColor, glyph, italicShear, outlineThickness);
+            }
+
+            const sf::Glyph& glyph = LoadGlyph(page, current, bold);
+            AddGlyphQuad(fill, sf::Vector2f(x, y), fillColor, glyph, italicShear);
+            x += glyph.advance + letterSpacing;
+        }
+
+        if (x > 0.f) addLines(x, y);
+    }
+}
+
+void RenderSnapshot::Reset(const sf::View& defaultView) {
+    clearColor = sf::Color::Black;
+    views.clear();
+    views.push_back(defaultView);
+    currentView = 0;
+    commands.clear();
+    vertices.clear();
+    spriteCount = 0;
+}
+
+void RenderSnapshot::SetView(const sf::View& view) {
+    views.push_back(view);
+    currentView = views.size() - 1;
+}
+
+RenderSnapshot::Command& RenderSnapshot::VertexRun(sf::PrimitiveType type, const sf::RenderStates& states) {
+    if (!commands.empty()) {
+        Command& last = commands.back();
+        if (last.type == CommandType::Vertices && last.view == currentView && last.primitive == type &&
+            IsListPrimitive(type) && SameStates(last.states, states)) {
+            return last;
+        }
+    }
+
+    commands.push_back(Command{CommandType::Vertices, currentView, type, states, vertices.size(), 0});
+    return commands.back();
+}
+
+void RenderSnapshot::Draw(const sf::Shape& shape, const sf::RenderStates& states) {
+    size_t pointCount = shape.getPointCount();
+    if (pointCount < 3) return;
+
+    // Flatten to world space so every untextured shape can share one run
+    sf::Transform transform = states.transform * shape.getTransform();
+    points.resize(pointCount);
+    for (size_t i = 0; i < pointCount; i++) {
+        points[i] = shape.getPoint(i);
+    }
+
+    if (shape.getFillColor().a > 0) {
+        sf::RenderStates fillStates = states;
+        fillStates.transform = sf::Transform::Identity;
+        fillStates.texture = shape.getTexture();
+
+        // Texture coordinates follow sf::Shape: the texture rect is stretched over the bounds
+        sf::FloatRect bounds = shape.getLocalBounds();
+        sf::IntRect textureRect = shape.getTextureRect();
+        auto texCoords = [&](const sf::Vector2f& point) {
+            float x = bounds.width > 0.f ? (point.x - bounds.left) / bounds.width : 0.f;
+            float y = bounds.height > 0.f ? (point.y - bounds.top) / bounds.height : 0.f;
+            return sf::Vector2f(textureRect.left + textureRect.width * x, textureRect.top + textureRect.height * y);
+        };
+
+        Command& run = VertexRun(sf::Triangles, fillStates);
+        sf::Color color = shape.getFillColor();
+        sf::Vertex origin(transform.transformPoint(points[0]), color, texCoords(points[0]));
+        for (size_t i = 1; i + 1 < pointCount; i++) {
+            vertices.push_back(origin);
+            vertices.push_back(sf::Vertex(transform.transformPoint(points[i]), color, texCoords(points[i])));
+            vertices.push_back(sf::Vertex(transform.transformPoint(points[i + 1]), color, texCoords(points[i + 1])));
+        }
+        run.count = vertices.size() - run.first;
+    }
+
+    if (shape.getOutlineThickness() != 0.f && shape.getOutlineColor().a > 0) {
+        sf::RenderStates outlineStates = states;
+        outlineStates.transform = sf::Transform::Identity;
+        outlineStates.texture = nullptr;
+
+        Command& run = VertexRun(sf::Triangles, outlineStates);
+        AppendOutline(shape, transform);
+        run.count = vertices.size() - run.first;
+    }
+}
+
+void RenderSnapshot::AppendOutline(const sf::Shape& shape, const sf::Transform& transform) {
+    // Same construction as sf::Shape: each corner is pushed out along the mean of its
+    // two edge normals, scaled so the band has the requested thickness
+    size_t pointCount = points.size();
+    sf::FloatRect bounds = shape.getLocalBounds();
+    sf::Vector2f center(bounds.left + bounds.width / 2.f, bounds.top + bounds.height / 2.f);
+    float thickness = shape.getOutlineThickness();
+    sf::Color color = shape.getOutlineColor();
+
+    auto outerPoint = [&](size_t i) {
+        const sf::Vector2f& previous = points[(i + pointCount - 1) % pointCount];
+        const sf::Vector2f& current = points[i];
+        const sf::Vector2f& next = points[(i + 1) % pointCount];
+
+        sf::Vector2f n1 = EdgeNormal(previous, current);
+        sf::Vector2f n2 = EdgeNormal(current, next);
+        sf::Vector2f toCenter = center - current;
+        if (n1.x * toCenter.x + n1.y * toCenter.y > 0.f) n1 = -n1;
+        if (n2.x * toCenter.x + n2.y * toCenter.y > 0.f) n2 = -n2;
+
+        float factor = 1.f + (n1.x * n2.x + n1.y * n2.y);
+        sf::Vector2f normal = factor != 0.f ? (n1 + n2) / factor : n1;
+        return current + normal * thickness;
+    };
+
+    sf::Vector2f firstInner = transform.transformPoint(points[0]);
+    sf::Vector2f firstOuter = transform.transformPoint(outerPoint(0));
+    sf::Vector2f inner = firstInner;
+    sf::Vector2f outer = firstOuter;
+    for (size_t i = 0; i < pointCount; i++) {
+        bool last = i + 1 == pointCount;
+        sf::Vector2f nextInner = last ? firstInner : transform.transformPoint(points[i + 1]);
+        sf::Vector2f nextOuter = last ? firstOuter : transform.transformPoint(outerPoint(i + 1));
+
+        vertices.push_back(sf::Vertex(inner, color));
+        vertices.push_back(sf::Vertex(outer, color));
+        vertices.push_back(sf::Vertex(nextInner, color));
+        vertices.push_back(sf::Vertex(nextInner, color));
+        vertices.push_back(sf::Vertex(outer, color));
+        vertices.push_back(sf::Vertex(nextOuter, color));
+
+        inner = nextInner;
+        outer = nextOuter;
+    }
+}
+
+void RenderSnapshot::Draw(const sf::VertexArray& vertexArray, const sf::RenderStates& states) {
+    if (vertexArray.getVertexCount() == 0) return;
+    Draw(&vertexArray[0], vertexArray.getVertexCount(), vertexArray.getPrimitiveType(), states);
+}
+
+void RenderSnapshot::Draw(const sf::Vertex* vertexData, std::size_t vertexCount, sf::PrimitiveType type,
+                          const sf::RenderStates& states) {
+    if (vertexCount == 0) return;
+    Command& run = VertexRun(type, states);
+    vertices.insert(vertices.end(), vertexData, vertexData + vertexCount);
+    run.count = vertices.size() - run.first;
+}
+
+void RenderSnapshot::Draw(const sf::Text& text, const sf::RenderStates& states) {
+    const sf::Font* font = text.getFont();
+    if (!font || text.getString().isEmpty()) return;
+
+    unsigned int characterSize = text.getCharacterSize();
+    FontPage& page = GetFontPage(*font, characterSize);
+    LayoutText(text, page, textFill, textOutline);
+
+    // Taken after the layout, so the copy has every glyph the layout just loaded
+    sf::RenderStates textStates = states;
+    textStates.transform = sf::Transform::Identity;
+    textStates.texture = &GetGlyphTexture(*font, characterSize, page.generation);
+
+    // Flattened like shapes, so consecutive text in one font and size shares a run
+    sf::Transform transform = states.transform * text.getTransform();
+    Command& run = VertexRun(sf::Triangles, textStates);
+    for (const std::vector<sf::Vertex>* layer : {&textOutline, &textFill}) {
+        for (sf::Vertex vertex : *layer) {
+            vertex.position = transform.transformPoint(vertex.position);
+            vertices.push_back(vertex);
+        }
+    }
+    run.count = vertices.size() - run.first;
+}
+
+const sf::Texture& RenderSnapshot::GetGlyphTexture(const sf::Font& font, unsigned int characterSize, uint64_t generation) {
+    GlyphTexture* entry = nullptr;
+    for (const std::unique_ptr<GlyphTexture>& glyphTexture : glyphTextures) {
+        if (glyphTexture->font == &font && glyphTexture->characterSize == characterSize) {
+            entry = glyphTexture.get();
+            break;
+        }
+    }
+    if (!entry) {
+        glyphTextures.push_back(std::make_unique<GlyphTexture>());
+        entry = glyphTextures.back().get();
+        entry->font = &font;
+        entry->characterSize = characterSize;
+        entry->generation = 0;   // Fonts start counting at 1, so this always copies
+    }
+
+    // Assigned in place, so commands recorded against it earlier this frame still point at it
+    if (entry->generation != generation) {
+        entry->texture = font.getTexture(characterSize);
+        entry->generation = generation;
+    }
+    return entry->texture;
+}
+
+void RenderSnapshot::Draw(const sf::Sprite& sprite, const sf::RenderStates& states) {
+    if (spriteCount == sprites.size()) {
+        sprites.push_back(sprite);
+    } else {
+        sprites[spriteCount] = sprite;
+    }
+    commands.push_back(Command{CommandType::Sprite, currentView, sf::Triangles, states, spriteCount, 0});
+    spriteCount++;
+}
+
+void RenderSnapshot::Replay(sf::RenderTarget& target) const {
+    target.clear(clearColor);
+
+    size_t boundView = views.size();
+    for (const Command& command : commands) {
+        if (command.view != boundView) {
+            target.setView(views[command.view]);
+            boundView = command.view;
+        }
+
+        switch (command.type) {
+            case CommandType::Vertices:
+                target.draw(&vertices[command.first], command.count, command.primitive, command.states);
+                break;
+            case CommandType::Sprite:
+                target.draw(sprites[command.first], command.states);
+                break;
+        }
+    }
+}
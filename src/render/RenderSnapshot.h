@@ -0,0 +1,88 @@
+#ifndef RENDER_SNAPSHOT_H
+#define RENDER_SNAPSHOT_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// One frame of drawing, recorded by the simulation thread and replayed by the render thread.
+//
+// Everything is copied in, so a published snapshot stays valid however the game changes
+// afterwards. Shapes are flattened to world-space triangles and merged with the previous
+// draw when view and render states match, so a screen full of enemies replays as a few
+// large draw calls. Sprites are kept as copies; their textures are owned by Game, never
+// change after loading and outlive every snapshot.
+//
+// Text is laid out into textured triangles while recording, against the snapshot's own
+// copy of the font's glyph page. sf::Font loads glyphs lazily and grows its page texture
+// when it does, so the font must only ever be touched by the recording thread; the render
+// thread only sees the copy, which is refreshed when a frame needs a glyph it lacks.
+class RenderSnapshot {
+public:
+    // Starts a new frame; storage from earlier frames is kept and reused
+    void Reset(const sf::View& defaultView);
+
+    void Clear(const sf::Color& color) { clearColor = color; }
+    void SetView(const sf::View& view);
+    const sf::View& GetView() const { return views[currentView]; }
+
+    void Draw(const sf::Shape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+    void Draw(const sf::VertexArray& vertexArray, const sf::RenderStates& states = sf::RenderStates::Default);
+    void Draw(const sf::Vertex* vertexData, std::size_t vertexCount, sf::PrimitiveType type,
+              const sf::RenderStates& states = sf::RenderStates::Default);
+    void Draw(const sf::Text& text, const sf::RenderStates& states = sf::RenderStates::Default);
+    void Draw(const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    // Issues the recorded frame to the target; does not call display()
+    void Replay(sf::RenderTarget& target) const;
+
+    size_t GetDrawCallCount() const { return commands.size(); }
+    size_t GetVertexCount() const { return vertices.size(); }
+
+private:
+    enum class CommandType { Vertices, Sprite };
+
+    struct Command {
+        CommandType type;
+        size_t view;
+        sf::PrimitiveType primitive;
+        sf::RenderStates states;
+        size_t first;   // First vertex, or the index into sprites
+        size_t count;   // Vertex count (unused for sprites)
+    };
+
+    // This snapshot's copy of one font page, as of the font's glyph generation it was taken at
+    struct GlyphTexture {
+        const sf::Font* font;
+        unsigned int characterSize;
+        uint64_t generation;
+        sf::Texture texture;
+    };
+
+    // Returns a vertex run to append to, extending the last one when it can be merged
+    Command& VertexRun(sf::PrimitiveType type, const sf::RenderStates& states);
+    void AppendOutline(const sf::Shape& shape, const sf::Transform& transform);
+    const sf::Texture& GetGlyphTexture(const sf::Font& font, unsigned int characterSize, uint64_t generation);
+
+    sf::Color clearColor = sf::Color::Black;
+    std::vector<sf::View> views;
+    size_t currentView = 0;
+
+    std::vector<Command> commands;
+    std::vector<sf::Vertex> vertices;
+
+    // Kept across frames; held by pointer so commands can point at the textures
+    std::vector<std::unique_ptr<GlyphTexture>> glyphTextures;
+
+    // Grown to the high-water mark and assigned into
+    std::vector<sf::Sprite> sprites;
+    size_t spriteCount = 0;
+
+    std::vector<sf::Vector2f> points;   // Scratch for shape tessellation
+    std::vector<sf::Vertex> textFill;   // Scratch for text layout, in the text's local space
+    std::vector<sf::Vertex> textOutline;
+};
+
+#endif // RENDER_SNAPSHOT_H
@@ -0,0 +1,118 @@
+#include "RenderThread.h"
+#include "../core/Profiler.h"
+#include "../core/TraceRecorder.h"
+#include <chrono>
+#include <iostream>
+
+RenderThread::RenderThread(sf::RenderWindow& window)
+    : window(window)
+{
+}
+
+RenderThread::~RenderThread() {
+    Stop();
+}
+
+void RenderThread::Start() {
+    if (!RENDER_THREAD_ENABLED || IsRunning()) return;
+
+    // A context can only be current on one thread at a time
+    window.setActive(false);
+    stopping = false;
+    thread = std::thread(&RenderThread::Loop, this);
+    std::cout << "[RENDER] Render thread started\n";
+}
+
+void RenderThread::Stop() {
+    if (!IsRunning()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    frameReady.notify_one();
+    frameTaken.notify_all();
+    thread.join();
+
+    window.setActive(true);
+    std::cout << "[RENDER] Render thread stopped\n";
+}
+
+void RenderThread::SetVerticalSync(bool enabled) {
+    if (IsRunning()) {
+        pendingVerticalSync.store(enabled ? 1 : 0);
+    } else {
+        window.setVerticalSyncEnabled(enabled);
+    }
+}
+
+RenderSnapshot& RenderThread::BeginFrame() {
+    RenderSnapshot& frame = frames.WriteBuffer();
+    frame.Reset(window.getDefaultView());
+    return frame;
+}
+
+void RenderThread::Publish() {
+    frames.Publish();
+
+    if (!IsRunning()) {
+        // No render thread: draw straight away, as the main loop used to
+        frames.Acquire();
+        frames.ReadBuffer().Replay(window);
+        window.display();
+        return;
+    }
+
+    // Taking the lock orders this against the render thread checking for a frame before sleeping
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+    }
+    frameReady.notify_one();
+}
+
+void RenderThread::WaitForPickup() {
+    lastPickupWait = 0.f;
+    if (!IsRunning()) return;
+
+    auto start = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(mutex);
+    frameTaken.wait_for(lock, std::chrono::milliseconds(RENDER_PICKUP_TIMEOUT_MS),
+                        [this] { return stopping || !frames.HasFresh(); });
+    lastPickupWait = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+}
+
+void RenderThread::Loop() {
+    TraceRecorder::Get().SetThreadName("Render");
+    window.setActive(true);
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            frameReady.wait(lock, [this] { return stopping || frames.HasFresh(); });
+            if (stopping) break;
+            frames.Acquire();
+        }
+        frameTaken.notify_all();
+
+        int verticalSync = pendingVerticalSync.exchange(-1);
+        if (verticalSync >= 0) {
+            window.setVerticalSyncEnabled(verticalSync == 1);
+        }
+
+        // display() is where vsync blocks, off the simulation thread
+        {
+            PROFILE_SCOPE("Replay");
+            auto start = std::chrono::steady_clock::now();
+            frames.ReadBuffer().Replay(window);
+            lastReplayTime.store(std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count(),
+                                 std::memory_order_relaxed);
+        }
+        {
+            PROFILE_SCOPE("Display");
+            window.display();
+        }
+    }
+
+    lastReplayTime.store(0.f, std::memory_order_relaxed);
+    window.setActive(false);
+}
@@ -0,0 +1,63 @@
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "RenderSnapshot.h"
+#include "../utils/TripleBuffer.h"
+#include "../utils/config/Config.h"
+
+// Owns the window's GL context on a thread of its own and draws published snapshots.
+//
+// The simulation records each frame into BeginFrame() and hands it over with Publish().
+// Frames travel through a triple buffer, so recording never waits on drawing; if the
+// render thread falls behind it simply skips to the newest frame. Window events must
+// still be polled on the thread that created the window, which stays the main thread.
+class RenderThread {
+public:
+    explicit RenderThread(sf::RenderWindow& window);
+    ~RenderThread();
+
+    // Start hands the window's context to the render thread; Stop takes it back, and
+    // must be called before the window is closed or recreated
+    void Start();
+    void Stop();
+    bool IsRunning() const { return thread.joinable(); }
+
+    // Vsync has to be switched on the thread that owns the context, so while the render
+    // thread runs this is applied before its next frame
+    void SetVerticalSync(bool enabled);
+
+    // Snapshot to record the next frame into, reset to the window's default view
+    RenderSnapshot& BeginFrame();
+    void Publish();
+
+    // Blocks until the render thread has taken the last published frame. This keeps the
+    // simulation one frame ahead of drawing instead of racing ahead of the display.
+    void WaitForPickup();
+
+    // For judging frame cost without the waits: seconds the last WaitForPickup() blocked,
+    // and how long the render thread took to replay its last frame (0 when it isn't running)
+    float GetLastPickupWait() const { return lastPickupWait; }
+    float GetLastReplayTime() const { return lastReplayTime.load(std::memory_order_relaxed); }
+
+private:
+    void Loop();
+
+    sf::RenderWindow& window;
+    TripleBuffer<RenderSnapshot> frames;
+    std::thread thread;
+
+    std::mutex mutex;
+    std::condition_variable frameReady;
+    std::condition_variable frameTaken;
+    bool stopping = false;
+    std::atomic<int> pendingVerticalSync{-1};   // -1 = no change requested
+    float lastPickupWait = 0.f;
+    std::atomic<float> lastReplayTime{0.f};
+};
+
+#endif // RENDER_THREAD_H
@@ -1,7 +1,12 @@
 #include "PlayingState.h"
 #include "../core/Game.h"
+#include "../core/ParticleSystem.h"
+#include "../core/QualityGovernor.h"
+#include "../core/Profiler.h"
+#include "../core/TraceRecorder.h"
 #include "../utils/config/Config.h"
 #include "../entities/player/PlayerManager.h"
+#include "../entities/player/LightningTemplates.h"
 #include "../entities/enemies/EnemyManager.h"
 #include "../entities/enemies/Enemy.h"
 #include "../network/Host.h"
@@ -14,6 +19,7 @@
 #include "../network/messages/StateMessageHandler.h"
 #include "../network/messages/SystemMessageHandler.h"
 #include "PlayingStateUI.h"
+#include "../network/SessionContext.h"
 #include <steam/steam_api.h>
 #include <iostream>
 
@@ -37,6 +43,9 @@ PlayingState::PlayingState(Game* game)
     
     std::cout << "[DEBUG] PlayingState constructor start\n";
     
+    // Particles from a previous session shouldn't leak into this one
+    ParticleSystem::Get().Clear();
+    
     // Create a stylish grid with modern colors that match the UI theme
     grid = Grid(50.f, sf::Color(180, 180, 180, 100)); // Slightly transparent grid lines
     grid.setMajorLineInterval(5);
@@ -59,16 +68,15 @@ PlayingState::PlayingState(Game* game)
 
     // ===== PLAYER MANAGER SETUP =====
     // Setup Player Manager first
-    CSteamID myID = SteamUser()->GetSteamID();
-    std::string myIDStr = std::to_string(myID.ConvertToUint64());
+    const SessionContext& session = SessionContext::Get();
+    std::string myIDStr = session.GetLocalIDString();
     playerManager = std::make_unique<PlayerManager>(game, myIDStr);
     
-    std::string myName = SteamFriends()->GetPersonaName();
-    CSteamID hostIDSteam = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
+    std::string myName = SteamFriends() ? SteamFriends()->GetPersonaName() : "Player";
     
     RemotePlayer localPlayer;
     localPlayer.playerID = myIDStr;
-    localPlayer.isHost = (myID == hostIDSteam);
+    localPlayer.isHost = session.IsHost();
     localPlayer.player = Player(sf::Vector2f(0.f, 0.f), PLAYER_DEFAULT_COLOR);
     localPlayer.nameText.setFont(game->GetFont());
     localPlayer.nameText.setString(myName);
@@ -85,6 +93,10 @@ PlayingState::PlayingState(Game* game)
 
     // Initialize enemy manager with player manager reference
     enemyManager = std::make_unique<EnemyManager>(game, playerManager.get());
+    tick = std::make_unique<SimulationTick>(game, playerManager.get(), enemyManager.get());
+    
+    // Build the zap templates now, not on the first zap in the middle of a fight
+    LightningTemplates::Get();
     
     // Initialize the PlayingStateUI
     ui = std::make_unique<PlayingStateUI>(game, playerManager.get(), enemyManager.get());
@@ -97,7 +109,7 @@ PlayingState::PlayingState(Game* game)
 
     // ===== NETWORK SETUP =====
     // Create networking components last, so they can use the other managers
-    if (myID == hostIDSteam) {
+    if (session.IsHost()) {
         hostNetwork = std::make_unique<HostNetwork>(game, playerManager.get());
         game->GetNetworkManager().SetMessageHandler(
             [this](const std::string& msg, CSteamID sender) {
@@ -112,7 +124,9 @@ PlayingState::PlayingState(Game* game)
             myName,
             PLAYER_DEFAULT_COLOR,
             false,
-            true
+            true,
+            playerManager->GetLocalPlayerIndex(),
+            game->GetTickRate()
         );
         game->GetNetworkManager().BroadcastMessage(hostConnectMsg);
         std::cout << "[HOST] Sent host connection message in PlayingState: " << hostConnectMsg << "\n";
@@ -148,14 +162,18 @@ PlayingState::~PlayingState() {
     shop.reset(); // Then reset the unique_ptr
     hostNetwork.reset();
     clientNetwork.reset();
+    tick.reset();
     enemyManager.reset();
     playerRenderer.reset();
     playerManager.reset();
+    ParticleSystem::Get().Clear();
     
     std::cout << "[DEBUG] PlayingState destructor completed\n";
 }
 
 void PlayingState::Update(float dt) {
+    PROFILE_SCOPE("PlayingState::Update");
+    
     // Update UI with animations
     if (ui) {
         ui->Update(dt);
@@ -172,8 +190,11 @@ void PlayingState::Update(float dt) {
             }
         }
     } else {
-        // Update PlayerManager with the game instance (for InputManager access)
-        playerManager->Update(game);
+        // Update players; local input is sampled through Game as the SimulationContext
+        {
+            PROFILE_SCOPE("Players");
+            playerManager->Update(dt);
+        }
         if (clientNetwork) clientNetwork->Update();
         if (hostNetwork) hostNetwork->Update();
         
@@ -182,9 +203,7 @@ void PlayingState::Update(float dt) {
             enemyManager->Update(dt);
             
             // Check if we're the host for wave management
-            CSteamID myID = SteamUser()->GetSteamID();
-            CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
-            bool isHost = (myID == hostID);
+            bool isHost = SessionContext::Get().IsHost();
             
             // Handle wave logic
             if (isHost) {
@@ -192,6 +211,7 @@ void PlayingState::Update(float dt) {
                 if (enemyManager->IsWaveComplete() && !waitingForNextWave) {
                     waitingForNextWave = true;
                     waveTimer = WAVE_COOLDOWN_TIME; // 5 second delay between waves
+                    TraceRecorder::Get().Marker("Wave complete", "wave", enemyManager->GetCurrentWave());
                     
                     // Display wave complete message using UI
                     if (ui) {
@@ -232,53 +252,9 @@ void PlayingState::Update(float dt) {
                 ui->UpdateWaveInfo();
             }
             
-            // Update force fields for all players
-            if (playerLoaded && enemyManager && playerManager) {
-                for (auto& pair : playerManager->GetPlayers()) {
-                    RemotePlayer& rp = pair.second;
-                    if (rp.player.HasForceField() && !rp.player.IsDead()) {
-                        // Update force field
-                        rp.player.GetForceField()->Update(dt, *playerManager, *enemyManager);
-                    }
-                }
-            }
-
-            // Handle bullet-enemy collisions
-            if (playerLoaded && enemyManager && playerManager) {
-                std::vector<size_t> bulletsToRemove;
-                const auto& bullets = playerManager->GetAllBullets();
-                
-                for (size_t i = 0; i < bullets.size(); i++) {
-                    const Bullet& bullet = bullets[i];
-                    int hitEnemyId = -1;
-                    
-                    // Check if this bullet collides with any enemy
-                    if (enemyManager->CheckBulletCollision(bullet.GetPosition(), BULLET_RADIUS, hitEnemyId)) {
-                        // Enemy hit! Apply damage
-                        bool killed = enemyManager->InflictDamage(hitEnemyId, BULLET_DAMAGE);
-                        
-                        // Mark this bullet for removal
-                        bulletsToRemove.push_back(i);
-                        std::string shooterId = bullet.GetShooterID();
-
-                        // Use centralized kill tracking if enemy was killed
-                        if (killed) {
-                            playerManager->HandleKill(shooterId, hitEnemyId);
-                        }
-                        
-                        // Only modify money locally for local player's bullets on hit (not kill)
-                        if (shooterId == playerManager->GetLocalPlayer().playerID) {
-                            auto& localPlayer = playerManager->GetLocalPlayer();
-                            localPlayer.money += (killed ? 0 : 10); // Hits give 10, kills are handled by HandleKill
-                        }
-                    }
-                }
-                
-                // Remove bullets that hit enemies
-                if (!bulletsToRemove.empty()) {
-                    playerManager->RemoveBullets(bulletsToRemove);
-                }
-            }
+            // Force fields, particles and bullet hits, as the headless runner ticks them
+            tick->UpdateFields(dt);
+            tick->ResolveBulletHits();
         }
         
         // Update UI components
@@ -325,27 +301,22 @@ void PlayingState::Update(float dt) {
 
         if (!showEscapeMenu && playerLoaded && enemyManager && playerManager) {
             // When we're a client, make sure force field zaps are properly synced
-            bool isClient = false;
-            CSteamID myID = SteamUser()->GetSteamID();
-            CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
-            
-            if (myID != hostID) {
-                isClient = true;
-            }
+            bool isClient = SessionContext::Get().IsClient();
             
             // Only run this check on clients
             if (isClient) {
-                for (auto& pair : playerManager->GetPlayers()) {
-                    RemotePlayer& rp = pair.second;
+                auto& players = playerManager->GetPlayers();
+                for (auto it = players.begin(); it != players.end(); ++it) {
+                    RemotePlayer& rp = it->second;
                     if (rp.player.HasForceField() && !rp.player.IsDead() && rp.player.GetForceField()) {
                         // Make sure the force field has a zap callback set
                         if (!rp.player.GetForceField()->HasZapCallback()) {
                             // Recreate the zap callback if missing
-                            std::string playerID = pair.first;
-                            rp.player.GetForceField()->SetZapCallback([this, playerID](int enemyId, float damage, bool killed) {
+                            int playerIndex = players.IndexOf(it);
+                            rp.player.GetForceField()->SetZapCallback([this, playerIndex](int enemyId, float damage, bool killed) {
                                 // Handle zap event
                                 if (playerManager) {
-                                    playerManager->HandleForceFieldZap(playerID, enemyId, damage, killed);
+                                    playerManager->HandleForceFieldZap(playerIndex, enemyId, damage, killed);
                                 }
                             });
                             
@@ -396,54 +367,62 @@ void PlayingState::Update(float dt) {
     game->GetCamera().setCenter(localPlayerPos);
 }
 
-void PlayingState::Render() {
-    game->GetWindow().clear(MAIN_BACKGROUND_COLOR);
+void PlayingState::Render(RenderSnapshot& frame) {
+    frame.Clear(MAIN_BACKGROUND_COLOR);
     
     try {
+        // Follow the interpolated local player so the camera moves as smoothly as the world
+        float alpha = game->GetRenderAlpha();
+        if (playerManager) {
+            game->GetCamera().setCenter(playerManager->GetLocalPlayer().player.GetInterpolatedPosition(alpha));
+        }
+        
         // Set the game camera view for world rendering
-        game->GetWindow().setView(game->GetCamera());
+        frame.SetView(game->GetCamera());
         
         if (showGrid) {
-            grid.render(game->GetWindow(), game->GetCamera());
+            grid.setMinorLinesEnabled(QualityGovernor::Get().GetProfile().gridMinorLines);
+            grid.render(frame, game->GetCamera());
         }
         
         if (playerLoaded) {
             // Render all players
             if (playerRenderer) {
-                playerRenderer->Render(game->GetWindow());
+                playerRenderer->Render(frame, alpha);
             }
             
+            // Shared particles sit under the force fields and enemies
+            ParticleSystem::Get().Render(frame);
+            
             // THIS IS THE IMPORTANT PART: Render force fields for all players
             for (auto& pair : playerManager->GetPlayers()) {
                 RemotePlayer& rp = pair.second;
                 if (rp.player.HasForceField() && rp.player.HasForceField() && !rp.player.IsDead()) {                
-                    rp.player.GetForceField()->Render(game->GetWindow());
+                    rp.player.GetForceField()->Render(frame);
                 }
             }
             
             // Render enemies after players
             if (enemyManager) {
-                enemyManager->Render(game->GetWindow());
+                enemyManager->Render(frame, alpha);
             }
         }
         
         // Switch to UI view for HUD rendering
-        game->GetWindow().setView(game->GetUIView());
+        frame.SetView(game->GetUIView());
         
         // Render HUD elements using the UI view
-        game->GetHUD().render(game->GetWindow(), game->GetUIView(), GameState::Playing);
+        game->GetHUD().render(frame, game->GetUIView(), GameState::Playing);
         
         // Render shop if visible
         if (showShop && shop) {
-            shop->Render(game->GetWindow());
+            shop->Render(frame);
         }
         
         // Render escape menu if active using the UI class
         if (showEscapeMenu && ui) {
-            ui->RenderEscapeMenu(game->GetWindow());
+            ui->RenderEscapeMenu(frame);
         }
-        
-        game->GetWindow().display();
     } catch (const std::exception& e) {
         std::cerr << "[ERROR] Exception in PlayingState::Render: " << e.what() << std::endl;
     }
@@ -551,7 +530,7 @@ void PlayingState::ProcessGameplayEvents(const sf::Event& event) {
             
             // Create the force field update message
             std::string updateMsg = PlayerMessageHandler::FormatForceFieldUpdateMessage(
-                localPlayer.playerID,
+                playerManager->GetLocalPlayerIndex(),
                 forceField->GetRadius(),
                 forceField->GetDamage(),
                 forceField->GetCooldown(),
@@ -562,10 +541,9 @@ void PlayingState::ProcessGameplayEvents(const sf::Event& event) {
             );
             
             // Check if we're the host
-            CSteamID localSteamID = SteamUser()->GetSteamID();
-            CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
+            CSteamID hostID = SessionContext::Get().GetHostID();
             
-            if (localSteamID == hostID) {
+            if (SessionContext::Get().IsHost()) {
                 // We are the host, broadcast to all clients
                 game->GetNetworkManager().BroadcastMessage(updateMsg);
             } else {
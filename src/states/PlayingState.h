@@ -5,6 +5,7 @@
 #include "../ui/Grid.h"
 #include "../entities/enemies/EnemyManager.h"
 #include "../entities/enemies/Enemy.h"
+#include "../core/SimulationTick.h"
 #include <memory>
 #include <algorithm>  // For std::sort
 #include <SFML/Graphics.hpp>
@@ -23,7 +24,7 @@ public:
     ~PlayingState();  // Added destructor for cleanup
 
     void Update(float dt) override;
-    void Render() override;
+    void Render(RenderSnapshot& frame) override;
     void ProcessEvent(const sf::Event& event) override;
     bool IsFullyLoaded();
     
@@ -54,6 +55,7 @@ private:
     std::unique_ptr<HostNetwork> hostNetwork;
     std::unique_ptr<ClientNetwork> clientNetwork;
     std::unique_ptr<EnemyManager> enemyManager;
+    std::unique_ptr<SimulationTick> tick;      // Shared with the headless runner
     std::unique_ptr<PlayingStateUI> ui;
     
     // Wave management
@@ -69,7 +71,7 @@ private:
     bool mouseHeld;
     float shootTimer;
     bool showEscapeMenu;
-
+    
     // Cursor locking
     bool cursorLocked;
     sf::Vector2i windowCenter;
@@ -339,23 +339,23 @@ void PlayingStateUI::SetWaveCompleteMessage(int currentWave, float timer) {
     m_game->GetHUD().updateText("waveInfo", waveMsg);
 }
 
-void PlayingStateUI::RenderEscapeMenu(sf::RenderWindow& window) {
+void PlayingStateUI::RenderEscapeMenu(RenderSnapshot& frame) {
     // Draw a semi-transparent overlay for the entire screen
     sf::RectangleShape overlay;
     overlay.setSize(sf::Vector2f(BASE_WIDTH, BASE_HEIGHT));
     overlay.setFillColor(sf::Color(0, 0, 0, 150));
-    window.draw(overlay);
+    frame.Draw(overlay);
     
     // Position the menu elements
     PositionEscapeMenuElements();
     
     // Draw the menu components
-    window.draw(m_menuBackground);
-    window.draw(m_menuTitle);
-    window.draw(m_continueButton);
-    window.draw(m_continueButtonText);
-    window.draw(m_returnButton);
-    window.draw(m_returnButtonText);
+    frame.Draw(m_menuBackground);
+    frame.Draw(m_menuTitle);
+    frame.Draw(m_continueButton);
+    frame.Draw(m_continueButtonText);
+    frame.Draw(m_returnButton);
+    frame.Draw(m_returnButtonText);
 }
 
 bool PlayingStateUI::ProcessUIEvent(const sf::Event& event, bool& showEscapeMenu, bool& showGrid, 
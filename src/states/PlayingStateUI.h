@@ -27,7 +27,7 @@ public:
     void UpdateDeathTimer(bool& isDeathTimerVisible);
     
     // UI Rendering
-    void RenderEscapeMenu(sf::RenderWindow& window);
+    void RenderEscapeMenu(RenderSnapshot& frame);
     
     // UI Event Processing
     bool ProcessUIEvent(const sf::Event& event, bool& showEscapeMenu, bool& showGrid, 
@@ -6,6 +6,7 @@
 
 // Forward declaration
 class Game;
+class RenderSnapshot;
 
 class State {
 public:
@@ -13,7 +14,7 @@ public:
     virtual ~State() = default;
 
     virtual void Update(float dt) = 0;
-    virtual void Render() = 0;
+    virtual void Render(RenderSnapshot& frame) = 0;   // Record this frame's drawing
     virtual void ProcessEvent(const sf::Event& event) = 0;
 
 protected:
@@ -84,15 +84,13 @@ void LobbyCreationState::Update(float dt) {
     game->GetHUD().update(game->GetWindow(), GameState::LobbyCreation, dt);
 }
 
-void LobbyCreationState::Render() {
+void LobbyCreationState::Render(RenderSnapshot& frame) {
     // Clear with background color
-    game->GetWindow().clear(MAIN_BACKGROUND_COLOR);
+    frame.Clear(MAIN_BACKGROUND_COLOR);
     
     // Use UI view
-    game->GetWindow().setView(game->GetUIView());
-    game->GetHUD().render(game->GetWindow(), game->GetUIView(), GameState::LobbyCreation);
-    
-    game->GetWindow().display();
+    frame.SetView(game->GetUIView());
+    game->GetHUD().render(frame, game->GetUIView(), GameState::LobbyCreation);
 }
 
 void LobbyCreationState::ProcessEvent(const sf::Event& event) {
@@ -11,7 +11,7 @@ class LobbyCreationState : public State {
 public:
     LobbyCreationState(Game* game);
     void Update(float dt) override;
-    void Render() override;
+    void Render(RenderSnapshot& frame) override;
     void ProcessEvent(const sf::Event& event) override;
     
     // Added state lifecycle methods
@@ -184,15 +184,13 @@ void LobbySearchState::Update(float dt) {
     }
 }
 
-void LobbySearchState::Render() {
+void LobbySearchState::Render(RenderSnapshot& frame) {
     // Clear with background color
-    game->GetWindow().clear(MAIN_BACKGROUND_COLOR);
+    frame.Clear(MAIN_BACKGROUND_COLOR);
     
     // Use UI view for menu elements
-    game->GetWindow().setView(game->GetUIView());
-    game->GetHUD().render(game->GetWindow(), game->GetUIView(), GameState::LobbySearch);
-    
-    game->GetWindow().display();
+    frame.SetView(game->GetUIView());
+    game->GetHUD().render(frame, game->GetUIView(), GameState::LobbySearch);
 }
 
 void LobbySearchState::ProcessEvents(const sf::Event& event) {
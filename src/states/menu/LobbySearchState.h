@@ -9,7 +9,7 @@ class LobbySearchState : public State {
 public:
     explicit LobbySearchState(Game* game);
     void Update(float dt) override;
-    void Render() override;
+    void Render(RenderSnapshot& frame) override;
     void ProcessEvent(const sf::Event& event) override;
 
 private:
@@ -11,6 +11,7 @@
 #include "../../network/messages/EnemyMessageHandler.h"
 #include "../../network/messages/StateMessageHandler.h"
 #include "../../network/messages/SystemMessageHandler.h" // Updated import
+#include "../../network/SessionContext.h"
 
 
 LobbyState::LobbyState(Game* game)
@@ -123,17 +124,16 @@ LobbyState::LobbyState(Game* game)
     
     
     // ===== PLAYER SETUP =====
-    CSteamID myID = SteamUser()->GetSteamID();
-    std::string myIDStr = std::to_string(myID.ConvertToUint64());
+    const SessionContext& session = SessionContext::Get();
+    std::string myIDStr = session.GetLocalIDString();
     playerManager = std::make_unique<PlayerManager>(game, myIDStr);
     playerRenderer = std::make_unique<PlayerRenderer>(playerManager.get());
 
     std::string myName = SteamFriends()->GetPersonaName();
-    CSteamID hostIDSteam = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
     
     RemotePlayer localPlayer;
     localPlayer.playerID = myIDStr;
-    localPlayer.isHost = (myID == hostIDSteam);
+    localPlayer.isHost = session.IsHost();
     localPlayer.player = Player(sf::Vector2f(0.f, 0.f), sf::Color::Blue);
     localPlayer.nameText.setFont(game->GetFont());
     localPlayer.nameText.setString(myName);
@@ -145,7 +145,7 @@ LobbyState::LobbyState(Game* game)
     playerManager->AddOrUpdatePlayer(myIDStr, localPlayer);
 
     // ===== NETWORK SETUP =====
-    if (myID == hostIDSteam) {
+    if (session.IsHost()) {
         hostNetwork = std::make_unique<HostNetwork>(game, playerManager.get());
         game->GetNetworkManager().SetMessageHandler(
             [this](const std::string& msg, CSteamID sender) {
@@ -158,7 +158,9 @@ LobbyState::LobbyState(Game* game)
             myName,
             sf::Color::Blue,
             false,  // Initial ready status
-            true    // isHost
+            true,   // isHost
+            playerManager->GetLocalPlayerIndex(),
+            game->GetTickRate()
         );
         game->GetNetworkManager().BroadcastMessage(hostConnectMsg);
         std::cout << "[HOST] Sent host connection message: " << hostConnectMsg << "\n";
@@ -211,28 +213,30 @@ void LobbyState::UpdateRemotePlayers() {
 }
 
 
-void LobbyState::Render() {
+void LobbyState::Render(RenderSnapshot& frame) {
     // Clear with background color
-    game->GetWindow().clear(MAIN_BACKGROUND_COLOR);
+    frame.Clear(MAIN_BACKGROUND_COLOR);
+    
+    // Follow the interpolated local player so the camera moves as smoothly as the world
+    float alpha = game->GetRenderAlpha();
+    if (playerManager && playerLoaded) {
+        game->GetCamera().setCenter(playerManager->GetLocalPlayer().player.GetInterpolatedPosition(alpha));
+    }
     
     // Use game camera for world elements (grid and players)
-    game->GetWindow().setView(game->GetCamera());
+    frame.SetView(game->GetCamera());
     
     if (showGrid) {
-        grid.render(game->GetWindow(), game->GetCamera());
+        grid.render(frame, game->GetCamera());
     }
     
     if (playerLoaded) {
-        playerRenderer->Render(game->GetWindow()); // Renders all players
+        playerRenderer->Render(frame, alpha); // Renders all players
     }
     
     // Use UI view for UI elements
-    game->GetWindow().setView(game->GetUIView());
-    game->GetHUD().render(game->GetWindow(), game->GetUIView(), GameState::Lobby);
-    
-    
-    
-    game->GetWindow().display();
+    frame.SetView(game->GetUIView());
+    game->GetHUD().render(frame, game->GetUIView(), GameState::Lobby);
 }
 
 void LobbyState::ProcessEvents(const sf::Event& event) {
@@ -243,12 +247,12 @@ void LobbyState::ProcessEvents(const sf::Event& event) {
         // Check if the ready toggle key was pressed using InputManager
         if (event.key.code == inputManager.GetKeyBinding(GameAction::ToggleReady)) {
             // Toggle ready status
-            std::string myID = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
+            std::string myID = SessionContext::Get().GetLocalIDString();
             bool currentReady = playerManager->GetLocalPlayer().isReady;
             bool newReady = !currentReady;
             playerManager->SetReadyStatus(myID, newReady);
             std::cout << "Ready status set to " << newReady << "\n";
-            std::string msg = StateMessageHandler::FormatReadyStatusMessage(myID, newReady);
+            std::string msg = StateMessageHandler::FormatReadyStatusMessage(playerManager->GetLocalPlayerIndex(), newReady);
             if (hostNetwork) {
                 game->GetNetworkManager().BroadcastMessage(msg);
             } else if (clientNetwork) {
@@ -294,14 +298,12 @@ void LobbyState::ProcessEvents(const sf::Event& event) {
                         // Handle UI element clicks
                         if (id == "startGame") {
                             // Check if we're the host
-                            CSteamID myID = SteamUser()->GetSteamID();
-                            CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
-                            if (myID == hostID && AllPlayersReady()) {
+                            if (SessionContext::Get().IsHost() && AllPlayersReady()) {
                                 // Only proceed if we're not already transitioning
                                 if (game->GetCurrentState() == GameState::Lobby) {
                                     std::cout << "[LOBBY] Host clicked start game, sending message and transitioning" << std::endl;
                                     // Broadcast "start game" message
-                                    std::string startMsg = StateMessageHandler::FormatStartGameMessage(std::to_string(myID.ConvertToUint64()));
+                                    std::string startMsg = StateMessageHandler::FormatStartGameMessage(SessionContext::Get().GetLocalIDString());
                                     game->GetNetworkManager().BroadcastMessage(startMsg);
                                     
                                     // Switch to playing state
@@ -311,12 +313,12 @@ void LobbyState::ProcessEvents(const sf::Event& event) {
                         }
                         else if (id == "readyButton") {
                             // Toggle ready status
-                            std::string myID = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
+                            std::string myID = SessionContext::Get().GetLocalIDString();
                             bool currentReady = playerManager->GetLocalPlayer().isReady;
                             bool newReady = !currentReady;
                             playerManager->SetReadyStatus(myID, newReady);
                             std::cout << "Ready status set to " << newReady << "\n";
-                            std::string msg = StateMessageHandler::FormatReadyStatusMessage(myID, newReady);
+                            std::string msg = StateMessageHandler::FormatReadyStatusMessage(playerManager->GetLocalPlayerIndex(), newReady);
                             if (hostNetwork) {
                                 game->GetNetworkManager().BroadcastMessage(msg);
                             } else if (clientNetwork) {
@@ -342,7 +344,7 @@ void LobbyState::ProcessEvents(const sf::Event& event) {
         
         // If we got here and should shoot, no UI element was clicked, so process as a game click
         if (shouldShoot) {
-            std::string myIDStr = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
+            std::string myIDStr = SessionContext::Get().GetLocalIDString();
             
             // Don't shoot if player is dead
             if (playerManager->GetLocalPlayer().player.IsDead()) {
@@ -363,7 +365,7 @@ void LobbyState::ProcessEvents(const sf::Event& event) {
         // Shooting with keyboard
         sf::Vector2i mousePos = sf::Mouse::getPosition(game->GetWindow());
         
-        std::string myIDStr = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
+        std::string myIDStr = SessionContext::Get().GetLocalIDString();
         
         // Don't shoot if player is dead
         if (playerManager->GetLocalPlayer().player.IsDead()) {
@@ -411,8 +413,7 @@ void LobbyState::Update(float dt) {
         }
     } else {
         // Update PlayerManager (includes local player movement)
-        // Ensure we're passing the Game pointer for InputManager access
-        playerManager->Update(game);
+        playerManager->Update(dt);
        
         if (clientNetwork) clientNetwork->Update();
         if (hostNetwork) hostNetwork->Update();
@@ -433,7 +434,7 @@ void LobbyState::Update(float dt) {
     }
     
     // Update ready status button color
-    std::string myID = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
+    std::string myID = SessionContext::Get().GetLocalIDString();
     bool isReady = playerManager->GetLocalPlayer().isReady;
     if (isReady) {
         game->GetHUD().updateText("readyButton", "Ready [R to Cancel]");
@@ -445,7 +446,7 @@ void LobbyState::Update(float dt) {
     
     
     // Update start game button for host
-    if (SteamUser()->GetSteamID() == SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID())) {
+    if (SessionContext::Get().IsHost()) {
         // Check if all players are ready
         bool allReady = AllPlayersReady();
         if (allReady) {
@@ -549,7 +550,7 @@ bool LobbyState::IsFullyLoaded() {
 }
 
 void LobbyState::AttemptShoot(int mouseX, int mouseY) {
-    std::string myID = std::to_string(SteamUser()->GetSteamID().ConvertToUint64());
+    std::string myID = SessionContext::Get().GetLocalIDString();
     
     // Don't shoot if player is dead
     if (playerManager->GetLocalPlayer().player.IsDead()) {
@@ -571,7 +572,7 @@ void LobbyState::AttemptShoot(int mouseX, int mouseY) {
         playerManager->AddBullet(myID, params.position, params.direction, bulletSpeed);
         
         // Send bullet message to others
-        std::string msg = PlayerMessageHandler::FormatBulletMessage(myID, params.position, params.direction, bulletSpeed);
+        std::string msg = PlayerMessageHandler::FormatBulletMessage(playerManager->GetLocalPlayerIndex(), params.position, params.direction, bulletSpeed);
         
         if (hostNetwork) {
             // If we're the host, broadcast to all clients
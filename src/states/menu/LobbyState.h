@@ -23,7 +23,7 @@ public:
     ~LobbyState();
     bool IsFullyLoaded();
     void Update(float dt) override;
-    void Render() override;
+    void Render(RenderSnapshot& frame) override;
     
     void ProcessEvent(const sf::Event& event) override;
     
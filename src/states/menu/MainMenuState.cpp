@@ -122,15 +122,13 @@ void MainMenuState::Update(float dt) {
     game->GetHUD().update(game->GetWindow(), GameState::MainMenu, dt);
 }
 
-void MainMenuState::Render() {
+void MainMenuState::Render(RenderSnapshot& frame) {
     // Clear with background color
-    game->GetWindow().clear(MAIN_BACKGROUND_COLOR);
+    frame.Clear(MAIN_BACKGROUND_COLOR);
     
     // Use UI view for menu elements
-    game->GetWindow().setView(game->GetUIView());
-    game->GetHUD().render(game->GetWindow(), game->GetUIView(), GameState::MainMenu);
-    
-    game->GetWindow().display();
+    frame.SetView(game->GetUIView());
+    game->GetHUD().render(frame, game->GetUIView(), GameState::MainMenu);
 }
 
 // Fixed implementation - merged both versions and removed the override keyword
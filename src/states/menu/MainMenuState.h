@@ -11,7 +11,7 @@ class MainMenuState : public State {
 public:
     explicit MainMenuState(Game* game);
     void Update(float dt) override;
-    void Render() override;
+    void Render(RenderSnapshot& frame) override;
     void ProcessEvent(const sf::Event& event) override;
 
 private:
@@ -1,6 +1,7 @@
 #include "SettingsState.h"
 #include "../core/Game.h"
 #include "../../utils/input/InputManager.h"
+#include "../../core/QualityGovernor.h"
 
 SettingsState::SettingsState(Game* game)
     : State(game) {
@@ -285,14 +286,14 @@ void SettingsState::Update(float dt) {
                                   sf::Color(80, 80, 100, 220));
 }
 
-void SettingsState::DrawSelectedIndicator(float yPos) {
+void SettingsState::DrawSelectedIndicator(RenderSnapshot& frame, float yPos) {
     sf::RectangleShape indicator(sf::Vector2f(10.0f, 10.0f));
     indicator.setFillColor(sf::Color::Yellow);
     indicator.setPosition(250.0f, yPos + settingHeight / 2.0f - 5.0f);
-    game->GetWindow().draw(indicator);
+    frame.Draw(indicator);
 }
 
-void SettingsState::DrawSlider(const Setting& setting, float yPos) {
+void SettingsState::DrawSlider(RenderSnapshot& frame, const Setting& setting, float yPos) {
     if (setting.type != SettingType::Slider) return;
     
     float centerX = BASE_WIDTH / 2.0f;
@@ -305,7 +306,7 @@ void SettingsState::DrawSlider(const Setting& setting, float yPos) {
     sf::RectangleShape sliderBg(sf::Vector2f(sliderWidth, sliderHeight));
     sliderBg.setFillColor(sf::Color(60, 60, 80));
     sliderBg.setPosition(sliderX, sliderY);
-    game->GetWindow().draw(sliderBg);
+    frame.Draw(sliderBg);
     
     // Draw slider fill based on value
     int value = std::stoi(setting.currentValue);
@@ -313,14 +314,14 @@ void SettingsState::DrawSlider(const Setting& setting, float yPos) {
     sf::RectangleShape sliderFill(sf::Vector2f(sliderWidth * fillPercent, sliderHeight));
     sliderFill.setFillColor(sf::Color(100, 150, 255));
     sliderFill.setPosition(sliderX, sliderY);
-    game->GetWindow().draw(sliderFill);
+    frame.Draw(sliderFill);
     
     // Draw slider handle
     sf::CircleShape handle(8.0f);
     handle.setFillColor(sf::Color::White);
     handle.setOrigin(8.0f, 8.0f);
     handle.setPosition(sliderX + sliderWidth * fillPercent, sliderY + sliderHeight / 2.0f);
-    game->GetWindow().draw(handle);
+    frame.Draw(handle);
     
     // Draw arrow indicators for adjusting the slider
     sf::ConvexShape leftArrow;
@@ -329,7 +330,7 @@ void SettingsState::DrawSlider(const Setting& setting, float yPos) {
     leftArrow.setPoint(1, sf::Vector2f(sliderX - 10.0f, sliderY - 5.0f));
     leftArrow.setPoint(2, sf::Vector2f(sliderX - 10.0f, sliderY + sliderHeight + 5.0f));
     leftArrow.setFillColor(sf::Color(180, 180, 200));
-    game->GetWindow().draw(leftArrow);
+    frame.Draw(leftArrow);
     
     sf::ConvexShape rightArrow;
     rightArrow.setPointCount(3);
@@ -337,10 +338,10 @@ void SettingsState::DrawSlider(const Setting& setting, float yPos) {
     rightArrow.setPoint(1, sf::Vector2f(sliderX + sliderWidth + 10.0f, sliderY - 5.0f));
     rightArrow.setPoint(2, sf::Vector2f(sliderX + sliderWidth + 10.0f, sliderY + sliderHeight + 5.0f));
     rightArrow.setFillColor(sf::Color(180, 180, 200));
-    game->GetWindow().draw(rightArrow);
+    frame.Draw(rightArrow);
 }
 
-void SettingsState::DrawSettings() {
+void SettingsState::DrawSettings(RenderSnapshot& frame) {
     float centerX = BASE_WIDTH / 2.0f;
     float yPos = settingsStartY;
     
@@ -353,7 +354,7 @@ void SettingsState::DrawSettings() {
     // Controls category
     categoryText.setString("Controls");
     categoryText.setPosition(centerX - 350.0f, yPos);
-    game->GetWindow().draw(categoryText);
+    frame.Draw(categoryText);
     yPos += 40.0f;
     
     // Draw settings
@@ -365,7 +366,7 @@ void SettingsState::DrawSettings() {
             yPos += 20.0f; // Add some space
             categoryText.setString("Other Settings");
             categoryText.setPosition(centerX - 350.0f, yPos);
-            game->GetWindow().draw(categoryText);
+            frame.Draw(categoryText);
             yPos += 40.0f;
         }
         
@@ -398,29 +399,41 @@ void SettingsState::DrawSettings() {
             if (!setting.isWaitingForInput) {
                 valueText.setFillColor(sf::Color::Yellow);
             }
-            DrawSelectedIndicator(yPos);
+            DrawSelectedIndicator(frame, yPos);
         }
         
-        game->GetWindow().draw(nameText);
-        game->GetWindow().draw(valueText);
+        frame.Draw(nameText);
+        frame.Draw(valueText);
+        
+        // The adaptive effects tier is read-only, so it sits next to the FPS toggle
+        if (setting.id == "showFPS") {
+            QualityGovernor& quality = QualityGovernor::Get();
+            sf::Text tierText;
+            tierText.setFont(game->GetFont());
+            tierText.setString("Effects Quality: " + QualityGovernor::TierToString(quality.GetTier()) + " (auto)");
+            tierText.setCharacterSize(16);
+            tierText.setFillColor(sf::Color(160, 160, 200));
+            tierText.setPosition(centerX + 130.0f, yPos + 3.0f);
+            frame.Draw(tierText);
+        }
         
         // Draw sliders for slider settings
         if (setting.type == SettingType::Slider) {
-            DrawSlider(setting, yPos);
+            DrawSlider(frame, setting, yPos);
         }
         
         yPos += settingOffset;
     }
     
     // Draw buttons
-    game->GetWindow().draw(saveButton.shape);
-    game->GetWindow().draw(saveButton.text);
+    frame.Draw(saveButton.shape);
+    frame.Draw(saveButton.text);
     
-    game->GetWindow().draw(cancelButton.shape);
-    game->GetWindow().draw(cancelButton.text);
+    frame.Draw(cancelButton.shape);
+    frame.Draw(cancelButton.text);
     
-    game->GetWindow().draw(resetButton.shape);
-    game->GetWindow().draw(resetButton.text);
+    frame.Draw(resetButton.shape);
+    frame.Draw(resetButton.text);
     
     // Draw controls at the bottom
     float controlsY = BASE_HEIGHT - 100.0f;
@@ -434,30 +447,27 @@ void SettingsState::DrawSettings() {
     sf::FloatRect bounds = controlsText.getLocalBounds();
     controlsText.setPosition(centerX - bounds.width / 2.0f, controlsY);
     
-    game->GetWindow().draw(controlsText);
+    frame.Draw(controlsText);
 }
 
-void SettingsState::Render() {
+void SettingsState::Render(RenderSnapshot& frame) {
     // Clear the window with a dark background
-    game->GetWindow().clear(sf::Color(20, 20, 30));
+    frame.Clear(sf::Color(20, 20, 30));
     
     // Use UI view for settings screen
-    game->GetWindow().setView(game->GetUIView());
+    frame.SetView(game->GetUIView());
     
     // Draw panel background
-    game->GetWindow().draw(panelBackground);
+    frame.Draw(panelBackground);
     
     // Draw header bar
-    game->GetWindow().draw(headerBar);
+    frame.Draw(headerBar);
     
     // Draw title
-    game->GetWindow().draw(titleText);
+    frame.Draw(titleText);
     
     // Draw all settings
-    DrawSettings();
-    
-    // Display the rendered frame
-    game->GetWindow().display();
+    DrawSettings(frame);
 }
 
 void SettingsState::ProcessEvent(const sf::Event& event) {
@@ -625,6 +635,7 @@ void SettingsState::SaveAndExit() {
     
     // Update the input handler with new settings
     game->GetInputHandler()->UpdateKeyBindings();
+    game->ApplyDisplaySettings();
     
     // Synchronize InputManager with the new settings
     InputManager& inputManager = game->GetInputManager();
@@ -48,7 +48,7 @@ public:
     SettingsState(Game* game);
     
     void Update(float dt) override;
-    void Render() override;
+    void Render(RenderSnapshot& frame) override;
     void ProcessEvent(const sf::Event& event) override;
     
 private:
@@ -74,9 +74,9 @@ private:
                          const std::function<void(int)>& setInt,
                          int min, int max, int step);
     
-    void DrawSettings();
-    void DrawSelectedIndicator(float yPos);
-    void DrawSlider(const Setting& setting, float yPos);
+    void DrawSettings(RenderSnapshot& frame);
+    void DrawSelectedIndicator(RenderSnapshot& frame, float yPos);
+    void DrawSlider(RenderSnapshot& frame, const Setting& setting, float yPos);
     
     void SaveAndExit();
     void CancelAndExit();
@@ -5,6 +5,7 @@
 #include "../../network/messages/EnemyMessageHandler.h"
 #include "../../network/messages/StateMessageHandler.h"
 #include "../../network/messages/SystemMessageHandler.h"
+#include "../../network/SessionContext.h"
 #include <steam/steam_api.h>
 #include <iostream>
 
@@ -40,7 +41,7 @@ void ShopItem::SetFont(const sf::Font& font) {
     levelText.setFont(font);
 }
 
-void ShopItem::Render(sf::RenderWindow& window, sf::Vector2f position, bool isHighlighted) {
+void ShopItem::Render(RenderSnapshot& frame, sf::Vector2f position, bool isHighlighted) {
     // Update position
     background.setPosition(position);
     
@@ -79,11 +80,11 @@ void ShopItem::Render(sf::RenderWindow& window, sf::Vector2f position, bool isHi
     bounds = background.getGlobalBounds();
     
     // Draw the item components
-    window.draw(background);
-    window.draw(nameText);
-    window.draw(descriptionText);
-    window.draw(costText);
-    window.draw(levelText);
+    frame.Draw(background);
+    frame.Draw(nameText);
+    frame.Draw(descriptionText);
+    frame.Draw(costText);
+    frame.Draw(levelText);
 }
 
 // Shop implementation
@@ -217,26 +218,26 @@ void Shop::Update(float dt) {
     UpdateMoneyDisplay();
 }
 
-void Shop::Render(sf::RenderWindow& window) {
+void Shop::Render(RenderSnapshot& frame) {
     if (!isOpen) return;
     
     // Store original view
-    sf::View originalView = window.getView();
+    sf::View originalView = frame.GetView();
     
     // Set UI view for shop rendering
-    window.setView(game->GetUIView());
+    frame.SetView(game->GetUIView());
     
     // Draw semi-transparent overlay
     sf::RectangleShape overlay;
     overlay.setSize(sf::Vector2f(BASE_WIDTH, BASE_HEIGHT));
     overlay.setFillColor(sf::Color(0, 0, 0, 150));
-    window.draw(overlay);
+    frame.Draw(overlay);
     
     // Draw shop background
-    window.draw(shopBackground);
-    window.draw(shopTitle);
-    window.draw(playerMoneyText);
-    window.draw(instructionsText);
+    frame.Draw(shopBackground);
+    frame.Draw(shopTitle);
+    frame.Draw(playerMoneyText);
+    frame.Draw(instructionsText);
     
     float centerX = BASE_WIDTH / 2.0f;
     float startY = (BASE_HEIGHT - shopBackground.getSize().y) / 2.0f + ITEM_Y_OFFSET;
@@ -283,7 +284,7 @@ void Shop::Render(sf::RenderWindow& window) {
         // Only render if within visible area
         if (itemY + ITEM_SPACING > shopTop && itemY < shopBottom) {
             sf::Vector2f itemPos(centerX - 190.0f, itemY);
-            items[i].Render(window, itemPos, i == selectedIndex);
+            items[i].Render(frame, itemPos, i == selectedIndex);
         }
     }
     
@@ -296,17 +297,17 @@ void Shop::Render(sf::RenderWindow& window) {
         scrollbarTrack.setSize(sf::Vector2f(8.0f, visibleAreaHeight));
         scrollbarTrack.setPosition(shopBounds.left + shopBounds.width - 20.0f, shopTop);
         scrollbarTrack.setFillColor(sf::Color(40, 40, 40, 150));
-        window.draw(scrollbarTrack);
+        frame.Draw(scrollbarTrack);
         
         sf::RectangleShape scrollbar;
         scrollbar.setSize(sf::Vector2f(8.0f, scrollbarHeight));
         scrollbar.setPosition(shopBounds.left + shopBounds.width - 20.0f, scrollbarY);
         scrollbar.setFillColor(sf::Color(150, 150, 255, 200));
-        window.draw(scrollbar);
+        frame.Draw(scrollbar);
     }
     
     // Restore original view
-    window.setView(originalView);
+    frame.SetView(originalView);
 }
 
 void Shop::ProcessEvent(const sf::Event& event) {
@@ -409,12 +410,9 @@ void Shop::SendForceFieldUpdateToNetwork(const Player& player) {
         return;
     }
     
-    // Get the local player ID
-    std::string playerID = playerManager->GetLocalPlayer().playerID;
-    
-    // Create the force field update message
+    // Create the force field update message for the local player's slot
     std::string updateMsg = PlayerMessageHandler::FormatForceFieldUpdateMessage(
-        playerID,
+        playerManager->GetLocalPlayerIndex(),
         forceField->GetRadius(),
         forceField->GetDamage(),
         forceField->GetCooldown(),
@@ -425,10 +423,9 @@ void Shop::SendForceFieldUpdateToNetwork(const Player& player) {
     );
     
     // Check if we're the host
-    CSteamID localSteamID = SteamUser()->GetSteamID();
-    CSteamID hostID = SteamMatchmaking()->GetLobbyOwner(game->GetLobbyID());
+    CSteamID hostID = SessionContext::Get().GetHostID();
     
-    if (localSteamID == hostID) {
+    if (SessionContext::Get().IsHost()) {
         // We are the host, broadcast to all clients
         game->GetNetworkManager().BroadcastMessage(updateMsg);
         std::cout << "[SHOP] Broadcast force field update as host\n";
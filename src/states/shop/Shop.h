@@ -26,7 +26,7 @@ public:
     ShopItem(ShopItemType type, const std::string& name, const std::string& description, 
              int baseCost, int level = 0, int maxLevel = SHOP_DEFAULT_MAX_LEVEL);
     
-    void Render(sf::RenderWindow& window, sf::Vector2f position, bool isHighlighted);
+    void Render(RenderSnapshot& frame, sf::Vector2f position, bool isHighlighted);
     void SetFont(const sf::Font& font);
     
     ShopItemType GetType() const { return type; }
@@ -69,7 +69,7 @@ public:
     void Close() { isOpen = false; }
     
     void Update(float dt);
-    void Render(sf::RenderWindow& window);
+    void Render(RenderSnapshot& frame);
     void ProcessEvent(const sf::Event& event);
     
     // Apply purchased upgrades to the player
@@ -1,4 +1,5 @@
 #include "Grid.h"
+#include "../render/RenderSnapshot.h"
 #include <cmath>
 
 Grid::Grid(float cellSize, sf::Color lineColor)
@@ -14,7 +15,7 @@ Grid::Grid(float cellSize, sf::Color lineColor)
     );
 }
 
-void Grid::render(sf::RenderWindow& window, const sf::View& view) {
+void Grid::render(RenderSnapshot& frame, const sf::View& view) {
     // Get the visible area
     sf::Vector2f viewCenter = view.getCenter();
     sf::Vector2f viewSize = view.getSize();
@@ -30,14 +31,14 @@ void Grid::render(sf::RenderWindow& window, const sf::View& view) {
     
     // Draw grid (minor lines first, then major lines on top)
     sf::RenderStates minorStates;
-    window.draw(minorLines, minorStates);
+    frame.Draw(minorLines, minorStates);
     
     sf::RenderStates majorStates;
-    window.draw(majorLines, majorStates);
+    frame.Draw(majorLines, majorStates);
     
     // Draw origin highlight if enabled
     if (highlightOrigin) {
-        drawOriginHighlight(window);
+        drawOriginHighlight(frame);
     }
 }
 
@@ -70,7 +71,7 @@ void Grid::updateGridLines(const sf::FloatRect& viewBounds) {
             sf::Vertex lineEnd(sf::Vector2f(x, extendedBounds.top + extendedBounds.height), majorLineColor);
             majorLines.append(lineStart);
             majorLines.append(lineEnd);
-        } else {
+        } else if (minorLinesEnabled) {
             sf::Vertex lineStart(sf::Vector2f(x, extendedBounds.top), lineColor);
             sf::Vertex lineEnd(sf::Vector2f(x, extendedBounds.top + extendedBounds.height), lineColor);
             minorLines.append(lineStart);
@@ -88,7 +89,7 @@ void Grid::updateGridLines(const sf::FloatRect& viewBounds) {
             sf::Vertex lineEnd(sf::Vector2f(extendedBounds.left + extendedBounds.width, y), majorLineColor);
             majorLines.append(lineStart);
             majorLines.append(lineEnd);
-        } else {
+        } else if (minorLinesEnabled) {
             sf::Vertex lineStart(sf::Vector2f(extendedBounds.left, y), lineColor);
             sf::Vertex lineEnd(sf::Vector2f(extendedBounds.left + extendedBounds.width, y), lineColor);
             minorLines.append(lineStart);
@@ -105,7 +106,7 @@ bool Grid::isMajorLine(int index) const {
     return (index % majorLineInterval) == 0;
 }
 
-void Grid::drawOriginHighlight(sf::RenderWindow& window) {
+void Grid::drawOriginHighlight(RenderSnapshot& frame) {
     // Create a cross at the origin point
     sf::RectangleShape horizontalLine;
     horizontalLine.setSize(sf::Vector2f(originHighlightSize * 2, originHighlightSize / 5));
@@ -121,8 +122,8 @@ void Grid::drawOriginHighlight(sf::RenderWindow& window) {
     
 
     
-    window.draw(horizontalLine);
-    window.draw(verticalLine);
+    frame.Draw(horizontalLine);
+    frame.Draw(verticalLine);
     
 }
 
@@ -168,4 +169,8 @@ void Grid::setOriginHighlightColor(const sf::Color& color) {
 
 void Grid::setOriginHighlightSize(float size) {
     originHighlightSize = size;
+}
+
+void Grid::setMinorLinesEnabled(bool enabled) {
+    minorLinesEnabled = enabled;
 }
\ No newline at end of file
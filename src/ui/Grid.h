@@ -3,11 +3,13 @@
 
 #include <SFML/Graphics.hpp>
 
+class RenderSnapshot;
+
 class Grid {
 public:
     Grid(float cellSize = 50.f, sf::Color lineColor = sf::Color(200, 200, 200));
     
-    void render(sf::RenderWindow& window, const sf::View& view);
+    void render(RenderSnapshot& frame, const sf::View& view);
     void setLineColor(const sf::Color& color);
     void setCellSize(float size);
     
@@ -19,6 +21,7 @@ public:
     void setOriginHighlight(bool highlight);
     void setOriginHighlightColor(const sf::Color& color);
     void setOriginHighlightSize(float size);
+    void setMinorLinesEnabled(bool enabled);
     
 private:
     float cellSize;
@@ -30,6 +33,7 @@ private:
     int majorLineInterval = 5;      // Draw thicker line every X cells
     float minorLineThickness = 1.0f;
     float majorLineThickness = 2.0f;
+    bool minorLinesEnabled = true;  // Lowered by the quality governor to thin the grid
     
     bool highlightOrigin = true;
     sf::Color originHighlightColor = sf::Color(255, 0, 0, 100); // Transparent red
@@ -37,7 +41,7 @@ private:
     
     void updateGridLines(const sf::FloatRect& viewBounds);
     bool isMajorLine(int index) const;
-    void drawOriginHighlight(sf::RenderWindow& window);
+    void drawOriginHighlight(RenderSnapshot& frame);
 };
 
 #endif // GRID_H
\ No newline at end of file
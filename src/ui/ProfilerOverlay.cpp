@@ -0,0 +1,114 @@
+#include "ProfilerOverlay.h"
+#include "../render/RenderSnapshot.h"
+#include <cstdio>
+#include <string>
+
+namespace {
+    const unsigned int CHARACTER_SIZE = 14;
+    const float PADDING = 8.f;
+    const float COLUMN_WIDTH = 70.f;
+    const float NAME_WIDTH = 220.f;
+
+    void AppendMs(std::string& column, float ms) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.2f\n", ms);
+        column += buffer;
+    }
+
+    void AppendCount(std::string& column, float count) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.1f\n", count);
+        column += buffer;
+    }
+
+#if ALLOCATION_TRACKING
+    const int COLUMN_COUNT = 5;
+#else
+    const int COLUMN_COUNT = 3;
+#endif
+}
+
+ProfilerOverlay::ProfilerOverlay(sf::Font& font) {
+    for (sf::Text* text : {&names, &lastColumn, &averageColumn, &maxColumn, &allocationColumn, &kilobyteColumn}) {
+        text->setFont(font);
+        text->setCharacterSize(CHARACTER_SIZE);
+        text->setFillColor(sf::Color::White);
+    }
+    background.setFillColor(sf::Color(0, 0, 0, 180));
+}
+
+void ProfilerOverlay::Update(float dt) {
+    if (!visible) return;
+    refreshTimer += dt;
+    if (refreshTimer < PROFILER_OVERLAY_REFRESH) return;
+    refreshTimer = 0.f;
+    Rebuild();
+}
+
+void ProfilerOverlay::Rebuild() {
+    Profiler::Get().GetZoneStats(stats);
+
+    std::string nameLines = "Zone\n";
+    std::string lastLines = "Last\n";
+    std::string averageLines = "Avg\n";
+    std::string maxLines = "Max\n";
+    std::string allocationLines = "Allocs\n";
+    std::string kilobyteLines = "KB\n";
+    for (const Profiler::ZoneStats& zone : stats) {
+        // Indent with spaces; a proportional font makes this approximate but readable
+        nameLines.append(zone.depth * 2, ' ');
+        nameLines += zone.name;
+        if (zone.calls > 1) nameLines += " x" + std::to_string(zone.calls);
+        if (ALLOCATION_TRACKING && zone.overBudget) nameLines += " !";
+        nameLines += '\n';
+        AppendMs(lastLines, zone.lastMs);
+        AppendMs(averageLines, zone.averageMs);
+        AppendMs(maxLines, zone.maxMs);
+        AppendCount(allocationLines, zone.allocations);
+        AppendCount(kilobyteLines, zone.allocatedKB);
+    }
+#if ALLOCATION_TRACKING
+    nameLines += "Other threads\n";
+    AppendCount(allocationLines, static_cast<float>(Profiler::Get().GetOtherThreadAllocations()));
+#endif
+
+    names.setString(nameLines);
+    lastColumn.setString(lastLines);
+    averageColumn.setString(averageLines);
+    maxColumn.setString(maxLines);
+    allocationColumn.setString(allocationLines);
+    kilobyteColumn.setString(kilobyteLines);
+
+    float height = names.getLocalBounds().height + names.getLocalBounds().top;
+    background.setSize(sf::Vector2f(NAME_WIDTH + COLUMN_WIDTH * COLUMN_COUNT + PADDING * 2, height + PADDING * 2));
+}
+
+void ProfilerOverlay::Render(RenderSnapshot& frame, const sf::View& view) {
+    if (!visible || stats.empty()) return;
+
+    sf::View originalView = frame.GetView();
+    frame.SetView(view);
+
+    // Top-left corner of the UI view
+    sf::Vector2f origin = view.getCenter() - view.getSize() / 2.f + sf::Vector2f(PADDING, PADDING);
+    background.setPosition(origin);
+    frame.Draw(background);
+
+    sf::Vector2f textPos = origin + sf::Vector2f(PADDING, PADDING);
+    names.setPosition(textPos);
+    lastColumn.setPosition(textPos.x + NAME_WIDTH, textPos.y);
+    averageColumn.setPosition(textPos.x + NAME_WIDTH + COLUMN_WIDTH, textPos.y);
+    maxColumn.setPosition(textPos.x + NAME_WIDTH + COLUMN_WIDTH * 2, textPos.y);
+    frame.Draw(names);
+    frame.Draw(lastColumn);
+    frame.Draw(averageColumn);
+    frame.Draw(maxColumn);
+#if ALLOCATION_TRACKING
+    allocationColumn.setPosition(textPos.x + NAME_WIDTH + COLUMN_WIDTH * 3, textPos.y);
+    kilobyteColumn.setPosition(textPos.x + NAME_WIDTH + COLUMN_WIDTH * 4, textPos.y);
+    frame.Draw(allocationColumn);
+    frame.Draw(kilobyteColumn);
+#endif
+
+    frame.SetView(originalView);
+}
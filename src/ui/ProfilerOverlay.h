@@ -0,0 +1,42 @@
+#ifndef PROFILER_OVERLAY_H
+#define PROFILER_OVERLAY_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "../core/Profiler.h"
+
+class RenderSnapshot;
+
+// Screen-space table of the profiler's zones: last frame, rolling average and maximum,
+// plus average allocations and KB per frame with ALLOCATION_TRACKING (zones over their
+// budget are marked with "!").
+// The text is rebuilt every PROFILER_OVERLAY_REFRESH seconds rather than every frame,
+// both so the numbers can be read and so building it doesn't show up in the zones.
+class ProfilerOverlay {
+public:
+    explicit ProfilerOverlay(sf::Font& font);
+
+    void Toggle() { visible = !visible; refreshTimer = PROFILER_OVERLAY_REFRESH; }
+    bool IsVisible() const { return visible; }
+
+    void Update(float dt);
+    void Render(RenderSnapshot& frame, const sf::View& view);
+
+private:
+    void Rebuild();
+
+    bool visible = false;
+    float refreshTimer = 0.f;
+    std::vector<Profiler::ZoneStats> stats;
+
+    // One multi-line text per column so the numbers line up with a proportional font
+    sf::Text names;
+    sf::Text lastColumn;
+    sf::Text averageColumn;
+    sf::Text maxColumn;
+    sf::Text allocationColumn;
+    sf::Text kilobyteColumn;
+    sf::RectangleShape background;
+};
+
+#endif // PROFILER_OVERLAY_H
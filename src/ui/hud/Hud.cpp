@@ -1,4 +1,6 @@
 #include "HUD.h"
+#include "../../render/RenderSnapshot.h"
+#include "../../core/Profiler.h"
 #include <cmath>
 #include <random>
 
@@ -154,19 +156,21 @@ void HUD::animateLine(const std::string& lineId, float intensity)
 //-------------------------------------------------------------------------
 // Rendering Methods
 //-------------------------------------------------------------------------
-void HUD::render(sf::RenderWindow& window, const sf::View& view, GameState currentState) {
+void HUD::render(RenderSnapshot& frame, const sf::View& view, GameState currentState) {
+    PROFILE_SCOPE("HUD::render");
     // Store the original view
-    sf::View originalView = window.getView();
+    sf::View originalView = frame.GetView();
     
     // Set the view for UI rendering
-    window.setView(view);
+    frame.SetView(view);
+    m_renderView = view;
     
     // Render gradient line elements
     for (auto& [id, element] : m_gradientLines) {
         if (element.visibleState == currentState) {
             // Draw all segments
             for (const auto& segment : element.segments) {
-                window.draw(segment);
+                frame.Draw(segment);
             }
         }
     }
@@ -189,12 +193,12 @@ void HUD::render(sf::RenderWindow& window, const sf::View& view, GameState curre
             else
                 element.text.setFillColor(element.baseColor);
             
-            window.draw(element.text);
+            frame.Draw(element.text);
         }
     }
     
     // Restore original view
-    window.setView(originalView);
+    frame.SetView(originalView);
 }
 void HUD::update(sf::RenderWindow& window, GameState currentState, float dt) {
     // Get window mouse position
@@ -277,13 +281,12 @@ void HUD::update(sf::RenderWindow& window, GameState currentState, float dt) {
         }
     }
 }
-void HUD::drawWhiteBackground(sf::RenderWindow& window)
+void HUD::drawWhiteBackground(RenderSnapshot& frame)
 {
-    sf::RectangleShape bg(sf::Vector2f(static_cast<float>(window.getSize().x), 
-                                         static_cast<float>(window.getSize().y)));
+    sf::RectangleShape bg(frame.GetView().getSize());
     bg.setFillColor(sf::Color::White);
-    bg.setPosition(0.f, 0.f);
-    window.draw(bg);
+    bg.setPosition(frame.GetView().getCenter() - frame.GetView().getSize() / 2.f);
+    frame.Draw(bg);
 }
 
 bool HUD::isMouseOverText(const sf::RenderWindow& window, const sf::Text& text)
@@ -319,8 +322,8 @@ void HUD::configureStoreHUD(const sf::Vector2u& winSize) {
 }
 
 sf::Vector2f HUD::windowMouseToUICoordinates(const sf::RenderWindow& window, sf::Vector2i mousePos) const {
-    // Get the current view
-    sf::View currentView = window.getView();
+    // The window's own view belongs to the render thread, so use the one the HUD was drawn with
+    const sf::View& currentView = m_renderView;
     
     // Get the viewport of the view (in normalized coordinates 0-1)
     sf::FloatRect viewport = currentView.getViewport();
@@ -11,6 +11,8 @@
 #include "../utils/config/Config.h"
 #include "../entities/player/Player.h"
 
+class RenderSnapshot;
+
 /**
  * @brief Class for managing Heads-Up Display (HUD) elements.
  *
@@ -162,12 +164,12 @@ struct HUDElement {
     void update(sf::RenderWindow& window, GameState currentState, float dt);
     
     /**
-     * @brief Renders HUD elements on the window.
-     * @param window Render window.
+     * @brief Records HUD elements into the frame being built.
+     * @param frame Render snapshot for this frame.
      * @param view Current game view.
      * @param currentState Current game state.
      */
-    void render(sf::RenderWindow& window, const sf::View& view, GameState currentState);
+    void render(RenderSnapshot& frame, const sf::View& view, GameState currentState);
 
     /**
      * @brief Returns a constant reference to the HUD elements.
@@ -198,12 +200,13 @@ private:
     std::unordered_map<std::string, HUDElement> m_elements; ///< Map of HUD elements.
     std::unordered_map<std::string, GradientLineElement> m_gradientLines; ///< Map of gradient line elements.
     std::mt19937 m_rng; ///< Random number generator for animations
+    sf::View m_renderView; ///< View the HUD was last rendered with, used for hover hit tests
 
     /**
-     * @brief Draws a white background on the window.
-     * @param window Render window.
+     * @brief Draws a white background over the current view.
+     * @param frame Render snapshot for this frame.
      */
-    void drawWhiteBackground(sf::RenderWindow& window);
+    void drawWhiteBackground(RenderSnapshot& frame);
 
     /**
      * @brief Checks if the mouse is over the given text.
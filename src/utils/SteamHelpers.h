@@ -2,7 +2,7 @@
 #define STEAM_HELPERS_H
 
 #include "../entities/player/Player.h"
-#include "../entities/player/Bullet.h"
+#include "../network/SnapshotBuffer.h"
 #include <SFML/Graphics.hpp>
 #include <steam/steam_api.h>
 #include <cstdint>
@@ -47,6 +47,9 @@ struct RemotePlayer {
     sf::Vector2f targetPosition;
     std::chrono::steady_clock::time_point lastUpdateTime;
     float interpDuration = 0.1f; // Time to interpolate between positions
+    sf::Vector2f velocity;       // Last velocity reported by the host snapshot
+    uint32_t lastInputSequence = 0; // Host: newest movement command applied for this player
+    SnapshotBuffer snapshots;    // Client: host snapshots, drawn SNAPSHOT_INTERP_DELAY behind
     
     // Game stats
     int kills = 0;
@@ -68,6 +71,9 @@ struct RemotePlayer {
         targetPosition(other.targetPosition),
         lastUpdateTime(other.lastUpdateTime),
         interpDuration(other.interpDuration),
+        velocity(other.velocity),
+        lastInputSequence(other.lastInputSequence),
+        snapshots(other.snapshots),
         kills(other.kills),
         money(other.money),
         respawnTimer(other.respawnTimer) {}
@@ -86,6 +92,9 @@ struct RemotePlayer {
             targetPosition = other.targetPosition;
             lastUpdateTime = other.lastUpdateTime;
             interpDuration = other.interpDuration;
+            velocity = other.velocity;
+            lastInputSequence = other.lastInputSequence;
+            snapshots = other.snapshots;
             kills = other.kills;
             money = other.money;
             respawnTimer = other.respawnTimer;
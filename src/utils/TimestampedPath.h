@@ -0,0 +1,15 @@
+#ifndef TIMESTAMPED_PATH_H
+#define TIMESTAMPED_PATH_H
+
+#include <ctime>
+#include <string>
+
+// <prefix>YYYYMMDD_HHMMSS<extension> in local time, for diagnostic files written next to the game
+inline std::string MakeTimestampedPath(const std::string& prefix, const std::string& extension) {
+    char stamp[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", std::localtime(&now));
+    return prefix + stamp + extension;
+}
+
+#endif // TIMESTAMPED_PATH_H
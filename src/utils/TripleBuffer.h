@@ -0,0 +1,45 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+#include <cstdint>
+
+// Lock-free triple buffer for one writer thread and one reader thread.
+//
+// The writer fills WriteBuffer() and calls Publish(); the reader calls Acquire() and
+// then reads ReadBuffer() until its next Acquire(). Neither side ever waits on the
+// other: the writer always has a spare slot, and the reader always gets the newest
+// complete value, skipping any it was too slow to pick up.
+template <typename T>
+class TripleBuffer {
+public:
+    T& WriteBuffer() { return slots[writeIndex]; }
+    const T& ReadBuffer() const { return slots[readIndex]; }
+
+    void Publish() {
+        // Hand the finished slot over and take whichever one was waiting in the middle
+        uint8_t previous = middle.exchange(static_cast<uint8_t>(writeIndex | FRESH_BIT), std::memory_order_acq_rel);
+        writeIndex = previous & INDEX_MASK;
+    }
+
+    // Swaps in the newest published value; returns false if nothing new has arrived
+    bool Acquire() {
+        if (!HasFresh()) return false;
+        uint8_t previous = middle.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    bool HasFresh() const { return (middle.load(std::memory_order_acquire) & FRESH_BIT) != 0; }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t FRESH_BIT = 0x4;
+
+    T slots[3];
+    uint8_t writeIndex = 0;             // Only touched by the writer
+    uint8_t readIndex = 1;              // Only touched by the reader
+    std::atomic<uint8_t> middle{2};     // Last published slot, with FRESH_BIT until it is acquired
+};
+
+#endif // TRIPLE_BUFFER_H
@@ -7,6 +7,16 @@
 #define BULLET_DAMAGE 20.0f
 #define BULLET_LIFETIME 5.0f
 
+// Bullet pool
+#define BULLET_POOL_CAPACITY 1024           // Live bullets across all players (storage is allocated once)
+#define BULLET_INVALID_SHOOTER 255          // Shooter byte for bullets with no registered owner
+
+// Bullet collision broadphase
+#define COLLISION_CELL_SIZE 128.0f          // Uniform grid cell size for bullet targets (pixels)
+
+// Lag compensation - client bullets hit enemies where the shooter saw them
+#define BULLET_LAG_COMP_MAX_REWIND 0.25f    // Furthest back the host rewinds enemies for a shot (seconds)
+
 // Bullet shop upgrade settings
 #define SHOP_BULLET_SPEED_MULTIPLIER 1
 #define SHOP_BULLET_SPEED_BASE_COST 1
@@ -18,11 +18,112 @@ constexpr int BASE_HEIGHT = 720;
 #define ENEMY_SYNC_INTERVAL 0.05f          // Interval for position updates
 #define FULL_SYNC_INTERVAL .5f            // Interval for full state sync
 
+// Simulated network conditions for testing prediction (0 = off). Latency delays every outgoing
+// message; loss only drops the state streams that are built to survive it (IN and PS).
+#define NET_SIM_LATENCY_MS 0               // One-way delay added to outgoing messages, e.g. 100
+#define NET_SIM_LOSS_PERCENT 0             // Percent of outgoing IN/PS messages dropped, e.g. 5
+
+// Snapshot interpolation for remote players and enemies on clients
+#define SNAPSHOT_BUFFER_SIZE 32            // Samples kept per remote entity
+#define SNAPSHOT_INTERP_DELAY 0.1f         // Seconds rendered behind the newest host snapshot (two PS intervals)
+#define SNAPSHOT_MAX_EXTRAPOLATION 0.25f   // Longest a dry buffer extrapolates along the last velocity
+
+// Simulation timing
+#define SIMULATION_TICK_RATE 60            // Default fixed simulation rate in Hz (60 or 120)
+#define MAX_FRAME_TIME 0.25f               // Longest frame fed to the accumulator, avoids catch-up bursts after stalls
+#define MAX_SIMULATION_STEPS 8             // Most fixed ticks run in a single rendered frame
+
+// Job system
+#define JOB_WORKER_THREADS -1              // Helper threads beside the main thread, -1 = one per extra core
+
+// Rendering
+#define RENDER_THREAD_ENABLED 1            // Draw snapshots on a dedicated thread (0 = replay them on the main thread)
+#define RENDER_PICKUP_TIMEOUT_MS 100       // Longest the simulation waits for the render thread to take a frame
+
+// Frame pacing
+#define FRAME_RATE_TARGET 60               // Default frame cap in Hz, 0 = uncapped
+#define FRAME_RATE_MAX 360                 // Highest cap accepted from settings
+#define FRAME_PACER_SAMPLES 240            // Rolling window of frame intervals for the jitter percentile
+#define FRAME_PACER_PERCENTILE 0.99f       // Jitter percentile reported to the log
+#define FRAME_PACER_REPORT_INTERVAL 10.0f  // Seconds between pacing reports, 0 = never
+#define FRAME_PACER_SLEEP_WEIGHT 0.02      // Weight of each new sleep in the overshoot estimate (~50 sleeps of memory)
+
+// Headless scenario runner
+#define HEADLESS_DEFAULT_PLAYERS 4         // Scripted players when --players isn't given
+#define HEADLESS_DEFAULT_WAVE_SIZE 100     // Enemies per wave when --wave-size isn't given
+#define HEADLESS_DEFAULT_TICKS 3600        // Measured ticks when --ticks isn't given (a minute at 60 Hz)
+#define HEADLESS_WARMUP_TICKS 120          // Ticks run before measuring, so the first wave is on the field
+#define HEADLESS_SPAWN_SPACING 150.0f      // Distance between scripted players' start positions
+#define HEADLESS_TURN_INTERVAL 0.75f       // Seconds a scripted player holds one movement direction
+
+// Profiling zones (PROFILE_SCOPE); on by default except in release builds, -DPROFILING_ENABLED=1 forces them on
+#ifndef PROFILING_ENABLED
+#ifdef NDEBUG
+#define PROFILING_ENABLED 0
+#else
+#define PROFILING_ENABLED 1
+#endif
+#endif
+#define PROFILER_HISTORY_FRAMES 120        // Frames the overlay averages and takes maximums over
+#define PROFILER_MAX_DEPTH 32              // Deepest zone nesting recorded, deeper zones are skipped
+#define PROFILER_OVERLAY_KEY sf::Keyboard::F3 // Shows and hides the profiler overlay
+#define PROFILER_OVERLAY_REFRESH 0.25f     // Seconds between overlay text updates, so the numbers are readable
+
+// Trace recording (Chrome trace-event JSON)
+#define TRACE_TOGGLE_KEY sf::Keyboard::F4  // Starts and stops recording a trace file
+#define TRACE_AUTO_START 0                 // Start recording as soon as the game launches
+#define TRACE_FILE_PREFIX "trace_"         // Files are named <prefix>YYYYMMDD_HHMMSS.json
+#define TRACE_BUFFER_EVENTS 16384          // Events each thread can hold between writer passes (~1.5 MB each)
+#define TRACE_FLUSH_INTERVAL_MS 50         // How often the writer thread drains the buffers
+
+// Flight recorder: recent frames kept in memory and dumped to a file on a hitch or stall.
+// Zone times come from the profiler, so release builds (PROFILING_ENABLED 0) dump counters
+// only; build with -DPROFILING_ENABLED=1 to get zones in a release dump.
+#define FLIGHT_RECORDER_FRAMES 1200        // Frames kept (20 s at 60 fps)
+#define FLIGHT_RECORDER_ZONES 24           // Profiling zones kept per frame, outermost first
+#define FLIGHT_LONG_FRAME_MS 100.0f        // A frame longer than this is dumped
+#define FLIGHT_STALL_MS 2000               // Main thread silent this long is dumped as a stall
+#define FLIGHT_WATCHDOG_POLL_MS 100        // How often the watchdog thread checks the main thread
+#define FLIGHT_DUMP_COOLDOWN 30.0f         // Seconds after a long-frame dump before the next one
+#define FLIGHT_FILE_PREFIX "flight_"       // Files are named <prefix>YYYYMMDD_HHMMSS.txt
+
+// Logging (LOG_DEBUG and friends); levels below LOG_COMPILE_LEVEL are compiled out
+#define LOG_LEVEL_TRACE 0
+#define LOG_LEVEL_DEBUG 1
+#define LOG_LEVEL_INFO 2
+#define LOG_LEVEL_WARNING 3
+#define LOG_LEVEL_ERROR 4
+#ifndef LOG_COMPILE_LEVEL
+#ifdef NDEBUG
+#define LOG_COMPILE_LEVEL LOG_LEVEL_INFO
+#else
+#define LOG_COMPILE_LEVEL LOG_LEVEL_DEBUG
+#endif
+#endif
+#define LOG_RING_SIZE 4096                 // Messages waiting for the writer thread, a power of two
+#define LOG_FLUSH_INTERVAL_MS 20           // How often the writer thread prints what is waiting
+#define LOG_RATE_LIMIT 20                  // Messages per call site per window, the rest are counted
+#define LOG_RATE_WINDOW_MS 1000            // Length of a rate limit window
+
+// Allocation tracking: heap allocations counted per profiling zone (needs PROFILING_ENABLED);
+// off by default, -DALLOCATION_TRACKING=1 and link AllocationHook.cpp to turn it on
+#ifndef ALLOCATION_TRACKING
+#define ALLOCATION_TRACKING 0
+#endif
+#if ALLOCATION_TRACKING && !PROFILING_ENABLED
+#error "ALLOCATION_TRACKING needs PROFILING_ENABLED (add -DPROFILING_ENABLED=1 to release builds)"
+#endif
+#define ALLOCATION_ZONE_BUDGET 32          // Allocations a zone may make itself per frame (average) before it is flagged
+#define ALLOCATION_FRAME_BUDGET 256        // Allocations per frame (average) before the frame as a whole is flagged
+#define ALLOCATION_REPORT_INTERVAL 10.0f   // Seconds between [ALLOC] reports in the log, 0 = never
+
 // Include specific configurations
 #include "PlayerConfig.h"
 #include "EnemyConfig.h"
 #include "BulletConfig.h"
 #include "GameplayConfig.h"
 #include "ForceFieldConfig.h"
+#include "ParticleConfig.h"
+#include "QualityConfig.h"
 
 #endif // CONFIG_H
\ No newline at end of file
@@ -17,6 +17,19 @@
 #define MAX_ENEMIES_SPAWNABLE 100000       // Maximum enemies allowed in the game
 #define ENEMY_CULLING_DISTANCE 2000.0f     // Distance from player at which enemies are culled
 #define ENEMY_OPTIMIZATION_THRESHOLD 200
+#define ENEMY_UPDATE_CHUNK_SIZE 256        // Enemies per parallel update job
+
+// Behaviour replication (squares and pentagons run their AI on clients from host state)
+#define ENEMY_BEHAVIOR_REFRESH_INTERVAL 2.0f     // Host resends every replicated behaviour this often
+#define ENEMY_BEHAVIOR_CORRECTION_INTERVAL 0.5f  // Position corrections for client-simulated enemies
+#define ENEMY_BEHAVIOR_CORRECTION_DISTANCE 40.0f // Client corrects a simulated enemy only past this error
+
+// Dead reckoning (clients coast enemies on the last replicated velocity)
+#define ENEMY_DR_ERROR_THRESHOLD 8.0f       // Host resends an enemy once clients' prediction is this far off
+#define ENEMY_DR_MAX_SILENCE 1.0f           // Longest an enemy goes without an update, in seconds
+#define ENEMY_DR_MAX_UPDATES 40             // Enemies resent per sync, worst prediction first
+#define ENEMY_DR_BLEND_TIME 0.15f           // Seconds to converge onto a new authoritative position
+#define ENEMY_DR_MAX_EXTRAPOLATION 0.5f     // Cap on advancing a late update to the present
 
 // Triangle Enemy configuration
 #define TRIANGLE_SIZE 30.0f
@@ -39,8 +39,7 @@
 #define CHARGE_COOLDOWN_REDUCTION 0.3f      // Cooldown reduction at max charge
 #define POWER_LEVEL_ORB_SIZE_FACTOR 0.1f    // Orb size increase per power level
 
-// Particle system settings
-#define MAX_PARTICLES 1000                  // Maximum number of particles
+// Particle emission settings (particles are pooled in the shared ParticleSystem)
 #define PARTICLE_AMBIENT_CHANCE 70          // Percent chance for ambient vs orbiting particles
 #define PARTICLE_ORBIT_SPEED_MIN 60.0f      // Minimum orbit speed
 #define PARTICLE_ORBIT_SPEED_MAX 120.0f     // Maximum orbit speed
@@ -172,6 +171,10 @@
 #define ZAP_SUB_BRANCH_CHANCE 30              // Chance for sub-branches
 #define ZAP_SUB_BRANCH_LENGTH 0.4f            // Sub-branch length as factor of branch
 
+// Lightning template settings
+#define ZAP_TEMPLATE_VARIANTS 8               // Pre-generated bolt/chain shapes per power level
+#define ZAP_TEMPLATE_JITTER 0.15f             // Per-frame amplitude flicker (0 disables)
+
 // Chain lightning settings
 #define FIELD_DEFAULT_CHAIN_TARGETS 3
 #define CHAIN_DAMAGE_FACTOR 0.6f              // Damage as portion of primary zap
@@ -229,6 +232,12 @@
 #define CHAIN_GLOW_RADIUS_BASE 5.0f         // Base radius for chain glow
 #define CHAIN_GLOW_ALPHA 60                 // Alpha value for chain glow
 
+// Batched rendering settings
+#define FIELD_BATCH_CIRCLE_SEGMENTS 30      // Segments for field, rings, orbs and glows (sf::CircleShape default)
+#define FIELD_BATCH_PARTICLE_SEGMENTS 6     // Segments for zap sparkles
+#define FIELD_BATCH_RESERVE_VERTICES 8192   // Initial vertex capacity of the per-frame batch
+#define ZAP_LINE_WIDTH 1.0f                 // Width of zap and chain lines in the batch
+
 // Power indicator settings
 #define POWER_MARKER_RADIUS 5.0f            // Radius of power level markers
 #define POWER_MARKER_SIDES 4                // Number of sides (4 = diamond)
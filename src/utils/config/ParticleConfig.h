@@ -0,0 +1,23 @@
+#ifndef PARTICLE_CONFIG_H
+#define PARTICLE_CONFIG_H
+
+// Shared particle pool
+#define PARTICLE_POOL_CAPACITY 8192         // Hard upper bound of the pool (storage is allocated once)
+#define PARTICLE_DEFAULT_BUDGET 4096        // Global number of live particles all emitters share
+#define PARTICLE_CULL_MARGIN 64.0f          // Extra pixels around the view before particles are culled
+#define PARTICLE_MAX_POLYGON_SIDES 8        // Largest regular polygon a particle can be drawn as
+
+// Enemy death bursts
+#define ENEMY_DEATH_PARTICLES 24            // Particles emitted when an enemy dies
+#define ENEMY_DEATH_PARTICLE_SPEED_MIN 40.0f
+#define ENEMY_DEATH_PARTICLE_SPEED_MAX 180.0f
+#define ENEMY_DEATH_PARTICLE_SIZE_MIN 2.0f
+#define ENEMY_DEATH_PARTICLE_SIZE_MAX 5.0f
+#define ENEMY_DEATH_PARTICLE_LIFETIME_MIN 0.3f
+#define ENEMY_DEATH_PARTICLE_LIFETIME_MAX 0.9f
+#define ENEMY_DEATH_COLOR_VARIATION 40      // Random brightness variation per particle
+
+// Pentagon afterimages
+#define PENTAGON_AFTERIMAGE_ALPHA 128       // Starting opacity of an afterimage (50%)
+
+#endif // PARTICLE_CONFIG_H
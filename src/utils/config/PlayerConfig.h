@@ -31,6 +31,10 @@
 #define PLAYER_NAME_COLOR sf::Color::Black
 #define PLAYER_INTERP_DURATION 0.1f
 
+// Session player registry
+#define PLAYER_REGISTRY_CAPACITY 16         // Player slots per session (lobby size plus headroom, must fit a byte)
+#define PLAYER_INVALID_INDEX -1             // Index returned when a player isn't registered
+
 // Gameplay configuration
 #define BULLET_CLEANUP_DISTANCE 1000.0f
 
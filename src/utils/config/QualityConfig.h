@@ -0,0 +1,34 @@
+#ifndef QUALITY_CONFIG_H
+#define QUALITY_CONFIG_H
+
+#include "ParticleConfig.h"
+
+// Adaptive effects quality governor
+#define QUALITY_TARGET_FRAME_TIME (1.0f / 60.0f) // Frame time the governor tries to hold when the frame rate is uncapped (seconds)
+#define QUALITY_SAMPLE_WINDOW 120                // Rolling window of frame times (about 2s at 60 FPS)
+#define QUALITY_PERCENTILE 0.95f                 // Percentile of the window compared against the target
+#define QUALITY_EVAL_INTERVAL 0.5f               // Seconds between tier evaluations
+#define QUALITY_MIN_SAMPLES 30                   // Samples needed before the governor acts
+
+// Hysteresis - a slow frame must be clearly slow and a fast one clearly fast
+#define QUALITY_DOWNGRADE_RATIO 1.20f            // Step down when the percentile exceeds target * ratio
+#define QUALITY_UPGRADE_RATIO 1.05f              // Step up only when the percentile stays under target * ratio
+#define QUALITY_DOWNGRADE_HOLD 1.0f              // Seconds over budget before stepping down
+#define QUALITY_UPGRADE_HOLD 5.0f                // Seconds under budget before stepping up
+#define QUALITY_UPGRADE_HOLD_MAX 60.0f           // Cap for the backed-off upgrade hold
+#define QUALITY_FLAP_WINDOW 10.0f                // A downgrade this soon after an upgrade doubles the upgrade hold
+
+// Per-tier effect settings (Low / Medium / High)
+#define QUALITY_LOW_PARTICLE_BUDGET 512
+#define QUALITY_MEDIUM_PARTICLE_BUDGET 2048
+#define QUALITY_HIGH_PARTICLE_BUDGET PARTICLE_DEFAULT_BUDGET
+
+#define QUALITY_LOW_GLOW_PASSES 0                // Zap glow passes (background + primary)
+#define QUALITY_MEDIUM_GLOW_PASSES 1
+#define QUALITY_HIGH_GLOW_PASSES 2
+
+#define QUALITY_LOW_AFTERIMAGE_STRIDE 4          // Emit every Nth pentagon afterimage
+#define QUALITY_MEDIUM_AFTERIMAGE_STRIDE 2
+#define QUALITY_HIGH_AFTERIMAGE_STRIDE 1
+
+#endif // QUALITY_CONFIG_H
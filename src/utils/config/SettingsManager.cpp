@@ -63,6 +63,20 @@ bool SettingsManager::LoadSettings() {
             } catch (...) {
                 settings.volumeLevel = 100;
             }
+        } else if (key == "tickRate") {
+            try {
+                settings.tickRate = std::stoi(value);
+            } catch (...) {
+                settings.tickRate = 60;
+            }
+        } else if (key == "frameRateLimit") {
+            try {
+                settings.frameRateLimit = std::stoi(value);
+            } catch (...) {
+                settings.frameRateLimit = 60;
+            }
+        } else if (key == "vsync") {
+            settings.vsync = (value == "true" || value == "1");
         }
     }
     
@@ -94,6 +108,9 @@ bool SettingsManager::SaveSettings() {
     file << "\n# Other Settings\n";
     file << "showFPS=" << (settings.showFPS ? "true" : "false") << "\n";
     file << "volumeLevel=" << settings.volumeLevel << "\n";
+    file << "tickRate=" << settings.tickRate << "\n";
+    file << "frameRateLimit=" << settings.frameRateLimit << "\n";
+    file << "vsync=" << (settings.vsync ? "true" : "false") << "\n";
     
     file.close();
     std::cout << "[SETTINGS] Settings saved successfully" << std::endl;
@@ -25,6 +25,9 @@ struct GameSettings {
     // Other settings can be added here in the future
     bool showFPS = true;
     int volumeLevel = 100;
+    int tickRate = 60;                  // Fixed simulation rate in Hz (60 or 120)
+    int frameRateLimit = 60;            // Frame cap in Hz, 0 = uncapped
+    bool vsync = false;
 };
 
 class SettingsManager {